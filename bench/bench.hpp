@@ -0,0 +1,100 @@
+/* \file
+ * Common harness of the fpm benchmarks: input generation, the measurement loop and registration.
+ */
+
+#ifndef FPM_BENCH_HPP_
+#define FPM_BENCH_HPP_
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fpm.hpp>
+
+
+namespace bench {
+
+/// Number of values processed per benchmark iteration. The inputs and outputs of an operation fit
+/// into the L1 cache, so memory bandwidth does not dominate the measurement.
+constexpr std::size_t N = 1024u;
+
+/// \returns N uniformly distributed real values in [lo, hi]. The same seed yields the same values,
+/// so that all implementations of an operation are measured with the same inputs.
+inline std::vector<double> reals(double const lo, double const hi, unsigned const seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(lo, hi);
+    std::vector<double> values(N);
+    for (auto &v : values) { v = dist(gen); }
+    return values;
+}
+
+/// \returns the given real values as Q values of the given type, scaled by truncation.
+template< class Q >
+std::vector<Q> qs(std::vector<double> const &reals) {
+    std::vector<Q> values;
+    values.reserve(reals.size());
+    for (double r : reals) {
+        values.push_back( Q::template construct<fpm::Ovf::unchecked>(
+            static_cast<typename Q::base_t>( std::ldexp(r, Q::f) ) ) );
+    }
+    return values;
+}
+
+/// \returns the given real values scaled by 2^f and truncated to the given integer type.
+template< class T, int f >
+std::vector<T> scaled(std::vector<double> const &reals) {
+    std::vector<T> values;
+    values.reserve(reals.size());
+    for (double r : reals) { values.push_back( static_cast<T>( std::ldexp(r, f) ) ); }
+    return values;
+}
+
+/// \returns the given real values converted to the given floating-point type.
+template< class T >
+std::vector<T> as(std::vector<double> const &reals) {
+    return std::vector<T>(reals.begin(), reals.end());
+}
+
+/// Applies the given operation element-wise to the inputs and stores the results. The results are
+/// clobbered after each pass, so the compiler can neither drop nor hoist the computations, but it
+/// may still vectorize the loop like it would in an application.
+template< class Op, class... In >
+void run(benchmark::State &state, Op const &op, std::vector<In> const &... in) {
+    using result_t = decltype( op(in[0]...) );
+    using out_t = std::conditional_t< std::is_same_v<result_t, bool>, unsigned char, result_t >;  // no vector<bool>
+    std::vector<out_t> out(N);
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < N; ++i) { out[i] = op(in[i]...); }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed( static_cast<int64_t>(state.iterations() * N) );
+}
+
+/// Registers a benchmark with the given name, which applies the given operation to the inputs.
+/// Names are structured as "<operation>/<type>/<implementation>", so that the JSON output can be
+/// grouped by operation and compared between the implementations.
+template< class Op, class... In >
+void add(std::string const &name, Op op, std::vector<In>... in) {
+    benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State &state) { run(state, op, in...); });
+}
+
+/// Base type name of the predefined types, e.g. "i16".
+template< class BaseT >
+std::string baseName() {
+    return (std::is_signed_v<BaseT> ? "i" : "u") + std::to_string(8u * sizeof(BaseT));
+}
+
+/// Integer type which holds intermediate products of the given base type, like the calc_t of Sq.
+template< class BaseT >
+using wide_t = std::conditional_t< sizeof(BaseT) < sizeof(int32_t), int32_t, int64_t >;
+
+}  // namespace bench
+
+#endif
+// EOF
@@ -0,0 +1,141 @@
+/* \file
+ * Benchmarks of the conversions between Q and Sq of q.hpp with the runtime overflow behaviors,
+ * each next to equivalent float, double and raw integer implementations.
+ */
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+using namespace fpm::types;
+
+
+// Implement assert trap functions. The inputs of the benchmarks are always within range.
+void fpm::ovfAssertTrap() {
+    std::abort();
+}
+void fpm::ovfAssertTrap(std::size_t) {
+    std::abort();
+}
+
+
+namespace {
+
+// Input values are within the range of the narrower target type, so that Ovf::assert does not
+// trap, but the range of the source types is larger, so that a runtime check is required.
+auto const inV = bench::reals(-1., 1., 11u);
+
+std::string ovfName(fpm::Overflow const ovf) {
+    switch (ovf) {
+    case fpm::Ovf::assert: return "assert";
+    case fpm::Ovf::clamp: return "clamp";
+    default: return "unchecked";
+    }
+}
+
+/// Trap of the baselines, equivalent to the cold overflow assert path of the library.
+[[noreturn, gnu::cold, gnu::noinline]] void trap() {
+    std::abort();
+}
+
+/// Range check of the baselines with the given overflow behavior.
+template< fpm::Overflow ovf, class T >
+T check(T const v, T const lo, T const hi) {
+    if constexpr (fpm::Ovf::assert == ovf) {
+        if (v < lo || v > hi) [[unlikely]] { trap(); }
+        return v;
+    }
+    else if constexpr (fpm::Ovf::clamp == ovf) {
+        return std::clamp(v, lo, hi);
+    }
+    else {
+        return v;
+    }
+}
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ---------------------------------------- Q <-> Sq -------------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+/// Benchmarks of the conversions for the given base type, scaling and overflow behavior.
+template< class BaseT, int f, fpm::Overflow ovf >
+struct QOps {
+    using q_t = fpm::q::Q<BaseT, f, -1., 1., ovf>;          // target type
+    using wide_q_t = fpm::q::Q<BaseT, f, -2., 2., ovf>;     // source type with larger range
+    using coarse_q_t = fpm::q::Q<BaseT, f-2, -2., 2., ovf>; // source type with lower resolution
+
+    static std::string name(char const *op, char const *impl) {
+        return std::string(op) + "_" + ovfName(ovf) + "/" + bench::baseName<BaseT>() + "q"
+            + std::to_string(f) + "/" + impl;
+    }
+
+    static void registerAll() {
+        auto const v = bench::qs<wide_q_t>(inV);
+        auto const vCoarse = bench::qs<coarse_q_t>(inV);
+        auto const s = bench::scaled<BaseT, f>(inV);
+        auto const sCoarse = bench::scaled<BaseT, f-2>(inV);
+        constexpr BaseT lo = -(BaseT(1) << f), hi = BaseT(1) << f;
+
+        bench::add(name("construct", "q"), [](BaseT x) { return q_t::construct(x).scaled(); }, s);
+        bench::add(name("fromSq", "q"), [](wide_q_t x) { return q_t::fromSq(+x).scaled(); }, v);
+        bench::add(name("fromSq_rescale", "q"), [](coarse_q_t x) { return q_t::fromSq(+x).scaled(); }, vCoarse);
+        bench::add(name("toSq", "q"), [](wide_q_t x) { return x.template toSq<-1., 1.>().scaled(); }, v);
+
+        bench::add(name("construct", "int"), [](BaseT x) { return check<ovf>(x, lo, hi); }, s);
+        bench::add(name("fromSq", "int"), [](BaseT x) { return check<ovf>(x, lo, hi); }, s);
+        bench::add(name("fromSq_rescale", "int"), [](BaseT x) { return check<ovf>(BaseT(x << 2), lo, hi); }, sCoarse);
+        bench::add(name("toSq", "int"), [](BaseT x) { return check<ovf>(x, lo, hi); }, s);
+    }
+};
+
+/// Equivalent range checks with a floating-point type. There is no scaling, so the conversions
+/// are all the same and measured once per overflow behavior.
+template< class T, fpm::Overflow ovf >
+struct FloatOps {
+    static void registerAll() {
+        std::string const name = "convert_" + ovfName(ovf) + "/" + (std::is_same_v<T, float> ? "float" : "double");
+        bench::add(name, [](T x) { return check<ovf>(x, T(-1), T(1)); }, bench::as<T>(inV));
+    }
+};
+
+/// Conversion of Sq to Q without any runtime check, because the range of the Sq type is within
+/// the range of the Q type.
+template< class BaseT, int f >
+void registerImplicit() {
+    using q_t = fpm::q::Q<BaseT, f, -2., 2.>;
+    using narrow_q_t = fpm::q::Q<BaseT, f, -1., 1., fpm::Ovf::unchecked>;
+    std::string const type = bench::baseName<BaseT>() + "q" + std::to_string(f);
+    bench::add("fromSq_implicit/" + type + "/q", [](narrow_q_t x) { return q_t(+x).scaled(); },
+               bench::qs<narrow_q_t>(inV));
+}
+
+template< fpm::Overflow ovf >
+void registerOvf() {
+    QOps<int8_t, 4, ovf>::registerAll();
+    QOps<int16_t, 8, ovf>::registerAll();
+    QOps<int16_t, 12, ovf>::registerAll();
+    QOps<int32_t, 16, ovf>::registerAll();
+    QOps<int32_t, 24, ovf>::registerAll();
+    FloatOps<float, ovf>::registerAll();
+    FloatOps<double, ovf>::registerAll();
+}
+
+
+[[maybe_unused]] int const registered = [] {
+    // Ovf::error is a compile-time check only, all other behaviors are checked at runtime
+    registerOvf<fpm::Ovf::assert>();
+    registerOvf<fpm::Ovf::clamp>();
+    registerOvf<fpm::Ovf::unchecked>();
+    registerImplicit<int8_t, 4>();
+    registerImplicit<int16_t, 8>();
+    registerImplicit<int16_t, 12>();
+    registerImplicit<int32_t, 16>();
+    registerImplicit<int32_t, 24>();
+    return 0;
+}();
+
+}  // namespace
+
+// EOF
@@ -0,0 +1,266 @@
+/* \file
+ * Benchmarks of the operators and functions of sq.hpp, each next to equivalent float, double and
+ * raw integer implementations.
+ */
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using namespace fpm::types;
+
+
+namespace {
+
+// Real input ranges of the operations. They are the same for all types and implementations, so
+// the results of one operation can be compared directly.
+auto const inA = bench::reals(-2., 2., 1u);     // first operand
+auto const inB = bench::reals(1., 2., 2u);      // second operand, divisor outside of (-1, 1)
+auto const inC = bench::reals(-2., 2., 3u);     // third operand, angle vector component
+auto const inL = bench::reals(-2., -.5, 4u);    // lower clamp limit
+auto const inP = bench::reals(.5, 4., 5u);      // positive argument of roots and logarithms
+auto const inE = bench::reals(-2., 1., 6u);     // exponent
+auto const inW = bench::reals(-3., 3., 7u);     // angle
+auto const inT = bench::reals(-1., 1., 8u);     // angle of tan
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------------ Sq ------------------------------------------------ //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+/// Benchmarks of all Sq operations for the given base type and scaling. The inputs are stored as
+/// Q values and converted to Sq with the unary plus, which does not generate any code.
+template< class BaseT, int f >
+struct SqOps {
+    template< double lo, double hi >
+    using q_t = fpm::q::Q<BaseT, f, lo, hi, fpm::Ovf::unchecked>;
+    using a_t = q_t<-2., 2.>;
+    using b_t = q_t<1., 2.>;
+    using l_t = q_t<-2., -.5>;
+    using p_t = q_t<.5, 4.>;
+    using e_t = q_t<-2., 1.>;
+    using w_t = q_t<-3., 3.>;
+    using t_t = q_t<-1., 1.>;
+
+    static std::string name(char const *op) {
+        return std::string(op) + "/" + bench::baseName<BaseT>() + "q" + std::to_string(f) + "/sq";
+    }
+
+    static void registerAll() {
+        auto const a = bench::qs<a_t>(inA);
+        auto const b = bench::qs<b_t>(inB);
+        auto const c = bench::qs<a_t>(inC);
+        auto const l = bench::qs<l_t>(inL);
+        auto const p = bench::qs<p_t>(inP);
+        auto const e = bench::qs<e_t>(inE);
+        auto const w = bench::qs<w_t>(inW);
+        auto const t = bench::qs<t_t>(inT);
+
+        // arithmetics
+        bench::add(name("neg"), [](a_t x) { return (-+x).scaled(); }, a);
+        bench::add(name("add"), [](a_t x, b_t y) { return (+x + +y).scaled(); }, a, b);
+        bench::add(name("sub"), [](a_t x, b_t y) { return (+x - +y).scaled(); }, a, b);
+        bench::add(name("mul"), [](a_t x, b_t y) { return (+x * +y).scaled(); }, a, b);
+        bench::add(name("mul_ic"), [](a_t x) { return (+x * 3_ic).scaled(); }, a);
+        bench::add(name("div"), [](a_t x, b_t y) { return (+x / +y).scaled(); }, a, b);
+        bench::add(name("div_ic"), [](a_t x) { return (+x / 3_ic).scaled(); }, a);
+        bench::add(name("ic_div"), [](b_t y) { return (3_ic / +y).scaled(); }, b);
+        bench::add(name("mod"), [](a_t x, b_t y) { return (+x % +y).scaled(); }, a, b);
+        bench::add(name("fma"), [](a_t x, b_t y, a_t z) { return fma(+x, +y, +z).scaled(); }, a, b, c);
+        bench::add(name("shl"), [](a_t x) { return (+x << 1_ic).scaled(); }, a);
+        bench::add(name("shr"), [](a_t x) { return (+x >> 1_ic).scaled(); }, a);
+
+        // comparison and selection
+        bench::add(name("eq"), [](a_t x, a_t y) { return +x == +y; }, a, c);
+        bench::add(name("less"), [](a_t x, b_t y) { return +x < +y; }, a, b);
+        bench::add(name("min"), [](a_t x, a_t y) { return min(+x, +y).scaled(); }, a, c);
+        bench::add(name("max"), [](a_t x, a_t y) { return max(+x, +y).scaled(); }, a, c);
+        bench::add(name("abs"), [](a_t x) { return abs(+x).scaled(); }, a);
+        bench::add(name("clamp"), [](a_t x, l_t lo, b_t hi) { return clamp(+x, +lo, +hi).scaled(); }, a, l, b);
+        bench::add(name("clamp_ct"), [](a_t x) { return clamp<-1., 1.>(+x).scaled(); }, a);
+        bench::add(name("clampLower_ct"), [](a_t x) { return clampLower<-1.>(+x).scaled(); }, a);
+        bench::add(name("clampUpper_ct"), [](a_t x) { return clampUpper<1.>(+x).scaled(); }, a);
+
+        // powers, roots and polynomials
+        bench::add(name("sqr"), [](a_t x) { return sqr(+x).scaled(); }, a);
+        bench::add(name("cube"), [](a_t x) { return cube(+x).scaled(); }, a);
+        bench::add(name("pow3"), [](a_t x) { return pow(+x, 3_ic).scaled(); }, a);
+        bench::add(name("poly2"), [](a_t x) { return poly<.5, -1.25, .75>(+x).scaled(); }, a);
+        bench::add(name("sqrt"), [](p_t x) { return sqrt(+x).scaled(); }, p);
+        bench::add(name("rsqrt"), [](p_t x) { return rsqrt(+x).scaled(); }, p);
+        if constexpr (f <= 16) {  // scaling of cube roots is limited
+            bench::add(name("cbrt"), [](p_t x) { return cbrt(+x).scaled(); }, p);
+            bench::add(name("rcbrt"), [](p_t x) { return rcbrt(+x).scaled(); }, p);
+        }
+
+        // exponentials and logarithms
+        bench::add(name("log2"), [](p_t x) { return log2(+x).scaled(); }, p);
+        bench::add(name("log"), [](p_t x) { return log(+x).scaled(); }, p);
+        bench::add(name("exp2"), [](e_t x) { return exp2(+x).scaled(); }, e);
+        bench::add(name("exp"), [](e_t x) { return exp(+x).scaled(); }, e);
+
+        // trigonometry
+        bench::add(name("sin"), [](w_t x) { return sin(+x).scaled(); }, w);
+        bench::add(name("sin_lut"), [](w_t x) { return sin<fpm::TrigEngine::lut>(+x).scaled(); }, w);
+        bench::add(name("cos"), [](w_t x) { return cos(+x).scaled(); }, w);
+        bench::add(name("sincos"), [](w_t x) {
+            auto const [s, co] = sincos(+x);
+            return std::pair(s.scaled(), co.scaled());
+        }, w);
+        bench::add(name("tan"), [](t_t x) { return tan(+x).scaled(); }, t);
+        bench::add(name("atan2"), [](a_t y, a_t x) { return atan2(+y, +x).scaled(); }, a, c);
+        bench::add(name("polar"), [](a_t x, a_t y) {
+            auto const [magnitude, angle] = polar(+x, +y);
+            return std::pair(magnitude.scaled(), angle.scaled());
+        }, c, a);
+    }
+};
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// -------------------------------------- Float Baseline ---------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+/// Equivalent operations with a floating-point type.
+template< class T >
+struct FloatOps {
+    static std::string name(char const *op) {
+        return std::string(op) + "/" + (std::is_same_v<T, float> ? "float" : "double");
+    }
+
+    static void registerAll() {
+        auto const a = bench::as<T>(inA);
+        auto const b = bench::as<T>(inB);
+        auto const c = bench::as<T>(inC);
+        auto const l = bench::as<T>(inL);
+        auto const p = bench::as<T>(inP);
+        auto const e = bench::as<T>(inE);
+        auto const w = bench::as<T>(inW);
+        auto const t = bench::as<T>(inT);
+
+        bench::add(name("neg"), [](T x) { return -x; }, a);
+        bench::add(name("add"), [](T x, T y) { return x + y; }, a, b);
+        bench::add(name("sub"), [](T x, T y) { return x - y; }, a, b);
+        bench::add(name("mul"), [](T x, T y) { return x * y; }, a, b);
+        bench::add(name("mul_ic"), [](T x) { return x * T(3); }, a);
+        bench::add(name("div"), [](T x, T y) { return x / y; }, a, b);
+        bench::add(name("div_ic"), [](T x) { return x / T(3); }, a);
+        bench::add(name("ic_div"), [](T y) { return T(3) / y; }, b);
+        bench::add(name("mod"), [](T x, T y) { return std::fmod(x, y); }, a, b);
+        bench::add(name("fma"), [](T x, T y, T z) { return x * y + z; }, a, b, c);
+        bench::add(name("shl"), [](T x) { return x * T(2); }, a);
+        bench::add(name("shr"), [](T x) { return x * T(.5); }, a);
+
+        bench::add(name("eq"), [](T x, T y) { return x == y; }, a, c);
+        bench::add(name("less"), [](T x, T y) { return x < y; }, a, b);
+        bench::add(name("min"), [](T x, T y) { return std::min(x, y); }, a, c);
+        bench::add(name("max"), [](T x, T y) { return std::max(x, y); }, a, c);
+        bench::add(name("abs"), [](T x) { return std::abs(x); }, a);
+        bench::add(name("clamp"), [](T x, T lo, T hi) { return std::clamp(x, lo, hi); }, a, l, b);
+        bench::add(name("clamp_ct"), [](T x) { return std::clamp(x, T(-1), T(1)); }, a);
+        bench::add(name("clampLower_ct"), [](T x) { return std::max(x, T(-1)); }, a);
+        bench::add(name("clampUpper_ct"), [](T x) { return std::min(x, T(1)); }, a);
+
+        bench::add(name("sqr"), [](T x) { return x * x; }, a);
+        bench::add(name("cube"), [](T x) { return x * x * x; }, a);
+        bench::add(name("pow3"), [](T x) { return x * x * x; }, a);
+        bench::add(name("poly2"), [](T x) { return T(.5) + x * (T(-1.25) + x * T(.75)); }, a);
+        bench::add(name("sqrt"), [](T x) { return std::sqrt(x); }, p);
+        bench::add(name("rsqrt"), [](T x) { return T(1) / std::sqrt(x); }, p);
+        bench::add(name("cbrt"), [](T x) { return std::cbrt(x); }, p);
+        bench::add(name("rcbrt"), [](T x) { return T(1) / std::cbrt(x); }, p);
+
+        bench::add(name("log2"), [](T x) { return std::log2(x); }, p);
+        bench::add(name("log"), [](T x) { return std::log(x); }, p);
+        bench::add(name("exp2"), [](T x) { return std::exp2(x); }, e);
+        bench::add(name("exp"), [](T x) { return std::exp(x); }, e);
+
+        bench::add(name("sin"), [](T x) { return std::sin(x); }, w);
+        bench::add(name("cos"), [](T x) { return std::cos(x); }, w);
+        bench::add(name("sincos"), [](T x) { return std::pair(std::sin(x), std::cos(x)); }, w);
+        bench::add(name("tan"), [](T x) { return std::tan(x); }, t);
+        bench::add(name("atan2"), [](T y, T x) { return std::atan2(y, x); }, a, c);
+        bench::add(name("polar"), [](T x, T y) { return std::pair(std::hypot(x, y), std::atan2(y, x)); }, c, a);
+    }
+};
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------- Integer Baseline --------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+/// Equivalent operations on raw scaled integers, as they would be written by hand without the
+/// library: truncating shifts, no range tracking and no overflow checks. Roots, exponentials,
+/// logarithms and trigonometric functions have no hand-written integer counterpart, they are
+/// compared with the float and double baselines only.
+template< class BaseT, int f >
+struct IntOps {
+    using w_t = bench::wide_t<BaseT>;
+    static constexpr BaseT one = BaseT(1) << f;
+
+    static std::string name(char const *op) {
+        return std::string(op) + "/" + bench::baseName<BaseT>() + "q" + std::to_string(f) + "/int";
+    }
+
+    static void registerAll() {
+        auto const a = bench::scaled<BaseT, f>(inA);
+        auto const b = bench::scaled<BaseT, f>(inB);
+        auto const c = bench::scaled<BaseT, f>(inC);
+        auto const l = bench::scaled<BaseT, f>(inL);
+
+        bench::add(name("neg"), [](BaseT x) { return BaseT(-x); }, a);
+        bench::add(name("add"), [](BaseT x, BaseT y) { return BaseT(x + y); }, a, b);
+        bench::add(name("sub"), [](BaseT x, BaseT y) { return BaseT(x - y); }, a, b);
+        bench::add(name("mul"), [](BaseT x, BaseT y) { return BaseT( (w_t(x) * y) >> f ); }, a, b);
+        bench::add(name("mul_ic"), [](BaseT x) { return BaseT(x * 3); }, a);
+        bench::add(name("div"), [](BaseT x, BaseT y) { return BaseT( (w_t(x) << f) / y ); }, a, b);
+        bench::add(name("div_ic"), [](BaseT x) { return BaseT(x / 3); }, a);
+        bench::add(name("ic_div"), [](BaseT y) { return BaseT( (w_t(3) << 2*f) / y ); }, b);
+        bench::add(name("mod"), [](BaseT x, BaseT y) { return BaseT(x % y); }, a, b);
+        bench::add(name("fma"), [](BaseT x, BaseT y, BaseT z) { return BaseT( (w_t(x) * y + (w_t(z) << f)) >> f ); }, a, b, c);
+        bench::add(name("shl"), [](BaseT x) { return BaseT(x << 1); }, a);
+        bench::add(name("shr"), [](BaseT x) { return BaseT(x >> 1); }, a);
+
+        bench::add(name("eq"), [](BaseT x, BaseT y) { return x == y; }, a, c);
+        bench::add(name("less"), [](BaseT x, BaseT y) { return x < y; }, a, b);
+        bench::add(name("min"), [](BaseT x, BaseT y) { return std::min(x, y); }, a, c);
+        bench::add(name("max"), [](BaseT x, BaseT y) { return std::max(x, y); }, a, c);
+        bench::add(name("abs"), [](BaseT x) { return BaseT(x < 0 ? -x : x); }, a);
+        bench::add(name("clamp"), [](BaseT x, BaseT lo, BaseT hi) { return std::clamp(x, lo, hi); }, a, l, b);
+        bench::add(name("clamp_ct"), [](BaseT x) { return std::clamp(x, BaseT(-one), one); }, a);
+        bench::add(name("clampLower_ct"), [](BaseT x) { return std::max(x, BaseT(-one)); }, a);
+        bench::add(name("clampUpper_ct"), [](BaseT x) { return std::min(x, one); }, a);
+
+        bench::add(name("sqr"), [](BaseT x) { return w_t( (w_t(x) * x) >> f ); }, a);
+        bench::add(name("cube"), [](BaseT x) { return w_t( (((w_t(x) * x) >> f) * x) >> f ); }, a);
+        bench::add(name("pow3"), [](BaseT x) { return w_t( (((w_t(x) * x) >> f) * x) >> f ); }, a);
+        bench::add(name("poly2"), [](BaseT x) {
+            w_t r = w_t(.75 * one);
+            r = ((r * x) >> f) + w_t(-1.25 * one);
+            r = ((r * x) >> f) + w_t(.5 * one);
+            return BaseT(r);
+        }, a);
+    }
+};
+
+
+[[maybe_unused]] int const registered = [] {
+    SqOps<int8_t, 4>::registerAll();
+    SqOps<int16_t, 8>::registerAll();
+    SqOps<int16_t, 12>::registerAll();
+    SqOps<int32_t, 16>::registerAll();
+    SqOps<int32_t, 24>::registerAll();
+    FloatOps<float>::registerAll();
+    FloatOps<double>::registerAll();
+    IntOps<int8_t, 4>::registerAll();
+    IntOps<int16_t, 8>::registerAll();
+    IntOps<int16_t, 12>::registerAll();
+    IntOps<int32_t, 16>::registerAll();
+    IntOps<int32_t, 24>::registerAll();
+    return 0;
+}();
+
+}  // namespace
+
+// EOF
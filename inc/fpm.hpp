@@ -20,6 +20,12 @@
 #include "fpm/fpm.hpp"
 #include "fpm/sq.hpp"
 #include "fpm/q.hpp"
+#include "fpm/accumulator.hpp"
+#include "fpm/expr.hpp"
+#include "fpm/lut.hpp"
+#include "fpm/pwl.hpp"
+#include "fpm/reciprocal.hpp"
+#include "fpm/simd.hpp"
 
 // predefined types and literals
 #include "fpm/sq_types.hpp"
@@ -29,6 +35,13 @@
 namespace fpm {
 using q::Q;
 using sq::Sq;
+using sq::Reciprocal;
+using sq::Accumulator;
+using sq::Lut;
+using sq::Pwl;
+using sq::Knot;
+using sq::Expr;
+using sq::lazy;
 namespace types {
 using namespace fpm::q::types;
 using namespace fpm::sq::types;
@@ -0,0 +1,126 @@
+/** \file
+ * Declaration of the Accumulator type, which sums up products of Sq values in a wide register.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_ACCUMULATOR_HPP_0E6B7D42_93C1_4F5A_B8E0_71D2C6A43F95
+#define FPM_FPM_ACCUMULATOR_HPP_0E6B7D42_93C1_4F5A_B8E0_71D2C6A43F95
+
+#include "sq.hpp"
+
+
+namespace fpm::sq {
+/** \ingroup grp_fpmSq
+ * \{ */
+
+using fpm::detail::SqType;
+
+
+/// Accumulator for sums of up to N terms of type SqElem, e.g. the products of a dot product.
+/// The range of the sum is derived from N and the range of SqElem at compile-time. The terms are
+/// accumulated at double scaling (2*SqElem::f) in a wide register without rescaling, rounding or
+/// clamping. Products added via mac() are not rescaled at all. The sum is narrowed to a Sq value
+/// only when result() is called.
+/// \warning The range of the sum is only guaranteed if at most N terms are added (per reset).
+template< SqType SqElem, std::size_t N >
+requires ( N > 0u )
+class Accumulator final {
+public:
+    using elem_t = SqElem;                              ///< Sq type of a single term
+    static constexpr std::size_t capacity = N;          ///< maximum number of terms
+    static constexpr scaling_t f = SqElem::f;           ///< number of fraction bits of the result
+    /// Minimum and maximum real value of the sum of up to N terms (includes 0 for no terms).
+    static constexpr double realMin = std::min(0., static_cast<double>(N) * SqElem::realMin);
+    static constexpr double realMax = std::max(0., static_cast<double>(N) * SqElem::realMax);
+
+private:
+    static constexpr bool isSigned = std::is_signed_v<typename SqElem::base_t>;
+    /// Register type: the smallest type with at least 32 bits that can hold the sum at double scaling.
+    using acc_t =
+        std::conditional_t< fpm::detail::RealLimitsInRangeOfCalcType<fpm::detail::fit_type_t<4u, isSigned>, 2*f, realMin, realMax>,
+            fpm::detail::fit_type_t<4u, isSigned>,
+        std::conditional_t< fpm::detail::RealLimitsInRangeOfCalcType<fpm::detail::fit_type_t<8u, isSigned>, 2*f, realMin, realMax>,
+            fpm::detail::fit_type_t<8u, isSigned>,
+            std::conditional_t<isSigned, fpm::detail::widest_int_t, fpm::detail::widest_uint_t> > >;
+    static_assert(fpm::detail::RealLimitsInRangeOfCalcType<acc_t, 2*f, realMin, realMax>,
+        "Range of the sum exceeds the widest register type at double scaling; reduce N, the range or the scaling of SqElem");
+
+    /// Implements the conversion of the sum to the result type.
+    struct Result {
+        static constexpr scaling_t f = Accumulator::f;
+        static constexpr double realMin = fpm::detail::roundedMin(Accumulator::realMin, f, SqElem::rounding);
+        static constexpr double realMax = fpm::detail::roundedMax(Accumulator::realMax, f, SqElem::rounding);
+        using base_t = fpm::detail::common_q_base_t<typename SqElem::base_t, typename SqElem::base_t, f, realMin, realMax>;
+        static constexpr bool innerConstraints = true;
+        static constexpr base_t value(acc_t sum) noexcept { return s2s<2*f, f, base_t, SqElem::rounding>(sum); }
+    };
+
+    /// Concept: The given Sq type is a valid term, i.e. its range is within the range of SqElem and
+    /// its scaling is not larger.
+    template< typename SqTerm >
+    static constexpr bool isValidTerm = ( SqType<SqTerm>
+        && SqElem::realMin <= SqTerm::realMin && SqTerm::realMax <= SqElem::realMax && SqTerm::f <= f );
+
+public:
+    /// Creates an empty accumulator.
+    constexpr
+    Accumulator() noexcept : sum(0) {}
+
+    /// Adds the product of the given Sq values (sum += a * b). The product is calculated in the
+    /// register type at double scaling, without rescaling or rounding.
+    /// \note The product type a * b must be a valid term, i.e. it must be within the range of SqElem
+    /// and must not have a larger scaling.
+    template< /* deduced: */ SqType SqA, SqType SqB >
+    requires ( isValidTerm< decltype(std::declval<SqA const &>() * std::declval<SqB const &>()) > )
+    constexpr
+    Accumulator& mac(SqA const &a, SqB const &b) noexcept {
+        // a*b <=> (a * 2^fp) * (b * 2^fp) = a*b * 2^(2fp); scaled to 2f if the product scaling fp < f
+        constexpr scaling_t fp = std::max(SqA::f, SqB::f);
+        sum += s2s<2*fp, 2*f, acc_t>( s2s<SqA::f, fp, acc_t>(a.value) * s2s<SqB::f, fp, acc_t>(b.value) );
+        return *this;
+    }
+
+    /// Adds the given Sq value (sum += term).
+    /// \note The term must be within the range of SqElem and must not have a larger scaling.
+    template< /* deduced: */ SqType SqTerm >
+    requires ( isValidTerm<SqTerm> )
+    constexpr
+    Accumulator& operator +=(SqTerm const &term) noexcept {
+        sum += s2s<SqTerm::f, 2*f, acc_t>(term.value);
+        return *this;
+    }
+
+    /// Resets the accumulator to 0.
+    constexpr
+    void reset() noexcept { sum = 0; }
+
+    /// Narrows the accumulated sum to a Sq value. The sum is rescaled once, rounded with the rounding
+    /// mode of SqElem.
+    /// \returns the sum, wrapped into a Sq type with the scaling of SqElem and a value range of
+    /// N times the range of SqElem.
+    constexpr
+    auto result() const noexcept requires fpm::detail::ValidImplType<Result> {
+        return Sq< typename Result::base_t, Result::f, Result::realMin, Result::realMax, SqElem::rounding >( Result::value(sum) );
+    }
+
+private:
+    acc_t sum;  ///< accumulated sum at double scaling
+};
+
+/**\}*/
+}  // namespace fpm::sq
+
+
+#endif
+// EOF
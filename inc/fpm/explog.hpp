@@ -0,0 +1,198 @@
+/** \file
+ * Integer kernels of the exponential and logarithm functions of the Sq type.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_EXPLOG_HPP_9B3E1F74_2C6D_4E8A_B05F_D71A4C2E6B83
+#define FPM_FPM_EXPLOG_HPP_9B3E1F74_2C6D_4E8A_B05F_D71A4C2E6B83
+
+#include "fpm.hpp"
+#include <array>
+
+
+namespace fpm::detail {
+
+/// Scaling of the intermediate results of the exponential and logarithm kernels.
+static constexpr scaling_t EXPLOG_F = 30;
+
+/// Number of bits of the index of the mantissa tables; the tables have 2^bits segments.
+static constexpr int EXPLOG_LUT_BITS = 8;
+
+/// ln(2) with the precision of double.
+static constexpr double LN2 = 0.693147180559945309417;
+
+/// log2(e) with the precision of double.
+static constexpr double LOG2E = 1.442695040888963407360;
+
+inline namespace lib {
+
+    /** \returns the approximated value of 2^k * exp(r) for a small r, calculated with a Taylor
+     * series. */
+    consteval
+    double expReduced(double r, int64_t k) noexcept {
+        double term = 1., sum = 1.;
+        for (int n = 1; n < 25; ++n) {
+            term *= r / n;
+            sum += term;
+        }
+        for (int64_t i = 0; i < k; ++i) { sum *= 2.; }
+        for (int64_t i = 0; i > k; --i) { sum /= 2.; }
+        return sum;
+    }
+
+    /** \returns the approximated 2-based exponential of the given number. The number is reduced
+     * to k + r with an integer k and |r| <= 1/2. Exact for integers. */
+    consteval
+    double exp2(double x) noexcept {
+        auto const k = static_cast<int64_t>( x + (x < 0. ? -0.5 : 0.5) );
+        return detail::expReduced( (x - static_cast<double>(k)) * LN2, k );
+    }
+
+    /** \returns the approximated natural exponential of the given number. The number is reduced
+     * to k*ln(2) + r with an integer k and |r| <= ln(2)/2. */
+    consteval
+    double exp(double x) noexcept {
+        auto const k = static_cast<int64_t>( x * LOG2E + (x < 0. ? -0.5 : 0.5) );
+        return detail::expReduced( x - static_cast<double>(k) * LN2, k );
+    }
+
+    /** \returns the approximated 2-based logarithm of the given positive number. The number is
+     * reduced to m * 2^e with m in [1, 2), and log(m) = 2*atanh((m-1)/(m+1)) is calculated with a
+     * series. Exact for powers of 2. */
+    consteval
+    double log2(double x) noexcept {
+        int e = 0;
+        while (x >= 2.) { x /= 2.; ++e; }
+        while (x < 1.) { x *= 2.; --e; }
+        double const t = (x - 1.) / (x + 1.);
+        double term = t, sum = t;
+        for (int n = 1; n < 30; ++n) {
+            term *= t*t;
+            sum += term / (2.*n + 1.);
+        }
+        return static_cast<double>(e) + 2.*sum * LOG2E;
+    }
+
+    /** \returns the approximated natural logarithm of the given positive number. */
+    consteval
+    double log(double x) noexcept { return detail::log2(x) * LN2; }
+}
+
+/// Table with log2(1 + i / 2^EXPLOG_LUT_BITS) * 2^EXPLOG_F. The last entry is repeated to allow the
+/// interpolation at the end of the table without a branch.
+inline constexpr auto log2Lut = []() consteval {
+    constexpr std::size_t SEGMENTS = std::size_t(1) << EXPLOG_LUT_BITS;
+    std::array<int32_t, SEGMENTS + 2u> table{};
+    for (std::size_t i = 0u; i <= SEGMENTS; ++i) {
+        double const l = detail::log2( 1. + static_cast<double>(i) / static_cast<double>(SEGMENTS) );
+        table[i] = static_cast<int32_t>( l * static_cast<double>(int32_t(1) << EXPLOG_F) + 0.5 );
+    }
+    table[SEGMENTS + 1u] = table[SEGMENTS];
+    return table;
+}();
+
+/// Table with 2^(i / 2^EXPLOG_LUT_BITS) * 2^EXPLOG_F. The last entry is repeated to allow the
+/// interpolation at the end of the table without a branch.
+inline constexpr auto exp2Lut = []() consteval {
+    constexpr std::size_t SEGMENTS = std::size_t(1) << EXPLOG_LUT_BITS;
+    std::array<uint32_t, SEGMENTS + 2u> table{};
+    for (std::size_t i = 0u; i <= SEGMENTS; ++i) {
+        double const e = detail::exp2( static_cast<double>(i) / static_cast<double>(SEGMENTS) );
+        table[i] = static_cast<uint32_t>( e * static_cast<double>(int32_t(1) << EXPLOG_F) + 0.5 );
+    }
+    table[SEGMENTS + 1u] = table[SEGMENTS];
+    return table;
+}();
+
+/** \returns the value of the given table at the given fraction in [0, 2^EXPLOG_F), linearly
+ * interpolated between two entries. */
+template< /* deduced: */ std::integral T, std::size_t size >
+constexpr
+int64_t interpolateExpLog(std::array<T, size> const &table, uint32_t const fraction) noexcept {
+    constexpr int FRAC_BITS = EXPLOG_F - EXPLOG_LUT_BITS;
+    uint32_t const index = fraction >> FRAC_BITS;
+    auto const frac = static_cast<int64_t>( fraction & ((uint32_t(1) << FRAC_BITS) - 1u) );
+    auto const lo = static_cast<int64_t>(table[index]), hi = static_cast<int64_t>(table[index + 1u]);
+    return lo + (((hi - lo) * frac) >> FRAC_BITS);
+}
+
+/** Calculates the 2-based logarithm of the given positive integer.
+ * The integer is normalized with countl_zero to 2^e * m, with m in [1, 2); log2(m) is interpolated
+ * linearly between two entries of a table.
+ * \returns log2(value), scaled by 2^EXPLOG_F.
+ * \note The error of the interpolation is at most (2^-EXPLOG_LUT_BITS)^2 / (8*ln(2)), which is
+ * approximately 2^-18.5 for 256 segments. */
+constexpr
+int64_t ilog2(uint64_t const value) noexcept {
+    int const e = 63 - std::countl_zero(value);
+    // fraction of the mantissa, i.e. the bits below the leading 1, scaled to 2^EXPLOG_F
+    auto const fraction = static_cast<uint32_t>( ((value << (63 - e)) >> (63 - EXPLOG_F)) & ((uint64_t(1) << EXPLOG_F) - 1u) );
+    return (static_cast<int64_t>(e) << EXPLOG_F) + interpolateExpLog(log2Lut, fraction);
+}
+
+/** Calculates 2 to the power of the given value, which is scaled by 2^EXPLOG_F.
+ * The value is split into an integral part n and a fraction; 2^fraction is interpolated linearly
+ * between two entries of a table and shifted by n.
+ * \returns 2^value, scaled by 2^to, rounded to nearest. Values below the resolution are 0.
+ * \note The relative error of the interpolation is at most (2^-EXPLOG_LUT_BITS)^2 * ln(2)^2 / 8,
+ * which is approximately 2^-20 for 256 segments; with the truncations of the kernel it is
+ * about 2^-19.5.
+ * \warning The result must fit into 63 bits; this is not checked. */
+template< scaling_t to >
+constexpr
+uint64_t iexp2(int64_t const value) noexcept {
+    int64_t const n = value >> EXPLOG_F;  // rounded towards negative infinity
+    auto const fraction = static_cast<uint32_t>( value & ((int64_t(1) << EXPLOG_F) - 1) );
+    auto const mantissa = static_cast<uint64_t>( interpolateExpLog(exp2Lut, fraction) );  // [2^30, 2^31]
+    int64_t const shift = n + to - EXPLOG_F;
+    if (shift >= 0) { return mantissa << shift; }
+    else if (shift > -63) { return (mantissa + (uint64_t(1) << (-shift - 1))) >> -shift; }
+    else { return 0u; }
+}
+
+/** \returns the given value, which is scaled by 2^EXPLOG_F, rescaled to 2^f and rounded to nearest. */
+template< scaling_t f >
+constexpr
+int64_t fromExpLogScaling(int64_t const value) noexcept {
+    if constexpr (f < EXPLOG_F) {
+        return (value + (int64_t(1) << (EXPLOG_F - f - 1))) >> (EXPLOG_F - f);
+    }
+    else { return value; }
+}
+
+/** Concept: Checks whether the given (S)Q type can be passed to the log and log2 functions. This
+ * is possible as long as the size of the base type does not exceed 4 bytes, the scaling is not
+ * negative and not larger than the scaling of the kernels, and the minimum value is equal to or
+ * larger than the resolution. */
+template< typename T >
+concept CanBePassedToLog = (
+    sizeof(typename T::base_t) <= sizeof(int32_t)
+    && 0 <= T::f && T::f <= EXPLOG_F
+    && T::realMin >= T::resolution
+);
+
+/** Concept: Checks whether the given (S)Q type can be passed to the exp and exp2 functions. This
+ * is possible as long as the size of the base type does not exceed 4 bytes and the scaling is not
+ * negative and not larger than the scaling of the kernels. */
+template< typename T >
+concept CanBePassedToExp = (
+    sizeof(typename T::base_t) <= sizeof(int32_t)
+    && 0 <= T::f && T::f <= EXPLOG_F
+);
+
+}  // namespace fpm::detail
+
+
+#endif
+// EOF
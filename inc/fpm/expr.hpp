@@ -0,0 +1,444 @@
+/** \file
+ * Declaration of the Expr type, a lazy expression of Sq values that is evaluated with a single
+ * final rescaling.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_EXPR_HPP_6C2E9A14_B83D_4F57_9A1E_0D4B7C3F5E28
+#define FPM_FPM_EXPR_HPP_6C2E9A14_B83D_4F57_9A1E_0D4B7C3F5E28
+
+#include "q.hpp"
+
+
+namespace fpm::detail {
+
+/// Number of value bits of the widest intermediate type of a lazy expression.
+constexpr int EXPR_DIGITS = static_cast<int>(sizeof(widest_int_t) * CHAR_BIT) - 1;
+
+/** \returns the number of bits of the largest magnitude of the given real value range, scaled
+ * by 2^f. */
+consteval
+int exprMagnitudeBits(double realMin, double realMax, scaling_t f) noexcept {
+    double scaled = std::max(abs(realMin), abs(realMax)) * dpowi(2., f);
+    int bits = 0;
+    while (scaled >= 1.) { scaled /= 2.; ++bits; }
+    return bits;
+}
+
+/** \returns the largest scaling up to the given scaling f for which the given real value range
+ * fits into the widest intermediate type with one bit of headroom. */
+consteval
+scaling_t exprScaling(scaling_t f, double realMin, double realMax) noexcept {
+    while (exprMagnitudeBits(realMin, realMax, f) >= EXPR_DIGITS) { --f; }
+    return f;
+}
+
+/** \returns the scaling of the lhs operand of a product with the given operand scalings, such that
+ * the sum of both scalings does not exceed the scaling f of the product. The larger scaling is
+ * reduced first. */
+consteval
+scaling_t exprSplitScaling(scaling_t fLhs, scaling_t fRhs, scaling_t f) noexcept {
+    while (fLhs + fRhs > f) {
+        if (fLhs >= fRhs) { --fLhs; }
+        else { --fRhs; }
+    }
+    return fLhs;
+}
+
+// Nodes of a lazy expression. Each node provides:
+//  - f: the scaling of its intermediate value, which is the exact scaling of the operation unless
+//       the value would not fit into the widest intermediate type,
+//  - realMin, realMax: the real value range from the interval analysis,
+//  - bits: the largest number of magnitude bits of all intermediate values of the subtree,
+//  - fLeaf, leaf_base_t: the largest scaling and the common base type of the Sq values of the subtree,
+//  - rounding: the rounding mode of the leftmost Sq value of the subtree, like for Sq operators,
+//  - value<CalcT>(): the intermediate value, calculated in the given calculation type.
+
+/// Leaf of a lazy expression; holds an Sq value.
+template< SqType SqT >
+struct ExprLeaf {
+    using leaf_base_t = typename SqT::base_t;
+    static constexpr scaling_t fLeaf = SqT::f;
+    static constexpr Rounding rounding = SqT::rounding;
+    static constexpr scaling_t f = SqT::f;
+    static constexpr double realMin = SqT::realMin;
+    static constexpr double realMax = SqT::realMax;
+    static constexpr int bits = exprMagnitudeBits(realMin, realMax, f);
+
+    SqT sq;
+
+    template< Integral CalcT >
+    constexpr CalcT value() const noexcept { return static_cast<CalcT>( sq.scaled() ); }
+};
+
+/// Sum of two nodes; the operands are aligned to the larger scaling without loss of precision.
+template< class L, class R >
+struct ExprAdd {
+    using leaf_base_t = common_base_t<typename L::leaf_base_t, typename R::leaf_base_t>;
+    static constexpr scaling_t fLeaf = std::max(L::fLeaf, R::fLeaf);
+    static constexpr Rounding rounding = L::rounding;
+    static constexpr double realMin = L::realMin + R::realMin;
+    static constexpr double realMax = L::realMax + R::realMax;
+    static constexpr scaling_t f = exprScaling(std::max(L::f, R::f), realMin, realMax);
+    static constexpr int bits = std::max({ L::bits, R::bits, exprMagnitudeBits(realMin, realMax, f) });
+
+    L lhs;
+    R rhs;
+
+    template< Integral CalcT >
+    constexpr CalcT value() const noexcept {
+        return s2s<L::f, f, CalcT, rounding>( lhs.template value<CalcT>() ) + s2s<R::f, f, CalcT, rounding>( rhs.template value<CalcT>() );
+    }
+};
+
+/// Difference of two nodes; the operands are aligned to the larger scaling without loss of precision.
+template< class L, class R >
+struct ExprSub {
+    using leaf_base_t = common_base_t<typename L::leaf_base_t, typename R::leaf_base_t>;
+    static constexpr scaling_t fLeaf = std::max(L::fLeaf, R::fLeaf);
+    static constexpr Rounding rounding = L::rounding;
+    static constexpr double realMin = L::realMin - R::realMax;
+    static constexpr double realMax = L::realMax - R::realMin;
+    static constexpr scaling_t f = exprScaling(std::max(L::f, R::f), realMin, realMax);
+    static constexpr int bits = std::max({ L::bits, R::bits, exprMagnitudeBits(realMin, realMax, f) });
+
+    L lhs;
+    R rhs;
+
+    template< Integral CalcT >
+    constexpr CalcT value() const noexcept {
+        return s2s<L::f, f, CalcT, rounding>( lhs.template value<CalcT>() ) - s2s<R::f, f, CalcT, rounding>( rhs.template value<CalcT>() );
+    }
+};
+
+/// Product of two nodes; the product is kept at the sum of the scalings of the operands.
+template< class L, class R >
+struct ExprMult {
+    using leaf_base_t = common_base_t<typename L::leaf_base_t, typename R::leaf_base_t>;
+    static constexpr scaling_t fLeaf = std::max(L::fLeaf, R::fLeaf);
+    static constexpr Rounding rounding = L::rounding;
+    static constexpr double realMin = std::min({ L::realMin * R::realMin, L::realMin * R::realMax,
+                                                 L::realMax * R::realMin, L::realMax * R::realMax });
+    static constexpr double realMax = std::max({ L::realMin * R::realMin, L::realMin * R::realMax,
+                                                 L::realMax * R::realMin, L::realMax * R::realMax });
+    static constexpr scaling_t f = exprScaling(L::f + R::f, realMin, realMax);
+    static constexpr scaling_t fLhs = exprSplitScaling(L::f, R::f, f);  ///< scaling of the lhs operand
+    static constexpr scaling_t fRhs = f - fLhs;                         ///< scaling of the rhs operand
+    static constexpr int bits = std::max({ L::bits, R::bits, exprMagnitudeBits(realMin, realMax, f) });
+
+    L lhs;
+    R rhs;
+
+    template< Integral CalcT >
+    constexpr CalcT value() const noexcept {
+        // a*b <=> (a * 2^fLhs) * (b * 2^fRhs) = a*b * 2^f
+        return s2s<L::f, fLhs, CalcT, rounding>( lhs.template value<CalcT>() ) * s2s<R::f, fRhs, CalcT, rounding>( rhs.template value<CalcT>() );
+    }
+};
+
+/// Negation of a node.
+template< class E >
+struct ExprNeg {
+    using leaf_base_t = typename E::leaf_base_t;
+    static constexpr scaling_t fLeaf = E::fLeaf;
+    static constexpr Rounding rounding = E::rounding;
+    static constexpr double realMin = -E::realMax;
+    static constexpr double realMax = -E::realMin;
+    static constexpr scaling_t f = E::f;
+    static constexpr int bits = E::bits;
+
+    E operand;
+
+    template< Integral CalcT >
+    constexpr CalcT value() const noexcept { return -operand.template value<CalcT>(); }
+};
+
+/// Product of a node and an integral constant.
+template< class E, std::integral T, T ic >
+struct ExprMultIc {
+    using leaf_base_t = typename E::leaf_base_t;
+    static constexpr scaling_t fLeaf = E::fLeaf;
+    static constexpr Rounding rounding = E::rounding;
+    static constexpr double realMin = std::min(E::realMin * static_cast<double>(ic), E::realMax * static_cast<double>(ic));
+    static constexpr double realMax = std::max(E::realMin * static_cast<double>(ic), E::realMax * static_cast<double>(ic));
+    static constexpr scaling_t f = exprScaling(E::f, realMin, realMax);
+    static constexpr int bits = std::max(E::bits, exprMagnitudeBits(realMin, realMax, f));
+
+    E operand;
+
+    template< Integral CalcT >
+    constexpr CalcT value() const noexcept {
+        return s2s<E::f, f, CalcT, rounding>( operand.template value<CalcT>() ) * static_cast<CalcT>(ic);
+    }
+};
+
+/// Quotient of a node and a non-zero integral constant. A division by a power of 2 only increases
+/// the scaling, which is exact. Otherwise the dividend is up-scaled by as many bits as the divisor
+/// has before it is divided, so that the rounding of the quotient (with the rounding mode of the
+/// expression) is below the resolution of the operand.
+template< class E, std::integral T, T ic >
+struct ExprDivIc {
+private:
+    static constexpr double exactMin = std::min(E::realMin / static_cast<double>(ic), E::realMax / static_cast<double>(ic));
+    static constexpr double exactMax = std::max(E::realMin / static_cast<double>(ic), E::realMax / static_cast<double>(ic));
+
+public:
+    using leaf_base_t = typename E::leaf_base_t;
+    static constexpr uint64_t divisor = std::cmp_less(ic, 0) ? uint64_t(0) - static_cast<uint64_t>(ic) : static_cast<uint64_t>(ic);
+    static constexpr bool isPowerOf2 = std::has_single_bit(divisor);
+    static constexpr scaling_t k = isPowerOf2 ? std::countr_zero(divisor) : static_cast<int>(std::bit_width(divisor));
+    static constexpr scaling_t fLeaf = E::fLeaf;
+    static constexpr Rounding rounding = E::rounding;
+    static constexpr scaling_t f = exprScaling(E::f + k, E::realMin, E::realMax);  // |dividend| >= |quotient|
+    static constexpr double realMin = isPowerOf2 ? exactMin : roundedMin(exactMin, f, rounding);
+    static constexpr double realMax = isPowerOf2 ? exactMax : roundedMax(exactMax, f, rounding);
+    static constexpr int bits = std::max(E::bits, exprMagnitudeBits(E::realMin, E::realMax, f));
+
+    E operand;
+
+    template< Integral CalcT >
+    constexpr CalcT value() const noexcept {
+        if constexpr (isPowerOf2) {
+            // a / 2^k <=> (a * 2^(f-k)) interpreted with scaling f
+            CalcT const v = s2s<E::f, f - k, CalcT, rounding>( operand.template value<CalcT>() );
+            return std::cmp_less(ic, 0) ? -v : v;
+        }
+        else {
+            return divr<rounding>( s2s<E::f, f, CalcT, rounding>( operand.template value<CalcT>() ), static_cast<CalcT>(ic) );
+        }
+    }
+};
+
+}  // namespace fpm::detail
+
+
+namespace fpm::sq {
+/** \ingroup grp_fpmSq
+ * \{ */
+
+using fpm::detail::SqType;
+using fpm::detail::QType;
+using fpm::detail::ExprType;
+
+
+/// Lazy expression of Sq values, created with fpm::lazy() and the arithmetic operators.
+/// The operators do not calculate anything; they build an expression tree type, which is
+/// evaluated when the expression is assigned to an Sq or Q type, or with eval(). The value range
+/// of the expression is calculated at compile-time with interval analysis of the whole tree.
+/// Products are kept at the sum of the scalings of their operands, and sums are aligned to the
+/// larger scaling, thus the intermediate values are exact in most cases and the result is rescaled
+/// only once.
+/// The calculation type is the smallest type out of int32_t, int64_t and the widest supported
+/// integer that can hold all intermediate values.
+/// \note If an intermediate value would not fit into the widest integer at its exact scaling, the
+/// scaling of that node is reduced, which introduces a truncation within the expression.
+template< class Node >
+class Expr final {
+public:
+    static constexpr bool isExprType = true;             ///< identifier for the ExprType concept
+    using node_t = Node;                                 ///< root node of the expression tree
+    static constexpr scaling_t f = Node::f;              ///< scaling of the intermediate result
+    static constexpr double realMin = Node::realMin;     ///< minimum real value
+    static constexpr double realMax = Node::realMax;     ///< maximum real value
+    static constexpr int bits = Node::bits;              ///< magnitude bits of the largest intermediate value
+
+    /// Calculation type of all intermediate values.
+    using calc_t =
+        std::conditional_t< (bits < 31), int32_t,
+        std::conditional_t< (bits < 63), int64_t, fpm::detail::widest_int_t > >;
+
+    /// Wraps the given root node.
+    explicit constexpr
+    Expr(Node const &node) noexcept : node(node) {}
+
+private:
+    /// Minimum and maximum of the expression after the final rescaling to the scaling fTo with the
+    /// rounding mode rnd; only a down-scaling is rounded.
+    template< scaling_t fTo, Rounding rnd >
+    static constexpr double evalMin = (f > fTo) ? fpm::detail::roundedMin(realMin, fTo, rnd) : realMin;
+    template< scaling_t fTo, Rounding rnd >
+    static constexpr double evalMax = (f > fTo) ? fpm::detail::roundedMax(realMax, fTo, rnd) : realMax;
+
+    /// Implements the evaluation of the expression into the Sq type SqTo.
+    template< SqType SqTo >
+    struct EvalTo {
+        using base_t = typename SqTo::base_t;
+        static constexpr scaling_t f = SqTo::f;
+        static constexpr double realMin = SqTo::realMin;
+        static constexpr double realMax = SqTo::realMax;
+        using scale_t = fpm::detail::fit_type_t<std::max(sizeof(calc_t), sizeof(base_t)), true>;
+        static constexpr bool innerConstraints = (
+            bits < fpm::detail::EXPR_DIGITS
+            && realMin <= evalMin<f, SqTo::rounding> && evalMax<f, SqTo::rounding> <= realMax
+            && fpm::detail::RealLimitsInRangeOfCalcType<scale_t, std::max(f, Expr::f), Expr::realMin, Expr::realMax> );
+        static constexpr base_t value(Node const &node) noexcept {
+            return s2s<Expr::f, f, base_t, SqTo::rounding>( static_cast<scale_t>( node.template value<calc_t>() ) );  // rescale once
+        }
+    };
+
+    /// Implements the evaluation of the expression into an Sq type with the largest scaling of the
+    /// Sq values in the expression and the value range of the expression.
+    template< typename _ = void >
+    struct Eval {
+        static constexpr scaling_t f = Node::fLeaf;
+        static constexpr double realMin = evalMin<f, Node::rounding>;
+        static constexpr double realMax = evalMax<f, Node::rounding>;
+        using leaf_base_t = std::conditional_t< (realMin < 0.), std::make_signed_t<typename Node::leaf_base_t>, typename Node::leaf_base_t >;
+        using base_t = fpm::detail::common_q_base_t<leaf_base_t, leaf_base_t, f, realMin, realMax>;
+        using sq_t = Sq<base_t, f, realMin, realMax, Node::rounding>;
+        static constexpr bool innerConstraints = true;
+    };
+
+    /// Sq type with the base type, scaling and rounding mode of the Q type QTo and the value range
+    /// of the expression, into which the expression is evaluated before it is converted to QTo.
+    template< QType QTo >
+    using sq_of_q_t = Sq<typename QTo::base_t, QTo::f, evalMin<QTo::f, QTo::rounding>, evalMax<QTo::f, QTo::rounding>, QTo::rounding>;
+
+public:
+    /// Evaluates the expression and rescales the result once to the target type.
+    /// \note Only possible if the value range of the expression is within the value range of the
+    /// target type. The result is rounded with the rounding mode of the target type.
+    template< /* deduced: */ SqType SqTo >
+    requires fpm::detail::ValidImplType< EvalTo<SqTo> >
+    constexpr
+    operator SqTo() const noexcept { return SqTo( EvalTo<SqTo>::value(node) ); }
+
+    /// Evaluates the expression, rescales the result once to the Q type QTo and converts it with
+    /// QTo::fromSq(), thus the overflow behavior of QTo is applied if the value range of the
+    /// expression is not within the value range of QTo.
+    /// \note Only possible if the value range of the expression can be represented with the base
+    /// type and scaling of the target type, and if the overflow behavior of the target type allows
+    /// the conversion (e.g. not with Ovf::error if an overflow check is needed).
+    template< /* deduced: */ QType QTo >
+    requires ( fpm::detail::SqRequirements<typename QTo::base_t, QTo::f, evalMin<QTo::f, QTo::rounding>, evalMax<QTo::f, QTo::rounding>>
+               && fpm::detail::ValidImplType< EvalTo< sq_of_q_t<QTo> > >
+               && requires(sq_of_q_t<QTo> const &sq) { { QTo::fromSq(sq) } -> std::same_as<QTo>; } )
+    constexpr
+    operator QTo() const noexcept {
+        using sq_t = sq_of_q_t<QTo>;
+        return QTo::fromSq( sq_t( EvalTo<sq_t>::value(node) ) );
+    }
+
+    /// Evaluates the expression.
+    /// \returns the value, wrapped into a new Sq type with the largest scaling of the Sq values in
+    /// the expression and the value range of the expression.
+    constexpr
+    auto eval() const noexcept
+    requires fpm::detail::ValidImplType< Eval<> > {
+        using sq_t = typename Eval<>::sq_t;
+        return sq_t( EvalTo<sq_t>::value(node) );
+    }
+
+    /// root node of the expression tree
+    Node const node;
+};
+
+
+/// \returns the node of the given operand of a lazy expression; Sq and Q values become leaves.
+template< typename T >
+requires ( ExprType<T> || SqType<T> || QType<T> )
+constexpr
+auto exprNodeOf(T const &operand) noexcept {
+    if constexpr (ExprType<T>) { return operand.node; }
+    else if constexpr (SqType<T>) { return fpm::detail::ExprLeaf<T>{ operand }; }
+    else { return fpm::detail::ExprLeaf< decltype(operand.toSq()) >{ operand.toSq() }; }
+}
+
+/// Operand of a lazy expression.
+template< typename T >
+concept ExprOperand = ExprType<T> || SqType<T> || QType<T>;
+
+/// Starts a lazy expression with the given Sq or Q value.
+/// \returns an expression that holds the value.
+template< /* deduced: */ typename T >
+requires ( SqType<T> || QType<T> )
+constexpr
+auto lazy(T const &value) noexcept {
+    using node_t = decltype(exprNodeOf(value));
+    return Expr<node_t>( exprNodeOf(value) );
+}
+
+/// Adds two operands of which at least one is a lazy expression.
+/// \returns the lazy sum.
+template< /* deduced: */ ExprOperand L, ExprOperand R >
+requires ( ExprType<L> || ExprType<R> )
+constexpr
+auto operator +(L const &lhs, R const &rhs) noexcept {
+    using node_t = fpm::detail::ExprAdd< decltype(exprNodeOf(lhs)), decltype(exprNodeOf(rhs)) >;
+    return Expr<node_t>( node_t{ exprNodeOf(lhs), exprNodeOf(rhs) } );
+}
+
+/// Subtracts two operands of which at least one is a lazy expression.
+/// \returns the lazy difference.
+template< /* deduced: */ ExprOperand L, ExprOperand R >
+requires ( ExprType<L> || ExprType<R> )
+constexpr
+auto operator -(L const &lhs, R const &rhs) noexcept {
+    using node_t = fpm::detail::ExprSub< decltype(exprNodeOf(lhs)), decltype(exprNodeOf(rhs)) >;
+    return Expr<node_t>( node_t{ exprNodeOf(lhs), exprNodeOf(rhs) } );
+}
+
+/// Multiplies two operands of which at least one is a lazy expression.
+/// \returns the lazy product.
+template< /* deduced: */ ExprOperand L, ExprOperand R >
+requires ( ExprType<L> || ExprType<R> )
+constexpr
+auto operator *(L const &lhs, R const &rhs) noexcept {
+    using node_t = fpm::detail::ExprMult< decltype(exprNodeOf(lhs)), decltype(exprNodeOf(rhs)) >;
+    return Expr<node_t>( node_t{ exprNodeOf(lhs), exprNodeOf(rhs) } );
+}
+
+/// Negates a lazy expression.
+/// \returns the lazy negation.
+template< /* deduced: */ ExprType E >
+constexpr
+auto operator -(E const &expr) noexcept {
+    using node_t = fpm::detail::ExprNeg< typename E::node_t >;
+    return Expr<node_t>( node_t{ expr.node } );
+}
+
+/// Multiplies a lazy expression with an integral constant.
+/// \returns the lazy product.
+template< /* deduced: */ ExprType E, std::integral T, T ic >
+constexpr
+auto operator *(E const &expr, std::integral_constant<T, ic>) noexcept {
+    using node_t = fpm::detail::ExprMultIc< typename E::node_t, T, ic >;
+    return Expr<node_t>( node_t{ expr.node } );
+}
+
+/// Multiplies an integral constant with a lazy expression.
+/// \returns the lazy product.
+template< /* deduced: */ std::integral T, T ic, ExprType E >
+constexpr
+auto operator *(std::integral_constant<T, ic>, E const &expr) noexcept {
+    using node_t = fpm::detail::ExprMultIc< typename E::node_t, T, ic >;
+    return Expr<node_t>( node_t{ expr.node } );
+}
+
+/// Divides a lazy expression by a non-zero integral constant.
+/// \returns the lazy quotient.
+template< /* deduced: */ ExprType E, std::integral T, T ic >
+requires ( ic != 0 )
+constexpr
+auto operator /(E const &expr, std::integral_constant<T, ic>) noexcept {
+    using node_t = fpm::detail::ExprDivIc< typename E::node_t, T, ic >;
+    return Expr<node_t>( node_t{ expr.node } );
+}
+
+/**\}*/
+}  // namespace fpm::sq
+
+
+#endif
+// EOF
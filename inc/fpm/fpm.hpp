@@ -18,8 +18,10 @@
 #define FPM_FPM_HPP_A8F802C9_E2D6_45D5_B0AF_AEAD2FE2D1A2
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cctype>
+#include <climits>
 #include <cmath>
 #include <concepts>
 #include <cstdint>
@@ -28,6 +30,29 @@
 #include <numeric>
 #include <type_traits>
 #include <utility>
+#if defined FPM_OVF_TELEMETRY || defined FPM_RANGE_PROFILER
+#   include <atomic>
+#endif
+#if defined FPM_RANGE_PROFILER
+#   include <cstdio>
+#   include <cstring>
+#endif
+
+
+/// Loop hint: iterations of the annotated loop are independent and can be vectorized.
+#if defined __clang__
+#   define FPM_SIMD_LOOP _Pragma("clang loop vectorize(enable) interleave(enable)")
+#elif defined __GNUC__
+#   define FPM_SIMD_LOOP _Pragma("GCC ivdep")
+#else
+#   define FPM_SIMD_LOOP
+#endif
+
+/// The rescale strategy is a property of the (S)Q types (fpm::Rounding) since the global switch
+/// changed the definition of s2s per translation unit, which violated the one-definition rule.
+#if defined FPM_USE_MULTDIV_TO_RESCALE
+#   error "FPM_USE_MULTDIV_TO_RESCALE is no longer supported; use fpm::Rounding::towardZero on the (S)Q types which need symmetric rounding"
+#endif
 
 
 /** Fixed-Point Math Namespace. */
@@ -71,21 +96,154 @@ struct is_ovf_stricter { static constexpr bool value = a < b; };
 template< Overflow a, Overflow b >
 static constexpr bool is_ovf_stricter_v = is_ovf_stricter<a, b>::value;
 
+/** Rounding mode of a down-scaling of a scaled value, i.e. what happens with the fraction bits
+ * that are shifted out. The rounding mode is a property of the (S)Q type. */
+enum class Rounding : uint8_t {
+    /// Native rounding of the operations of the target, which is the cheapest mode: a down-scaling
+    /// is an arithmetic right shift, which rounds towards negative infinity (floor), and a division
+    /// truncates towards zero like the built-in division. Note that the error of the shifts is
+    /// always negative and accumulates in long calculations.
+    native = 0u,
+
+    /// Round towards zero (truncate). Symmetric for positive and negative values.
+    towardZero = 1u,
+
+    /// Round to the nearest value; ties are rounded up (towards positive infinity).
+    nearest = 2u,
+
+    /// Round to the nearest value; ties are rounded to the even value (banker's rounding).
+    /// Unbiased, also for values which are exactly between two representable values.
+    convergent = 3u,
+};
+
+/// Rounding type alias.
+using Rnd = Rounding;
+
 /** Overflow assert trap function. Must not return!
  * \note Needs to be implemented in the application if Ovf::assert is used. */
 [[noreturn]] extern void ovfAssertTrap();
 
+/** Overflow assert trap function for bulk operations on ranges of values. Must not return!
+ * \param index  index of the first value in the range which is out of bounds
+ * \note Needs to be implemented in the application if Ovf::assert is used with bulk operations. */
+[[noreturn]] extern void ovfAssertTrap(std::size_t index);
+
+/** Information about the site of an overflow detected by a runtime check with Ovf::assert. */
+struct OvfSite {
+    /// Return address of the call of the trap trampoline, i.e. an address within the function with
+    /// the failed check (slightly after the check); can be looked up in the map file or with addr2line.
+    /// nullptr if the compiler does not provide it.
+    void const *address;
+    intmax_t value;  ///< the value which is out of range
+};
+
 
 /// Scaling factor type.
 using scaling_t = int;
 
+/// Whether the overflow telemetry is compiled in. Enabled by defining FPM_OVF_TELEMETRY before
+/// including fpm.hpp; this must be done consistently for all translation units of a program.
+#if defined FPM_OVF_TELEMETRY
+constexpr bool ovfTelemetryEnabled = true;
+#else
+constexpr bool ovfTelemetryEnabled = false;
+#endif
+
+/// Whether the range profiler is compiled in. Enabled by defining FPM_RANGE_PROFILER before
+/// including fpm.hpp; this must be done consistently for all translation units of a program.
+#if defined FPM_RANGE_PROFILER
+constexpr bool rangeProfilerEnabled = true;
+#else
+constexpr bool rangeProfilerEnabled = false;
+#endif
+
+/** Snapshot of the range profile of a Q type, i.e. of all values that were stored in Q values of
+ * that type. The type is identified by its base type, scaling and real value range. */
+struct RangeProfileEntry {
+    std::size_t baseSize;  ///< size of the base type in bytes
+    bool isSigned;         ///< whether the base type is signed
+    scaling_t f;           ///< scaling of the type
+    double realMin;        ///< real lower limit of the type
+    double realMax;        ///< real upper limit of the type
+    uint64_t count;        ///< number of recorded values
+    intmax_t min;          ///< smallest recorded (scaled) value; INTMAX_MAX if none
+    intmax_t max;          ///< largest recorded (scaled) value; INTMAX_MIN if none
+    scaling_t fUsed;       ///< smallest scaling that represents all recorded values exactly
+};
+
+/** Narrowest Q type that holds all values of a range profile. */
+struct RangeProfileRecommendation {
+    std::size_t baseSize;  ///< size of the base type in bytes; same signedness as the profiled type
+    scaling_t f;           ///< largest scaling up to the profiled one for which the range fits
+    double realMin;        ///< observed real minimum
+    double realMax;        ///< observed real maximum
+};
+
+/** Snapshot of the overflow telemetry of a (S)Q type, i.e. of the values that were clamped by
+ * runtime overflow checks with Ovf::clamp when converting to that type. The type is identified by
+ * its base type, scaling and real value range. */
+struct OvfTelemetryEntry {
+    std::size_t baseSize;  ///< size of the base type in bytes
+    bool isSigned;         ///< whether the base type is signed
+    scaling_t f;           ///< scaling of the type
+    double realMin;        ///< real lower limit of the type
+    double realMax;        ///< real upper limit of the type
+    uint32_t count;        ///< number of clamped values
+    intmax_t min;          ///< smallest clamped (scaled) value before clamping; INTMAX_MAX if none
+    intmax_t max;          ///< largest clamped (scaled) value before clamping; INTMAX_MIN if none
+};
+
 
 // Internal implementations.
 namespace detail {
 
+#if defined __SIZEOF_INT128__
+/// 128-bit integer types, used as intermediate types for 64-bit base types.
+/// \note __int128 is a compiler extension (not ISO C++), hence the __extension__ marker.
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+
+/// Widest available signed and unsigned integer types.
+using widest_int_t = int128_t;
+using widest_uint_t = uint128_t;
+
+/// Maximal supported size of a (S)Q type's base type.
+/// \note 64-bit base types are supported if a 128-bit intermediate type is available.
+constexpr size_t MAX_BASETYPE_SIZE = sizeof(uint64_t);
+#else
+/// Widest available signed and unsigned integer types.
+using widest_int_t = int64_t;
+using widest_uint_t = uint64_t;
+
 /// Maximal supported size of a (S)Q type's base type.
-/// TODO: Support 64-bit types.
+/// \note 64-bit base types are not supported, because there is no 128-bit intermediate type.
 constexpr size_t MAX_BASETYPE_SIZE = sizeof(uint32_t);
+#endif
+
+/// Default rounding mode of (S)Q types: native, i.e. a plain arithmetic shift.
+constexpr Rounding DEFAULT_ROUNDING = Rounding::native;
+
+/** Integral type concept. Same as std::integral, but also includes the 128-bit extension types,
+ * which are not integral types in the sense of the standard library in strict ISO mode. */
+template< typename T >
+concept Integral = std::integral<T> || std::same_as<T, widest_int_t> || std::same_as<T, widest_uint_t>;
+
+/// Signedness of arithmetic types, including the 128-bit extension types.
+template< typename T >
+constexpr bool is_signed_v = std::is_signed_v<T> || std::same_as<T, widest_int_t>;
+template< typename T >
+constexpr bool is_unsigned_v = std::is_unsigned_v<T> || std::same_as<T, widest_uint_t>;
+
+/** Signed counterpart of an integral type, including the 128-bit extension types. */
+template< Integral T >
+struct make_signed { using type = std::make_signed_t<T>; };
+template<>
+struct make_signed<widest_int_t> { using type = widest_int_t; };
+template<>
+struct make_signed<widest_uint_t> { using type = widest_int_t; };
+/// Alias for make_signed<T>::type.
+template< Integral T >
+using make_signed_t = typename make_signed<T>::type;
 
 /// Maximum possible value of f to support correct scaling of floating-point types with double precision.
 /// Corresponds to the effective size of double's mantissa (significant double precision).
@@ -102,7 +260,9 @@ struct fit_type {
         std::conditional_t<!isSigned && sizeof(uint16_t) >= size, uint16_t,
         std::conditional_t< isSigned && sizeof( int32_t) >= size,  int32_t,
         std::conditional_t<!isSigned && sizeof(uint32_t) >= size, uint32_t,
-        std::conditional_t< isSigned,                              int64_t, uint64_t >>>>>>>;
+        std::conditional_t< isSigned && sizeof( int64_t) >= size,  int64_t,
+        std::conditional_t<!isSigned && sizeof(uint64_t) >= size, uint64_t,
+        std::conditional_t< isSigned,                         widest_int_t, widest_uint_t >>>>>>>>>;
 };
 /// Alias for fit_type<size, isSigned>::type.
 template< size_t size, bool isSigned >
@@ -116,13 +276,32 @@ auto scale_factor() {
         std::conditional_t<isSigned, int32_t, uint32_t> mask = 1;
         mask <<= n;
         return mask;
-    } else {
+    } else if constexpr (n < 63u) {
         std::conditional_t<isSigned, int64_t, uint64_t> mask = 1;
         mask <<= n;
         return mask;
+    } else {
+        std::conditional_t<isSigned, widest_int_t, widest_uint_t> mask = 1;
+        mask <<= n;
+        return mask;
     }
 }
 
+/// Size of a vector register of the target in bytes; 0 if there is no known SIMD extension.
+#if defined __AVX512F__
+constexpr size_t VECTOR_SIZE = 64u;
+#elif defined __AVX2__
+constexpr size_t VECTOR_SIZE = 32u;
+#elif defined __SSE2__ || defined __ARM_NEON || defined __wasm_simd128__
+constexpr size_t VECTOR_SIZE = 16u;
+#else
+constexpr size_t VECTOR_SIZE = 0u;
+#endif
+
+/// Number of lanes per vector block, determined by the largest of the given base types (at least 1).
+template< typename... BaseTs >
+constexpr size_t lanes_v = std::max<size_t>(1u, VECTOR_SIZE / std::max({ sizeof(BaseTs)... }));
+
 }  // namespace detail
 
 
@@ -132,20 +311,20 @@ auto scale_factor() {
  * \note Arithmetic multiplication/division is used here because these operations are symmetric for
  * positive and negative values with respect to rounding (e.g. +-514 / 2^4 is +-32).
  * \warning Floating-point target is possible, however quite expensive at runtime! Use carefully! */
-template< scaling_t from, scaling_t to, typename TargetT, /* deduced: */ std::integral ValueT >
+template< scaling_t from, scaling_t to, typename TargetT, /* deduced: */ detail::Integral ValueT >
 [[nodiscard]] constexpr
 TargetT s2smd(ValueT value) noexcept {
     // for scaling between integral values, use size of common type but sign of source type
     // to avoid loss of precision or sign; otherwise, if common type is floating point, use double
     using common_t = typename std::common_type_t<ValueT, TargetT>;
     using scale_t = std::conditional_t< std::is_floating_point_v<common_t>, double,
-                                        detail::fit_type_t<sizeof(common_t), std::is_signed_v<ValueT>> >;
+                                        detail::fit_type_t<sizeof(common_t), detail::is_signed_v<ValueT>> >;
 
     if constexpr (from > to) {
-        return static_cast<TargetT>( static_cast<scale_t>(value) / detail::scale_factor<from-to, std::is_signed_v<scale_t>>() );
+        return static_cast<TargetT>( static_cast<scale_t>(value) / detail::scale_factor<from-to, detail::is_signed_v<scale_t>>() );
     }
     else if constexpr (to > from) {
-        return static_cast<TargetT>( static_cast<scale_t>(value) * detail::scale_factor<to-from, std::is_signed_v<scale_t>>() );
+        return static_cast<TargetT>( static_cast<scale_t>(value) * detail::scale_factor<to-from, detail::is_signed_v<scale_t>>() );
     }
     else /* from == to */ {
         return static_cast<TargetT>(value);
@@ -159,14 +338,14 @@ TargetT s2smd(ValueT value) noexcept {
  * \warning Be aware that arithmetic right shift always rounds down. Consequently, the scaled result
  *          is not symmetric for the same value with a different sign
  *          (e.g. -514 >> 4u is -33 but +514 >> 4u is +32). */
-template< scaling_t from, scaling_t to, std::integral TargetT, /* deduced: */ std::integral ValueT >
+template< scaling_t from, scaling_t to, detail::Integral TargetT, /* deduced: */ detail::Integral ValueT >
 [[nodiscard]] constexpr
 TargetT s2sh(ValueT value) noexcept {
     // for scaling between integral values, use size of common type but sign of source type
     // to avoid loss of precision or sign
     using common_t = typename std::common_type_t<ValueT, TargetT>;
     using scale_t = std::conditional_t< false, int,  // keep to ensure that type shown in IDE is not 'scale_t'
-                                        detail::fit_type_t<sizeof(common_t), std::is_signed_v<ValueT>> >;
+                                        detail::fit_type_t<sizeof(common_t), detail::is_signed_v<ValueT>> >;
 
     if constexpr (from > to) {
         return static_cast<TargetT>( static_cast<scale_t>(value) >> (unsigned)(from - to) );
@@ -179,20 +358,52 @@ TargetT s2sh(ValueT value) noexcept {
     }
 }
 
+/** Scale-To-Scale-Shift-Round scaling function.
+ * Used to scale a given integer value to a different scaling factor and integral target type via
+ * arithmetic shift operations, like s2sh, but a down-scaling is rounded with the given rounding
+ * mode. The correction is derived from the shifted-out bits and added after the shift, thus no
+ * wider type and no division is needed:
+ *  - native: no correction (same as s2sh), i.e. rounded towards negative infinity,
+ *  - towardZero: +1 if the value is negative and any shifted-out bit is set,
+ *  - nearest: +1 if the shifted-out bits are at least one half,
+ *  - convergent: +1 if the shifted-out bits are more than one half, or exactly one half and the
+ *    shifted value is odd. */
+template< Rounding rnd, scaling_t from, scaling_t to, detail::Integral TargetT, /* deduced: */ detail::Integral ValueT >
+[[nodiscard]] constexpr
+TargetT s2shr(ValueT value) noexcept {
+    if constexpr (from > to && rnd != Rounding::native) {
+        using common_t = typename std::common_type_t<ValueT, TargetT>;
+        using scale_t = detail::fit_type_t<sizeof(common_t), detail::is_signed_v<ValueT>>;
+        using uscale_t = detail::fit_type_t<sizeof(common_t), false>;
+        constexpr auto n = (unsigned)(from - to);
+        constexpr uscale_t mask = (uscale_t(1) << n) - 1u;
+        constexpr uscale_t half = uscale_t(1) << (n - 1u);
+
+        auto const v = static_cast<scale_t>(value);
+        auto const q = static_cast<scale_t>(v >> n);
+        auto const r = static_cast<uscale_t>( static_cast<uscale_t>(v) & mask );  // shifted-out bits
+        bool correction = false;
+        if constexpr (rnd == Rounding::towardZero) {
+            if constexpr (detail::is_signed_v<scale_t>) { correction = v < 0 && r != 0u; }
+        }
+        else if constexpr (rnd == Rounding::nearest) { correction = r >= half; }
+        else /* convergent */ { correction = static_cast<uscale_t>( r + static_cast<uscale_t>(q & 1) ) > half; }
+        return static_cast<TargetT>( q + static_cast<scale_t>(correction) );
+    }
+    else {
+        return s2sh<from, to, TargetT>(value);
+    }
+}
+
 /** Scale-To-Scale function for runtime and compile-time conversions between scaled integral values.
  * This function is used in the implementations of the (S)Q types to rescale values when needed.
- * \note Proxy for a s2sx function pre-selected by the user. Shifting is the default,
- *       multiplication/division can be selected explicitly by predefining the
- *       FPM_USE_MULTDIV_TO_RESCALE symbol. */
-#if defined FPM_USE_MULTDIV_TO_RESCALE
-template< scaling_t from, scaling_t to, std::integral TargetT >
+ * A down-scaling is rounded with the given rounding mode, which is the one of the (S)Q type, thus
+ * the rescale strategy is selected per type rather than per translation unit.
+ * \note Proxy for s2shr. Floor is a plain shift; the other modes, including the symmetric
+ *       rounding towards zero, add a correction to the shift result. */
+template< scaling_t from, scaling_t to, detail::Integral TargetT, Rounding rnd = detail::DEFAULT_ROUNDING >
 [[nodiscard]] constexpr
-TargetT s2s(std::integral auto value) noexcept { return s2smd<from, to, TargetT>(value); }
-#else
-template< scaling_t from, scaling_t to, std::integral TargetT >
-[[nodiscard]] constexpr
-TargetT s2s(std::integral auto value) noexcept { return s2sh<from, to, TargetT>(value); }
-#endif
+TargetT s2s(detail::Integral auto value) noexcept { return s2shr<rnd, from, to, TargetT>(value); }
 
 
 /** Value-To-Scale scaling function. Converts a real value to a scaled value with the given
@@ -206,13 +417,13 @@ TargetT v2s(ValueT value) noexcept {
     // to avoid loss of precision or sign; otherwise, if common type is floating point, use double
     using common_t = typename std::common_type_t<ValueT, TargetT>;
     using scale_t = std::conditional_t< std::is_floating_point_v<common_t>, double,
-                                        detail::fit_type_t<sizeof(common_t), std::is_signed_v<ValueT>> >;
+                                        detail::fit_type_t<sizeof(common_t), detail::is_signed_v<ValueT>> >;
 
     if constexpr (to < 0) {
-        return static_cast<TargetT>( static_cast<scale_t>(value) / detail::scale_factor<-to, std::is_signed_v<scale_t>>() );
+        return static_cast<TargetT>( static_cast<scale_t>(value) / detail::scale_factor<-to, detail::is_signed_v<scale_t>>() );
     }
     else if constexpr (to > 0) {
-        return static_cast<TargetT>( static_cast<scale_t>(value) * detail::scale_factor<to, std::is_signed_v<scale_t>>() );
+        return static_cast<TargetT>( static_cast<scale_t>(value) * detail::scale_factor<to, detail::is_signed_v<scale_t>>() );
     }
     else /* to == 0 */ {
         return static_cast<TargetT>(value);
@@ -222,7 +433,7 @@ TargetT v2s(ValueT value) noexcept {
 
 /** \returns the scaled integral value that corresponds to a given real double value.
  * \note Compile-time only. Works with floating-point input and integral output type. */
-template< scaling_t f, /* optional: */ std::integral TargetT = int >
+template< scaling_t f, /* optional: */ detail::Integral TargetT = int >
 [[nodiscard]] consteval
 TargetT scaled(double real) noexcept { return v2s<f, TargetT>(real); }
 
@@ -233,12 +444,180 @@ TargetT scaled(double real) noexcept { return v2s<f, TargetT>(real); }
  * \warning Floating-point target is possible, however quite expensive at runtime! Use carefully! */
 template< scaling_t f, /* optional */ typename TargetT = double >
 [[nodiscard]] constexpr
-TargetT real(std::integral auto scaled) noexcept { return s2smd<f, 0, TargetT>(scaled); }  // only s2smd works with floating-point types
+TargetT real(detail::Integral auto scaled) noexcept { return s2smd<f, 0, TargetT>(scaled); }  // only s2smd works with floating-point types
 
 
 // Internal implementations.
 namespace detail {
 
+/** \returns the given integral value, rounded towards zero to the closest value that can be represented
+ * exactly by double. Values with up to 53 significant bits are returned unchanged.
+ * \note Relevant for 64-bit limits, which would be rounded up to an out-of-range value otherwise. */
+template< std::integral T >
+consteval
+T doubleExact(T value) noexcept {
+    using unsigned_t = std::make_unsigned_t<T>;
+    unsigned_t magnitude = (value < 0) ? unsigned_t(0) - static_cast<unsigned_t>(value) : static_cast<unsigned_t>(value);
+    if (int const excess = std::bit_width(magnitude) - std::numeric_limits<double>::digits; excess > 0) {
+        magnitude &= ~((unsigned_t(1) << excess) - 1u);
+    }
+    return (value < 0) ? static_cast<T>(unsigned_t(0) - magnitude) : static_cast<T>(magnitude);
+}
+
+/** Divides the given value by the integral constant d. The result is the same as value / d, i.e.
+ * the quotient is truncated towards zero for signed and unsigned types. Instead of a division, the
+ * value is multiplied by a magic number and shifted; both are computed at compile-time. The
+ * intermediate product is calculated in a type with twice the size of T.
+ * \note See T. Granlund, P. L. Montgomery: "Division by Invariant Integers using Multiplication",
+ *       1994, figures 4.1 (unsigned) and 5.2 (signed). */
+template< std::integral T, T d >
+requires ( d != 0 && sizeof(T) <= MAX_BASETYPE_SIZE )
+[[nodiscard]] constexpr
+T divic(T value) noexcept {
+    constexpr int N = sizeof(T) * CHAR_BIT;
+    using unsigned_t = std::make_unsigned_t<T>;
+    using wide_t = fit_type_t<2u * sizeof(T), is_signed_v<T>>;
+    using uwide_t = fit_type_t<2u * sizeof(T), false>;
+
+    if constexpr (d == 1) {
+        return value;
+    }
+    else if constexpr (is_signed_v<T> && d == -1) {
+        return static_cast<T>(-value);
+    }
+    else if constexpr (is_unsigned_v<T>) {
+        // l = ceil(log2(d)), m = floor(2^N * (2^l - d) / d) + 1
+        constexpr int l = static_cast<int>( std::bit_width(static_cast<unsigned_t>(d - 1u)) );
+        constexpr T m = static_cast<T>( (uwide_t(1) << N) * ((uwide_t(1) << l) - d) / d + 1u );
+        T const t = static_cast<T>( (static_cast<uwide_t>(m) * value) >> N );
+        return static_cast<T>( (t + static_cast<T>((value - t) >> 1)) >> (l - 1) );
+    }
+    else {
+        // l = max(ceil(log2(|d|)), 1), m = floor(2^(N+l-1) / |d|) + 1
+        constexpr unsigned_t absD = (d < 0) ? static_cast<unsigned_t>(0u - static_cast<unsigned_t>(d)) : static_cast<unsigned_t>(d);
+        constexpr int l = std::max(static_cast<int>( std::bit_width(static_cast<unsigned_t>(absD - 1u)) ), 1);
+        constexpr wide_t m = static_cast<wide_t>( (uwide_t(1) << (N + l - 1)) / absD + 1u );
+        // the floored quotient is incremented by 1 for negative values to truncate towards zero
+        wide_t const q = ((m * value) >> (N + l - 1)) - (value >> (N - 1));
+        return static_cast<T>( (d < 0) ? -q : q );
+    }
+}
+
+/** Rounds the given truncated quotient q = value / d with the remainder r = value % d and the
+ * given rounding mode. The truncated quotient is corrected by 1 away from zero depending on the
+ * remainder, which is compared with the rest of the divisor (|d| - |r|) instead of 2*|r|, so that
+ * the comparison cannot overflow.
+ * \note With Rounding::native, which is the default mode, the quotient stays truncated towards zero
+ * like the built-in division, thus it is not rounded towards negative infinity like a shift. */
+template< Rounding rnd, /* deduced: */ Integral T >
+[[nodiscard]] constexpr
+T roundQuotient(T q, T r, T d) noexcept {
+    if constexpr (rnd == Rounding::native || rnd == Rounding::towardZero) { return q; }
+    else {
+        using unsigned_t = fit_type_t<sizeof(T), false>;
+        unsigned_t absR = static_cast<unsigned_t>(r), absD = static_cast<unsigned_t>(d);
+        bool negative = false;  // sign of the truncated fraction, if any
+        if constexpr (is_signed_v<T>) {
+            if (r < 0) { absR = unsigned_t(0) - absR; }
+            if (d < 0) { absD = unsigned_t(0) - absD; }
+            negative = (r < 0) != (d < 0);
+        }
+        unsigned_t const rest = absD - absR;
+        bool away;
+        if constexpr (rnd == Rounding::nearest) { away = negative ? absR > rest : absR >= rest; }
+        else /* convergent */ { away = absR > rest || (absR == rest && (q & 1) != 0); }
+        return negative ? static_cast<T>(q - static_cast<T>(away)) : static_cast<T>(q + static_cast<T>(away));
+    }
+}
+
+/** Divides the given value by the given divisor and rounds the quotient with the given rounding
+ * mode (see roundQuotient). */
+template< Rounding rnd, /* deduced: */ Integral T >
+[[nodiscard]] constexpr
+T divr(T value, T d) noexcept {
+    if constexpr (rnd == Rounding::native || rnd == Rounding::towardZero) { return value / d; }
+    else { return roundQuotient<rnd>(static_cast<T>(value / d), static_cast<T>(value % d), d); }
+}
+
+/** Divides the given value by the integral constant d like divic and rounds the quotient with the
+ * given rounding mode (see roundQuotient). The remainder is calculated from the quotient with a
+ * multiplication, thus no runtime division is needed for any rounding mode. */
+template< Rounding rnd, std::integral T, T d >
+requires ( d != 0 && sizeof(T) <= MAX_BASETYPE_SIZE )
+[[nodiscard]] constexpr
+T divicr(T value) noexcept {
+    T const q = divic<T, d>(value);
+    if constexpr (rnd == Rounding::native || rnd == Rounding::towardZero) { return q; }
+    else { return roundQuotient<rnd>(q, static_cast<T>(value - static_cast<T>(q * d)), d); }
+}
+
+/** Adds b to a within the type T. \returns true if the sum overflowed, in which case r holds the
+ * wrapped sum. Uses the overflow builtin of the compiler if available, which compiles to an add
+ * and a flag test instead of an addition in a wider type. */
+template< std::integral T >
+[[nodiscard]] constexpr
+bool addOverflow(T a, T b, T &r) noexcept {
+#if defined __GNUC__ || defined __clang__
+    return __builtin_add_overflow(a, b, &r);
+#else
+    r = static_cast<T>( static_cast<std::make_unsigned_t<T>>(a) + static_cast<std::make_unsigned_t<T>>(b) );
+    if constexpr (std::is_signed_v<T>) { return (a < 0) == (b < 0) && (r < 0) != (a < 0); }
+    else { return r < a; }
+#endif
+}
+
+/** Subtracts b from a within the type T. \returns true if the difference overflowed, in which case
+ * r holds the wrapped difference. See addOverflow. */
+template< std::integral T >
+[[nodiscard]] constexpr
+bool subOverflow(T a, T b, T &r) noexcept {
+#if defined __GNUC__ || defined __clang__
+    return __builtin_sub_overflow(a, b, &r);
+#else
+    r = static_cast<T>( static_cast<std::make_unsigned_t<T>>(a) - static_cast<std::make_unsigned_t<T>>(b) );
+    if constexpr (std::is_signed_v<T>) { return (a < 0) != (b < 0) && (r < 0) != (a < 0); }
+    else { return a < b; }
+#endif
+}
+
+/** \returns the given value if the flag is false, otherwise the given alternative. The selection is
+ * done with a mask instead of a branch. */
+template< Integral T >
+[[nodiscard]] constexpr
+T selectIf(bool flag, T alternative, T value) noexcept {
+    using unsigned_t = fit_type_t<sizeof(T), false>;
+    auto const mask = static_cast<unsigned_t>( unsigned_t(0) - static_cast<unsigned_t>(flag) );
+    return static_cast<T>( static_cast<unsigned_t>(value) ^ ((static_cast<unsigned_t>(value) ^ static_cast<unsigned_t>(alternative)) & mask) );
+}
+
+/** \returns a + b, saturated to the limits of the type T. The limit is derived from the sign of b
+ * and selected without a branch. */
+template< std::integral T >
+[[nodiscard]] constexpr
+T saturatingAdd(T a, T b) noexcept {
+    T r;
+    bool const overflow = addOverflow(a, b, r);
+    T limit = std::numeric_limits<T>::max();
+    if constexpr (std::is_signed_v<T>) {
+        limit = static_cast<T>( limit ^ (b >> std::numeric_limits<T>::digits) );  // min if b < 0
+    }
+    return selectIf(overflow, limit, r);
+}
+
+/** \returns a - b, saturated to the limits of the type T. The limit is derived from the sign of b
+ * and selected without a branch. */
+template< std::integral T >
+[[nodiscard]] constexpr
+T saturatingSub(T a, T b) noexcept {
+    T r;
+    bool const overflow = subOverflow(a, b, r);
+    T limit = std::numeric_limits<T>::min();
+    if constexpr (std::is_signed_v<T>) {
+        limit = static_cast<T>( limit ^ (b >> std::numeric_limits<T>::digits) );  // max if b < 0
+    }
+    return selectIf(overflow, limit, r);
+}
+
 /** \returns the real minimum value for the given integral type and scaling that can safely be
  * used in operations like negation or taking the absolute value (i.e. 0u for unsigned, INT_MIN + 1
  * for signed).
@@ -246,14 +625,14 @@ namespace detail {
 template< std::integral T, scaling_t f >
 consteval
 double realMin() noexcept {
-    return v2s<-f, double>( std::is_unsigned_v<T> ? static_cast<T>(0) : std::numeric_limits<T>::min() + 1 );
+    return v2s<-f, double>( std::is_unsigned_v<T> ? static_cast<T>(0) : doubleExact(std::numeric_limits<T>::min() + 1) );
 }
 
 /** \returns the real maximum value for the given integral type and scaling.
  * \note Prefer Q<>::realMax and Sq<>::realMax on concrete Q or Sq types. */
 template< std::integral T, scaling_t f >
 consteval
-double realMax() noexcept { return v2s<-f, double>( std::numeric_limits<T>::max() ); }
+double realMax() noexcept { return v2s<-f, double>( doubleExact(std::numeric_limits<T>::max()) ); }
 
 /** \returns the resolution of the given scaling. */
 template< scaling_t f >
@@ -278,7 +657,7 @@ inline namespace lib {
 
     /** \returns the absolute value of the given integral input value. */
     consteval
-    auto abs(std::integral auto const input) noexcept {
+    auto abs(detail::Integral auto const input) noexcept {
         return input >= 0 ? input : -input;
     }
 
@@ -329,10 +708,11 @@ inline namespace lib {
     consteval
     double cbrt(double number) noexcept {
         // Algorithm according to https://www.geeksforgeeks.org/find-cubic-root-of-a-number/
-        // set start and end for binary search
-        double start = 0., end = number, mid = 0.;
+        // set start and end for binary search; the root of a number between -1 and 1 is not
+        // between 0 and the number
+        double start = 0., end = (number < 0.) ? std::min(number, -1.) : std::max(number, 1.), mid = 0.;
         for (size_t i = 200u; i > 0u; --i) {
-            double mid = (start + end) / 2.0L;
+            mid = (start + end) / 2.0L;
             double mid3 = mid*mid*mid;
             double error = (number > mid3) ? number - mid3 : mid3 - number;
 
@@ -346,68 +726,199 @@ inline namespace lib {
         }
         return mid;
     }
+
+    /** \returns the approximated reciprocal cube root of the given positive number. */
+    consteval
+    double rcbrt(double number) noexcept {
+        // the root of the larger one of number and 1/number is more precise
+        double y = number < 1. ? detail::cbrt(1. / number) : 1. / detail::cbrt(number);
+
+        // refine with Newton's method: y = y - (1/y^3 - number) / (-3/y^4) = y * (4 - number*y^3) / 3
+        y = y * (4. - number * y * y * y) / 3.;
+        return y;
+    }
+}
+
+/// Telemetry key of a (S)Q type with the given properties; passed to checkOverflow.
+template< typename BaseT, scaling_t f, double realMin, double realMax >
+struct OvfKey {};
+
+/// No telemetry key; overflows are not recorded.
+struct NoOvfKey {};
+
+#if defined FPM_OVF_TELEMETRY
+/// Overflow telemetry record of a (S)Q type. The records of types with recorded overflows form a
+/// lock-free singly linked list. All counters are updated with relaxed atomics, thus a snapshot is
+/// consistent per value but not across values.
+struct OvfTelemetryRecord {
+    std::size_t const baseSize;
+    bool const isSigned;
+    scaling_t const f;
+    double const realMin;
+    double const realMax;
+    std::atomic<uint32_t> count{ 0u };
+    std::atomic<intmax_t> min{ std::numeric_limits<intmax_t>::max() };
+    std::atomic<intmax_t> max{ std::numeric_limits<intmax_t>::min() };
+    std::atomic<bool> registered{ false };
+    OvfTelemetryRecord *next{ nullptr };
+};
+
+/// Head of the list of registered telemetry records.
+inline std::atomic<OvfTelemetryRecord *> ovfTelemetryHead{ nullptr };
+
+/// Telemetry record per (S)Q type key; constant-initialized, thus usable before main().
+template< typename KeyT >
+struct OvfTelemetry;
+
+template< typename BaseT, scaling_t f, double realMin, double realMax >
+struct OvfTelemetry< OvfKey<BaseT, f, realMin, realMax> > {
+    static constinit inline OvfTelemetryRecord record{ sizeof(BaseT), is_signed_v<BaseT>, f, realMin, realMax };
+};
+
+/** Records a number of clamped values with their smallest and largest value in the given telemetry
+ * record, e.g. of a block of a bulk operation. The record is added to the list with the first
+ * recorded value. */
+[[gnu::cold]] inline
+void recordOverflows(OvfTelemetryRecord &record, uint32_t count, intmax_t smallest, intmax_t largest) noexcept {
+    record.count.fetch_add(count, std::memory_order_relaxed);
+    intmax_t min = record.min.load(std::memory_order_relaxed);
+    while (smallest < min && !record.min.compare_exchange_weak(min, smallest, std::memory_order_relaxed)) {}
+    intmax_t max = record.max.load(std::memory_order_relaxed);
+    while (largest > max && !record.max.compare_exchange_weak(max, largest, std::memory_order_relaxed)) {}
+    if (!record.registered.exchange(true, std::memory_order_relaxed)) {
+        OvfTelemetryRecord *head = ovfTelemetryHead.load(std::memory_order_relaxed);
+        do { record.next = head; }
+        while (!ovfTelemetryHead.compare_exchange_weak(head, &record, std::memory_order_release, std::memory_order_relaxed));
+    }
+}
+
+/** Records a clamped value in the given telemetry record. */
+[[gnu::cold]] inline
+void recordOverflow(OvfTelemetryRecord &record, intmax_t value) noexcept {
+    recordOverflows(record, 1u, value, value);
+}
+#endif
+
+#if defined FPM_RANGE_PROFILER
+/// Range profile record of a Q type; organized like the overflow telemetry records.
+struct RangeProfileRecord {
+    std::size_t const baseSize;
+    bool const isSigned;
+    scaling_t const f;
+    double const realMin;
+    double const realMax;
+    std::atomic<uint64_t> count{ 0u };
+    std::atomic<intmax_t> min{ std::numeric_limits<intmax_t>::max() };
+    std::atomic<intmax_t> max{ std::numeric_limits<intmax_t>::min() };
+    std::atomic<uintmax_t> bits{ 0u };  ///< bitwise or of all values, for the used resolution
+    std::atomic<bool> registered{ false };
+    RangeProfileRecord *next{ nullptr };
+};
+
+/// Head of the list of registered range profile records.
+inline std::atomic<RangeProfileRecord *> rangeProfileHead{ nullptr };
+
+/// Range profile record per Q type; constant-initialized, thus usable before main().
+template< typename BaseT, scaling_t f, double realMin, double realMax >
+struct RangeProfile {
+    static constinit inline RangeProfileRecord record{ sizeof(BaseT), is_signed_v<BaseT>, f, realMin, realMax };
+};
+
+/** Records a value in the given range profile record. The record is added to the list with the
+ * first recorded value. */
+inline
+void recordRange(RangeProfileRecord &record, intmax_t value) noexcept {
+    record.count.fetch_add(1u, std::memory_order_relaxed);
+    intmax_t min = record.min.load(std::memory_order_relaxed);
+    while (value < min && !record.min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {}
+    intmax_t max = record.max.load(std::memory_order_relaxed);
+    while (value > max && !record.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    record.bits.fetch_or(static_cast<uintmax_t>(value), std::memory_order_relaxed);
+    if (!record.registered.exchange(true, std::memory_order_relaxed)) [[unlikely]] {
+        RangeProfileRecord *head = rangeProfileHead.load(std::memory_order_relaxed);
+        do { record.next = head; }
+        while (!rangeProfileHead.compare_exchange_weak(head, &record, std::memory_order_release, std::memory_order_relaxed));
+    }
+}
+
+/** \returns the snapshot of the given range profile record. */
+inline
+RangeProfileEntry rangeProfileEntryOf(RangeProfileRecord const &record) noexcept {
+    uintmax_t const bits = record.bits.load(std::memory_order_relaxed);
+    // the trailing zero bits of all values are not needed to represent them (none if all are 0)
+    scaling_t const fUsed = record.f - ((bits == 0u) ? 0 : static_cast<scaling_t>( std::countr_zero(bits) ));
+    return RangeProfileEntry{ record.baseSize, record.isSigned, record.f, record.realMin, record.realMax,
+                              record.count.load(std::memory_order_relaxed),
+                              record.min.load(std::memory_order_relaxed),
+                              record.max.load(std::memory_order_relaxed), fUsed };
+}
+#endif
+
+/// Site of the last overflow detected by a runtime check with Ovf::assert. Written right before
+/// the (non-returning) trap is called.
+inline OvfSite ovfSite{};
+
+/** Outlined trampoline of the overflow assert trap, one per value type. Records the site of the
+ * overflow and calls ovfAssertTrap(). Since it is cold and not inlined, a check site only contains
+ * the comparison and a jump to a call in the cold section, which keeps hot loops small. The site
+ * is derived from the return address, thus it does not cost any code at the check site. */
+template< Integral ValueT >
+[[noreturn, gnu::cold, gnu::noinline]]
+void ovfAssertTrampoline(ValueT value) noexcept {
+#if defined __GNUC__ || defined __clang__
+    ovfSite = OvfSite{ __builtin_return_address(0), static_cast<intmax_t>(value) };
+#else
+    ovfSite = OvfSite{ nullptr, static_cast<intmax_t>(value) };
+#endif
+    ovfAssertTrap();  // does not return!
 }
 
 /** Overflow check function.
+ * The clamp is done with min/max and a masked select instead of branches. The assert trap is
+ * called via an outlined cold trampoline, which records the site of the check. If the overflow
+ * telemetry is enabled, clamped values are recorded for the type given by the key.
  * \note Works for signed and unsigned value type. */
 template<
     Overflow ovfBx,   ///< overflow behavior
-    std::integral ValueT,  ///< type of the value to check (after a scaling/casting operation)
-    std::integral SrcValueT = ValueT >  ///< type of the value before scaling/casting operation; required if different
+    detail::Integral ValueT,  ///< type of the value to check (after a scaling/casting operation)
+    detail::Integral SrcValueT = ValueT,  ///< type of the value before scaling/casting operation; required if different
+    /* deduced: */ typename KeyT = NoOvfKey >  ///< telemetry key of the target type
 constexpr
-void checkOverflow(ValueT &value, ValueT const min, ValueT const max) noexcept {
-    // Overflow check types.
-    enum checktype : uint8_t {
-        CHECKTYPE_SIGN_UNCHANGED = 0u,  ///< default overflow check
-        CHECKTYPE_SIGNED_TO_UNSIGNED = 1u,  ///< sign has changed from signed to unsigned
-        CHECKTYPE_UNSIGNED_TO_SIGNED = 2u,  ///< sign has changed from unsigned to signed
-    };
-
+void checkOverflow(ValueT &value, ValueT const min, ValueT const max, [[maybe_unused]] KeyT key = {}) noexcept {
     if constexpr (Overflow::assert == ovfBx) {
-        if (value < min || value > max) {
-            ovfAssertTrap();  // value is out of range; this does not return!
+        if (value < min || value > max) [[unlikely]] {
+            ovfAssertTrampoline<ValueT>(value);  // value is out of range; this does not return!
         }
     }
     else if constexpr (Overflow::clamp == ovfBx) {
-        // determine check type
-        constexpr auto checkType = (std::is_signed_v<SrcValueT> && std::is_unsigned_v<ValueT>)
-            ? CHECKTYPE_SIGNED_TO_UNSIGNED
-            : (std::is_unsigned_v<SrcValueT> && std::is_signed_v<ValueT>)
-                ? CHECKTYPE_UNSIGNED_TO_SIGNED
-                : CHECKTYPE_SIGN_UNCHANGED;
+        ValueT const clamped = std::min(std::max(value, min), max);
+        [[maybe_unused]] ValueT const original = value;
 
         // if the value was cast from a signed to an unsigned type and is in the upper half of the
         // unsigned value range, the value was negative before; clamp it to the lower limit
-        if constexpr (CHECKTYPE_SIGNED_TO_UNSIGNED == checkType) {
-            constexpr ValueT signedMax = static_cast<ValueT>(std::numeric_limits<std::make_signed_t<ValueT>>::max());
-            if (value < min || value > signedMax) {
-                value = min;
-            }
-            else if (value > max) {
-                value = max;
-            }
-            else { /* okay */ }
+        if constexpr (detail::is_signed_v<SrcValueT> && detail::is_unsigned_v<ValueT>) {
+            constexpr ValueT signedMax = static_cast<ValueT>(std::numeric_limits<detail::make_signed_t<ValueT>>::max());
+            value = selectIf(original > signedMax, min, clamped);
         }
         // if the value was cast from an unsigned to a signed type and is negative, the value was
         // positive before; clamp it to the upper limit
-        else if constexpr (CHECKTYPE_UNSIGNED_TO_SIGNED == checkType) {
-            if (value < 0 || value > max) {
-                value = max;
-            }
-            else if (value < min) {
-                value = min;
-            }
-            else { /* okay */ }
+        else if constexpr (detail::is_unsigned_v<SrcValueT> && detail::is_signed_v<ValueT>) {
+            value = selectIf(original < 0, max, clamped);
         }
-        else /* checktype sign unchanged */ {
-            if (value < min) {
-                value = min;
-            }
-            else if (value > max) {
-                value = max;
+        else /* sign unchanged */ {
+            value = clamped;
+        }
+
+#if defined FPM_OVF_TELEMETRY
+        if constexpr (!std::is_same_v<KeyT, NoOvfKey>) {
+            if (value != original && !std::is_constant_evaluated()) [[unlikely]] {
+                // record the value with the sign of the source type
+                using record_t = std::conditional_t< detail::is_signed_v<SrcValueT>,
+                    detail::make_signed_t<ValueT>, fit_type_t<sizeof(ValueT), false> >;
+                recordOverflow(OvfTelemetry<KeyT>::record, static_cast<intmax_t>( static_cast<record_t>(original) ));
             }
-            else { /* okay */ }
         }
+#endif
     }
     else { /* Overflow::allowed, Overflow::unchecked: no checks performed */ }
 }
@@ -488,6 +999,19 @@ struct in_range {
 template< std::integral T, std::integral L, L v1, L v2 >
 constexpr bool in_range_v = in_range<T, L, v1, v2>::value;
 
+/** \returns the scaled value of the given real value like scaled<f, TargetT>(), but saturated to the
+ * limits of the target type instead of overflowing. */
+template< scaling_t f, std::integral TargetT >
+consteval
+TargetT saturated(double real) noexcept {
+    // note: conversion of the limits to double is exact for min (0 or power of 2) and rounds max up
+    //       to the next power of 2, so the comparisons below are safe
+    double const value = v2s<f, double>(real);
+    if (value <= static_cast<double>(std::numeric_limits<TargetT>::min())) return std::numeric_limits<TargetT>::min();
+    if (value >= static_cast<double>(std::numeric_limits<TargetT>::max())) return std::numeric_limits<TargetT>::max();
+    return static_cast<TargetT>(value);
+}
+
 /** Determines the smallest type that can hold the given real minimum and maximum values for
  * the given scaling f. The size of the resulting type will not be smaller than the smallest of
  * the input types. If one of the given base types is signed, the result will be signed too,
@@ -500,8 +1024,8 @@ private:
     static constexpr bool isSigned = std::is_signed_v<T1> || std::is_signed_v<T2>;
     static constexpr size_t size = std::min(sizeof(T1), sizeof(T2));
     using scaled_t = std::conditional_t<isSigned, int64_t, uint64_t>;
-    static constexpr auto scaledMin = v2s<f, scaled_t>(realMin);
-    static constexpr auto scaledMax = v2s<f, scaled_t>(realMax);
+    static constexpr auto scaledMin = saturated<f, scaled_t>(realMin);
+    static constexpr auto scaledMax = saturated<f, scaled_t>(realMax);
 public:
     using type =
         std::conditional_t< isSigned && sizeof( int8_t ) >= size && in_range_v< int8_t,  scaled_t, scaledMin, scaledMax>,  int8_t,
@@ -519,9 +1043,9 @@ using common_q_base_t = typename common_q_base<T1, T2, f, realMin, realMax>::typ
 /** Calculates the square root of a given unsigned 64-bit integer, rounded down.
  * Uses a integer square root binary search algorithm based on Hacker's Delight, 2nd ed. */
 constexpr
-uint32_t isqrt(uint64_t const value) noexcept {
+uint32_t isqrtbs(uint64_t const value) noexcept {
     uint64_t x = value,
-             b = (1u << (65u - std::countl_zero(x)) / 2u) - 1u,
+             b = (uint64_t(1) << (65u - std::countl_zero(x)) / 2u) - 1u,
              a = (b + 3u) / 2u;
     do {
         uint64_t m = (a + b) >> 1u;   // start between a and b, near center
@@ -531,14 +1055,63 @@ uint32_t isqrt(uint64_t const value) noexcept {
     return static_cast<uint32_t>(a - 1u);
 }
 
+/// Seeds for isqrtnr: for the upper 8 bits i (64..255) of a value normalized to [2^62, 2^64),
+/// the entry is larger than sqrt(i+1) * 2^11, i.e. larger than the root of the normalized value
+/// scaled by 2^-17. Generated at compile-time.
+inline constexpr auto isqrtSeeds = []() consteval {
+    std::array<uint16_t, 192u> seeds{};
+    for (uint32_t i = 0u; i < seeds.size(); ++i) {
+        seeds[i] = static_cast<uint16_t>( isqrtbs( static_cast<uint64_t>(i + 65u) << 22u ) + 1u );
+    }
+    return seeds;
+}();
+
+/** Calculates the square root of a given unsigned 64-bit integer, rounded down.
+ * Takes an estimate with a relative error below 2^-7 from a table, which is indexed by the upper
+ * 8 bits of the value normalized with countl_zero. The estimate is refined with two Newton steps
+ * to an error of a few units, and corrected to the exact result.
+ * \note The result is the same as the result of isqrtbs. */
+constexpr
+uint32_t isqrtnr(uint64_t const value) noexcept {
+    if (value == 0u) { return 0u; }
+    // normalize by an even number of bits, such that the upper two bits are not both 0
+    int const shift = std::countl_zero(value) & ~1;
+    uint64_t const index = (value << shift) >> 56u;  // 64..255
+    uint64_t y = ( static_cast<uint64_t>(isqrtSeeds[index - 64u]) << 17u ) >> (shift / 2);
+    // each Newton step approximately squares the relative error; a step never yields a value
+    // below the exact root, so the result only needs to be decremented
+    y = (y + value / y) >> 1u;
+    y = (y + value / y) >> 1u;
+    y = std::min<uint64_t>(y, UINT32_MAX);
+    while (y*y > value) { --y; }
+    return static_cast<uint32_t>(y);
+}
+
+/** Calculates the square root of a given unsigned 64-bit integer, rounded down.
+ * \note Proxy for an isqrt function pre-selected by the user. The table-seeded Newton iteration
+ *       isqrtnr is the default; the binary search isqrtbs can be selected explicitly by predefining
+ *       the FPM_USE_BINSEARCH_ISQRT symbol. Both return the same result. */
+#if defined FPM_USE_BINSEARCH_ISQRT
+constexpr
+uint32_t isqrt(uint64_t const value) noexcept { return isqrtbs(value); }
+#else
+constexpr
+uint32_t isqrt(uint64_t const value) noexcept { return isqrtnr(value); }
+#endif
+
 /** Calculates the cube root of a given unsigned 64-bit integer, rounded down.
  * Uses a hardware algorithm based on Hacker's Delight, 2nd ed.
- * and https://gist.github.com/anonymous/729557. */
+ * and https://gist.github.com/anonymous/729557.
+ * The iterations for the leading zero bits of the value are skipped, since they do not change the
+ * result. */
 constexpr
 uint32_t icbrt(uint64_t const value) noexcept {
+    if (value == 0u) { return 0u; }
     uint64_t x = value;
     uint32_t y = 0u;
-    for (int_fast32_t s = 63; s >= 0; s -= 3) {  // 22 iterations
+    // start at the highest multiple of 3 below the bit width of the value
+    int_fast32_t const sStart = (63 - std::countl_zero(value)) / 3 * 3;
+    for (int_fast32_t s = sStart; s >= 0; s -= 3) {  // at most 22 iterations
         y += y;
         uint64_t b = 3u*y*((uint64_t)y + 1u) + 1u;
         if ((x >> s) >= b) {
@@ -588,6 +1161,13 @@ concept SqType = requires (T t) {
 template< class T >
 concept SqOrQType = SqType<T> || QType<T>;
 
+/** Concept of a lazy expression of Sq values (see Expr). */
+template< class T >
+concept ExprType = requires {
+    { std::bool_constant<T::isExprType>() } -> std::same_as<std::true_type>;
+    typename T::node_t;
+};
+
 /** Concept of a valid (S)Q base type. The base type has to be a reasonably sized integral. */
 template< typename BaseT >
 concept ValidBaseType = (
@@ -617,8 +1197,9 @@ concept Similar = (
 template< typename BaseT, scaling_t f, double real >
 concept ScaledFitsBaseType = (
     // check if double is too large for 64-bit maximum supported calculation type
+    // note: the maximum is rounded up to the next power of 2 when converted to double, hence '<'
     ((real < 0. && real >= std::numeric_limits<fit_type_t<8u, std::is_signed_v<BaseT>>>::min() / v2s<f, double>(1))
-        || (real >= 0. && real <= std::numeric_limits<fit_type_t<8u, std::is_signed_v<BaseT>>>::max() / v2s<f, double>(1)))
+        || (real >= 0. && real < std::numeric_limits<fit_type_t<8u, std::is_signed_v<BaseT>>>::max() / v2s<f, double>(1)))
     // check whether scaled double fits base type
     && std::in_range<BaseT>(v2s<f, fit_type_t<8u, std::is_signed_v<BaseT>>>(real))
 );
@@ -634,6 +1215,18 @@ concept RealLimitsInRangeOfBaseType = (
     && realMin <= realMax
 );
 
+/** Concept of a valid value range of an intermediate calculation type, including the 128-bit
+ * extension types, when scaled with the given scaling factor.
+ * \note The check is conservative: the magnitude of the scaled limits must be smaller than the
+ * largest power of 2 that can be represented by the calculation type. */
+template< typename CalcT, scaling_t f, double realMin, double realMax >
+concept RealLimitsInRangeOfCalcType = (
+    realMin <= realMax
+    && (is_signed_v<CalcT> || 0. <= realMin)
+    && std::max(abs(realMin), abs(realMax)) * dpowi(2., f)
+        < dpowi(2., static_cast<int>(sizeof(CalcT) * CHAR_BIT) - (is_signed_v<CalcT> ? 1 : 0))
+);
+
 /** Concept of a constrained implementation type that gives a valid Q or Sq type. Used to check
  * an implementation type before a Sq or Q type is constructed.
  * \note If this fails, the ImplType does not exist, or the real value limits exceed the value
@@ -684,16 +1277,54 @@ concept Comparable = (
     && (std::is_signed_v<LhsT> == std::is_signed_v<RhsT> || sizeof(LhsT) > sizeof(RhsT))
 );
 
+/** \returns true if the given rounding mode can round a value to a multiple of the resolution
+ * beyond the limits of its value range, i.e. up beyond a positive maximum or down beyond a negative
+ * minimum which is not a multiple of the resolution (the scaled limits are truncated towards zero).
+ * This is the case for the modes which round to the nearest value.
+ * \note The native mode rounds down with shifts, so it cannot exceed a maximum. A negative value
+ * can be shifted below a minimum by less than one resolution step, which is not accounted for so
+ * that the value ranges of the default mode are not affected. */
+consteval
+bool roundsBeyondLimits(Rounding rnd) noexcept {
+    return rnd == Rounding::nearest || rnd == Rounding::convergent;
+}
+
+/** \returns the given real minimum, rounded down to the resolution 2^(-f) if a value which is
+ * rounded to this resolution with the given rounding mode can fall below it. */
+consteval
+double roundedMin(double realMin, scaling_t f, Rounding rnd) noexcept {
+    double const scaled = realMin * dpowi(2., f);
+    if (!roundsBeyondLimits(rnd) || scaled >= 0. || scaled <= -0x1p52) { return realMin; }  // larger doubles have no fraction
+    return floor(scaled) / dpowi(2., f);
+}
+
+/** \returns the given real maximum, rounded up to the resolution 2^(-f) if a value which is
+ * rounded to this resolution with the given rounding mode can exceed it. */
+consteval
+double roundedMax(double realMax, scaling_t f, Rounding rnd) noexcept {
+    double const scaled = realMax * dpowi(2., f);
+    if (!roundsBeyondLimits(rnd) || scaled <= 0. || scaled >= 0x1p52) { return realMax; }  // larger doubles have no fraction
+    return ceil(scaled) / dpowi(2., f);
+}
+
+/** Minimum and maximum real value of a value of the (S)Q type From after the conversion to the
+ * scaling and rounding mode of the (S)Q type To. Only a down-scaling is rounded. */
+template< class From, class To >
+constexpr double convertedMin = (From::f > To::f) ? roundedMin(From::realMin, To::f, To::rounding) : From::realMin;
+template< class From, class To >
+constexpr double convertedMax = (From::f > To::f) ? roundedMax(From::realMax, To::f, To::rounding) : From::realMax;
+
 /** Concept: Checks whether From can be converted implicitly to To. This is possible when the
- * base type is the same, scaling is possible and the value range of From is fully within the
- * value range of To, or if the target type is a Q type without overflow checks. */
+ * base type is the same, scaling is possible and the value range of From, rounded to the scaling
+ * of To, is fully within the value range of To, or if the target type is a Q type without
+ * overflow checks. */
 template< class From, class To >
 concept ImplicitlyConvertible = (
     SqOrQType<From> && SqOrQType<To>
     && std::is_same_v<typename From::base_t, typename To::base_t>
     && Scalable<typename From::base_t, From::f, typename To::base_t, To::f>
     && ((QType<To> && !is_ovf_stricter_v<To::ovfBx, Ovf::unchecked>)
-        || (To::realMin <= From::realMin && From::realMax <= To::realMax))
+        || (To::realMin <= convertedMin<From, To> && convertedMax<From, To> <= To::realMax))
 );
 
 /** Concept: Checks whether a value of the given type SqV can be clamped to a value range between
@@ -708,13 +1339,13 @@ concept Clampable = (
 );
 
 /** Concept: Checks whether casting of From to To is possible without an overflow check. This is
- * possible if scaling is possible and the value range of the source type is fully within the
- * range of the target type. */
+ * possible if scaling is possible and the value range of the source type, rounded to the scaling
+ * of the target type, is fully within the range of the target type. */
 template< class From, class To >
 concept CastableWithoutChecks = (
     SqOrQType<From> && SqOrQType<To>
     && Scalable<typename From::base_t, From::f, typename To::base_t, To::f>
-    && To::realMin <= From::realMin && From::realMax <= To::realMax
+    && To::realMin <= convertedMin<From, To> && convertedMax<From, To> <= To::realMax
 );
 
 /** Concept: Checks whether the absolute value can be taken for a value of the given base type.
@@ -734,6 +1365,26 @@ concept CanBeUsedAsDivisor = (
     T::realMax <= -1. || +1. <= T::realMin
 );
 
+/** Concept: Checks whether a lookup table with N segments can be generated for the given input
+ * and output (S)Q types. This is possible if N is a power of 2 and the sizes of both base types do
+ * not exceed 4 bytes. */
+template< typename TIn, typename TOut, std::size_t N >
+concept CanBeUsedInLut = (
+    std::has_single_bit(N)
+    && sizeof(typename TIn::base_t) <= sizeof(int32_t)
+    && sizeof(typename TOut::base_t) <= sizeof(int32_t)
+);
+
+/** Concept: Checks whether a piecewise-linear function with the given number of knots can be
+ * defined for the given input and output (S)Q types. This is possible if there are at least 2
+ * knots and the sizes of both base types do not exceed 4 bytes. */
+template< typename TX, typename TY, std::size_t nKnots >
+concept CanBeUsedInPwl = (
+    nKnots >= 2u
+    && sizeof(typename TX::base_t) <= sizeof(int32_t)
+    && sizeof(typename TY::base_t) <= sizeof(int32_t)
+);
+
 /** Concept: Checks whether the given (S)Q type can be used as divisor in a remainder-division
  * (modulus). This is possible as long as the given type doesn't have parts of
  * -resolution > x < +resolution in its range to prevent a modulo zero. */
@@ -772,6 +1423,17 @@ concept CanBePassedToCbrt = (
     && T::realMin >= 0.
 );
 
+/** Concept: Checks whether the given (S)Q type can be passed to the rcbrt function. This is
+ * possible as long as the size of the base type does not exceed 4 bytes, the scaling is not too
+ * large and the minimum value is equal to or larger than the resolution. */
+template< typename T >
+concept CanBePassedToRCbrt = (
+    sizeof(typename T::base_t) <= sizeof(int32_t)
+    && T::f <= 16  // limit scaling to prevent overflow
+    && T::f < std::numeric_limits<typename T::base_t>::digits  // lower and upper limits are out of range for f == digits
+    && T::realMin >= T::resolution
+);
+
 /** Concept that defines the requirements for a valid Q type. */
 template< typename BaseT, scaling_t f, double realMin, double realMax, Overflow ovfBx >
 concept QRequirements = (
@@ -791,6 +1453,167 @@ concept SqRequirements = (
 }  // namespace detail
 
 
+/** \returns the site of the last overflow detected by a runtime check with Ovf::assert. Can be
+ * called by ovfAssertTrap() to report where and why the check failed.
+ * \note Values of 64-bit unsigned types above INTMAX_MAX and of 128-bit intermediate types are
+ * converted to intmax_t, i.e. truncated. */
+inline
+OvfSite const & ovfAssertSite() noexcept { return detail::ovfSite; }
+
+/** \returns the overflow telemetry of the given (S)Q type. All types with the same base type,
+ * scaling and real value range share their telemetry.
+ * \note If the telemetry is disabled, the count is always 0. */
+template< detail::SqOrQType QSq >
+OvfTelemetryEntry ovfTelemetryOf() noexcept {
+    using base_t = typename QSq::base_t;
+    OvfTelemetryEntry entry{ sizeof(base_t), std::is_signed_v<base_t>, QSq::f, QSq::realMin, QSq::realMax,
+                             0u, std::numeric_limits<intmax_t>::max(), std::numeric_limits<intmax_t>::min() };
+#if defined FPM_OVF_TELEMETRY
+    auto const &record = detail::OvfTelemetry< detail::OvfKey<base_t, QSq::f, QSq::realMin, QSq::realMax> >::record;
+    entry.count = record.count.load(std::memory_order_relaxed);
+    entry.min = record.min.load(std::memory_order_relaxed);
+    entry.max = record.max.load(std::memory_order_relaxed);
+#endif
+    return entry;
+}
+
+/** Calls the given function with a snapshot (OvfTelemetryEntry) of the overflow telemetry of each
+ * type for which an overflow was recorded, e.g. to export it. Lock-free; can be called at any time.
+ * \note If the telemetry is disabled, the function is never called. */
+template< /* deduced: */ typename Fn >
+requires std::invocable<Fn &, OvfTelemetryEntry const &>
+void ovfTelemetryForEach([[maybe_unused]] Fn &&fn) {
+#if defined FPM_OVF_TELEMETRY
+    for (auto const *record = detail::ovfTelemetryHead.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        OvfTelemetryEntry const entry{ record->baseSize, record->isSigned, record->f, record->realMin, record->realMax,
+                                       record->count.load(std::memory_order_relaxed),
+                                       record->min.load(std::memory_order_relaxed),
+                                       record->max.load(std::memory_order_relaxed) };
+        fn(entry);
+    }
+#endif
+}
+
+/** Resets the counters and the observed extreme values of the overflow telemetry of all types.
+ * The types remain registered. */
+inline
+void ovfTelemetryReset() noexcept {
+#if defined FPM_OVF_TELEMETRY
+    for (auto *record = detail::ovfTelemetryHead.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        record->count.store(0u, std::memory_order_relaxed);
+        record->min.store(std::numeric_limits<intmax_t>::max(), std::memory_order_relaxed);
+        record->max.store(std::numeric_limits<intmax_t>::min(), std::memory_order_relaxed);
+    }
+#endif
+}
+
+/** \returns the narrowest Q type which holds all values of the given range profile: the smallest
+ * base type of the same signedness in which the observed range fits at the used resolution, and
+ * the largest scaling (up to the profiled one) for which the range still fits. The scaling stays
+ * within the range of the predefined type aliases.
+ * \note If no narrower base type fits, the base type of the profiled type is returned. */
+inline
+RangeProfileRecommendation rangeProfileRecommendation(RangeProfileEntry const &entry) noexcept {
+    RangeProfileRecommendation rec{ entry.baseSize, entry.f,
+                                    std::ldexp(static_cast<double>(entry.min), -entry.f),
+                                    std::ldexp(static_cast<double>(entry.max), -entry.f) };
+    if (entry.count == 0u) { return rec; }
+
+    // magnitude of the largest value at the used resolution
+    auto const magnitude = [](intmax_t v) { return (v < 0) ? uintmax_t(0) - static_cast<uintmax_t>(v) : static_cast<uintmax_t>(v); };
+    uintmax_t const m = std::max(magnitude(entry.min), magnitude(entry.max)) >> (entry.f - entry.fUsed);
+    int const usedBits = static_cast<int>( std::bit_width(m) );
+
+    for (std::size_t size = 1u; size < entry.baseSize; size *= 2u) {
+        int const digits = static_cast<int>(size) * CHAR_BIT - (entry.isSigned ? 1 : 0);
+        int const fMinAlias = -static_cast<int>(size) * CHAR_BIT / 2;
+        int const fMaxAlias = std::min(static_cast<int>(size) * CHAR_BIT - 1, 53);
+        scaling_t const f = std::min({ entry.f, entry.fUsed + (digits - usedBits), fMaxAlias });
+        if (usedBits <= digits && entry.fUsed <= f && fMinAlias <= f) {
+            rec.baseSize = size;
+            rec.f = f;
+            break;
+        }
+    }
+    return rec;
+}
+
+/** Calls the given function with a snapshot (RangeProfileEntry) of the range profile of each Q type
+ * for which a value was recorded. Lock-free; can be called at any time.
+ * \note If the range profiler is disabled, the function is never called. */
+template< /* deduced: */ typename Fn >
+requires std::invocable<Fn &, RangeProfileEntry const &>
+void rangeProfileForEach([[maybe_unused]] Fn &&fn) {
+#if defined FPM_RANGE_PROFILER
+    for (auto const *record = detail::rangeProfileHead.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        fn( detail::rangeProfileEntryOf(*record) );
+    }
+#endif
+}
+
+/** \returns the range profile of the given Q type.
+ * \note If the range profiler is disabled, the count is always 0. */
+template< detail::SqOrQType QSq >
+RangeProfileEntry rangeProfileOf() noexcept {
+#if defined FPM_RANGE_PROFILER
+    return detail::rangeProfileEntryOf(
+        detail::RangeProfile<typename QSq::base_t, QSq::f, QSq::realMin, QSq::realMax>::record );
+#else
+    return RangeProfileEntry{ sizeof(typename QSq::base_t), std::is_signed_v<typename QSq::base_t>, QSq::f,
+                              QSq::realMin, QSq::realMax, 0u, std::numeric_limits<intmax_t>::max(),
+                              std::numeric_limits<intmax_t>::min(), QSq::f };
+#endif
+}
+
+#if defined FPM_RANGE_PROFILER
+namespace detail {
+    /** Writes the given real limit so that it can be used as template argument (e.g. "20."). */
+    inline
+    void printLimit(std::FILE *out, double limit) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.17g", limit);
+        bool const isIntegral = std::strpbrk(buffer, ".eEn") == nullptr;
+        std::fprintf(out, "%s%s", buffer, isIntegral ? "." : "");
+    }
+
+    /** Writes the name of the Q type alias with the given properties (e.g. "i16q10<-20., 20.>"). */
+    inline
+    void printQType(std::FILE *out, std::size_t baseSize, bool isSigned, scaling_t f, double realMin, double realMax) {
+        std::fprintf(out, "%c%zuq%s%d<", isSigned ? 'i' : 'u', baseSize * CHAR_BIT, (f < 0) ? "m" : "", (f < 0) ? -f : f);
+        printLimit(out, realMin);
+        std::fprintf(out, ", ");
+        printLimit(out, realMax);
+        std::fprintf(out, ">");
+    }
+}
+
+/** Writes a report of the range profile of all Q types with recorded values to the given stream:
+ * per type the number of values, the observed range and the used resolution, and the narrowest
+ * Q type which holds all observed values. Also called automatically at program exit (stderr). */
+inline
+void rangeProfileReport(std::FILE *out = stderr) {
+    std::fprintf(out, "fpm range profile:\n");
+    rangeProfileForEach([out](RangeProfileEntry const &entry) {
+        RangeProfileRecommendation const rec = rangeProfileRecommendation(entry);
+        std::fprintf(out, "  ");
+        detail::printQType(out, entry.baseSize, entry.isSigned, entry.f, entry.realMin, entry.realMax);
+        std::fprintf(out, ": %llu values in [%.17g, %.17g], resolution 2^%d -> ",
+                     static_cast<unsigned long long>(entry.count), rec.realMin, rec.realMax, -entry.fUsed);
+        detail::printQType(out, rec.baseSize, entry.isSigned, rec.f, rec.realMin, rec.realMax);
+        std::fprintf(out, "%s\n", (rec.baseSize < entry.baseSize) ? "" : " (no narrower base type)");
+    });
+}
+
+namespace detail {
+    /// Writes the range profile report at program exit.
+    struct RangeProfileReportAtExit {
+        ~RangeProfileReportAtExit() { rangeProfileReport(stderr); }
+    };
+    inline RangeProfileReportAtExit rangeProfileReportAtExit{};
+}
+#endif
+
+
 /** Static assertion of the base type of the given Sq (or Q) type. */
 template< std::integral ExpectedBase, detail::SqOrQType QSq >
 consteval
@@ -0,0 +1,164 @@
+/** \file
+ * Declaration of the Lut type, an interpolated lookup table of a function that is generated at
+ * compile-time.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_LUT_HPP_2F8C5A13_6D7E_4B90_9E41_C3A7B05D8E62
+#define FPM_FPM_LUT_HPP_2F8C5A13_6D7E_4B90_9E41_C3A7B05D8E62
+
+#include "q.hpp"
+
+
+namespace fpm::sq {
+/** \ingroup grp_fpmSq
+ * \{ */
+
+using fpm::detail::SqType;
+using fpm::detail::QType;
+
+
+/// Lookup table of the function fn: SqIn -> SqOut with N segments of equal width. The callable fn
+/// takes and returns a double; it is evaluated at compile-time at the N+1 borders of the segments,
+/// and the results are stored as scaled values of SqOut in a constexpr array. A lookup computes the
+/// segment index with a shift and interpolates linearly between the two borders of the segment,
+/// with integer operations only.
+/// \note The width of a segment is a power of 2 of the input resolution, thus the last segment can
+/// reach beyond SqIn::realMax; fn is evaluated at its border anyway. Borders beyond SqIn::realMax
+/// are limited to the range of SqOut; the values of the borders within the range of SqIn must be
+/// within the range of SqOut, which is checked at compile-time. Since the interpolated value is between
+/// two borders, the result is always within the range of SqOut.
+template< SqType SqIn, SqType SqOut, std::size_t N, auto fn >
+requires fpm::detail::CanBeUsedInLut<SqIn, SqOut, N>
+class Lut final {
+public:
+    using in_t = SqIn;                          ///< Sq type of the input
+    using out_t = SqOut;                        ///< Sq type of the output
+    static constexpr std::size_t segments = N;  ///< number of segments
+
+private:
+    using out_base_t = typename SqOut::base_t;
+
+    /// Span of the scaled input range.
+    static constexpr uint64_t SPAN = static_cast<uint64_t>(
+        static_cast<int64_t>(SqIn::scaledMax) - static_cast<int64_t>(SqIn::scaledMin) );
+    /// Number of bits of the width of a segment; the smallest value for which N segments cover the span.
+    static constexpr int SEGMENT_BITS = []() consteval {
+        int bits = 0;
+        while ((static_cast<uint64_t>(N) << bits) < SPAN) { ++bits; }
+        return bits;
+    }();
+    /// Number of bits of the fraction of a segment for the interpolation; limited such that the
+    /// product of the fraction and the difference of two borders fits into int64_t.
+    static constexpr int FRAC_BITS = std::min(SEGMENT_BITS, 62 - 1 - static_cast<int>(sizeof(out_base_t) * CHAR_BIT));
+
+    /// \returns the real input value at the given border.
+    static consteval
+    double borderOf(std::size_t i) noexcept {
+        return static_cast<double>( static_cast<int64_t>(SqIn::scaledMin) + (static_cast<int64_t>(i) << SEGMENT_BITS) ) / v2s<SqIn::f, double>(1);
+    }
+
+    /// \returns the scaled values of fn at the borders of the segments, limited to the range of SqOut.
+    static consteval
+    std::array<out_base_t, N + 2u> makeTable() noexcept {
+        std::array<out_base_t, N + 2u> values{};
+        for (std::size_t i = 0u; i <= N; ++i) {
+            double const scaled = static_cast<double>( fn(borderOf(i)) ) * v2s<SqOut::f, double>(1);
+            values[i] = static_cast<out_base_t>( std::clamp( scaled + (scaled < 0. ? -0.5 : 0.5),
+                static_cast<double>(SqOut::scaledMin), static_cast<double>(SqOut::scaledMax) ) );
+        }
+        values[N + 1u] = values[N];
+        return values;
+    }
+
+    /// \returns whether the values of fn at the borders within the range of SqIn are within the
+    /// range of SqOut.
+    static consteval
+    bool isInRange() noexcept {
+        for (std::size_t i = 0u; i <= N && borderOf(i) <= SqIn::realMax; ++i) {
+            auto const y = static_cast<double>( fn(borderOf(i)) );
+            if (y < SqOut::realMin || y > SqOut::realMax) { return false; }
+        }
+        return true;
+    }
+    static_assert(isInRange(), "fn exceeds the range of SqOut within the range of SqIn");
+
+public:
+    /// Scaled values of fn at the borders of the segments. The last border is repeated to allow
+    /// the interpolation at the maximum of the input range without a branch.
+    static constexpr std::array<out_base_t, N + 2u> table = makeTable();
+
+    /// Size of the table in bytes.
+    static constexpr std::size_t size = sizeof(table);
+
+private:
+    /// Interpolates the scaled output value at the given offset from the scaled input minimum.
+    static constexpr
+    out_base_t interpolate(uint64_t offset) noexcept {
+        auto const index = static_cast<std::size_t>(offset >> SEGMENT_BITS);
+        auto const y0 = static_cast<int64_t>(table[index]);
+        if constexpr (FRAC_BITS == 0) { return static_cast<out_base_t>(y0); }
+        else {
+            auto const y1 = static_cast<int64_t>(table[index + 1u]);
+            auto const fraction = static_cast<int64_t>( (offset & ((uint64_t(1) << SEGMENT_BITS) - 1u)) >> (SEGMENT_BITS - FRAC_BITS) );
+            return static_cast<out_base_t>( y0 + (((y1 - y0) * fraction + (int64_t(1) << (FRAC_BITS - 1))) >> FRAC_BITS) );
+        }
+    }
+
+    /// \returns the largest deviation of the interpolated value from fn at the borders and at 7
+    /// equidistant points within each segment.
+    static consteval
+    double estimateMaxError() noexcept {
+        constexpr uint64_t samples = std::min(uint64_t(8), uint64_t(1) << SEGMENT_BITS);
+        double error = 0.;
+        for (uint64_t i = 0u; i <= N; ++i) {
+            for (uint64_t j = 0u; j < samples; ++j) {
+                uint64_t const offset = (i << SEGMENT_BITS) + (j << SEGMENT_BITS) / samples;
+                if (offset > SPAN) { break; }
+                double const x = static_cast<double>( static_cast<int64_t>(SqIn::scaledMin) + static_cast<int64_t>(offset) ) / v2s<SqIn::f, double>(1);
+                double const y = static_cast<double>(interpolate(offset)) / v2s<SqOut::f, double>(1);
+                error = std::max(error, fpm::detail::abs( y - static_cast<double>(fn(x)) ));
+            }
+        }
+        return error;
+    }
+
+public:
+    /// Largest deviation of the interpolated value from fn in real units, estimated at compile-time
+    /// from the borders and 7 equidistant points within each segment. Includes the rounding to the
+    /// resolution of SqOut.
+    static constexpr double maxError = estimateMaxError();
+
+    /// Looks up the interpolated value of fn at the given input value.
+    /// \returns the value, wrapped into SqOut.
+    constexpr
+    SqOut operator()(SqIn const &x) const noexcept {
+        return SqOut( interpolate( static_cast<uint64_t>( static_cast<int64_t>(x.value) - static_cast<int64_t>(SqIn::scaledMin) ) ) );
+    }
+
+    /// Looks up the interpolated value of fn at the given Q value, which must have the same base
+    /// type, scaling and range as SqIn.
+    /// \returns the value, wrapped into SqOut.
+    template< /* deduced: */ QType QIn >
+    requires std::same_as< decltype( std::declval<QIn const &>().toSq() ), SqIn >
+    constexpr
+    SqOut operator()(QIn const &x) const noexcept { return (*this)( x.toSq() ); }
+};
+
+/**\}*/
+}  // namespace fpm::sq
+
+
+#endif
+// EOF
@@ -0,0 +1,164 @@
+/** \file
+ * Compile-time helpers of the polynomial evaluation of the Sq type.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_POLY_HPP_4D8A2C61_7E3B_4F19_A6C0_95B1E8D2F347
+#define FPM_FPM_POLY_HPP_4D8A2C61_7E3B_4F19_A6C0_95B1E8D2F347
+
+#include "fpm.hpp"
+#include <array>
+#include <utility>
+
+
+namespace fpm::detail {
+
+/// Coefficients c0, c1, ..., cn of a polynomial c0 + c1*x + ... + cn*x^n.
+template< std::size_t N >
+using poly_coeffs_t = std::array<double, N>;
+
+/** \returns the value of the given polynomial at x, evaluated with Horner's scheme. */
+template< std::size_t N >
+consteval
+double polyEval(poly_coeffs_t<N> const &c, double x) noexcept {
+    double value = 0.;
+    for (std::size_t k = N; k > 0u; --k) { value = value * x + c[k - 1u]; }
+    return value;
+}
+
+/** \returns the coefficients of the derivative of the given polynomial. The highest coefficient
+ * is 0. */
+template< std::size_t N >
+consteval
+poly_coeffs_t<N> polyDerivative(poly_coeffs_t<N> const &c) noexcept {
+    poly_coeffs_t<N> d{};
+    for (std::size_t k = 1u; k < N; ++k) { d[k - 1u] = static_cast<double>(k) * c[k]; }
+    return d;
+}
+
+/** Finds the roots of the given polynomial of the given degree within the open interval (lo, hi).
+ * The roots of the derivative split the interval into segments on which the polynomial is
+ * monotonic; each segment with a sign change contains exactly one root, which is found by
+ * bisection.
+ * \returns the number of roots, which are stored in ascending order in the given array. */
+template< std::size_t N >
+consteval
+std::size_t polyRoots(poly_coeffs_t<N> const &c, std::size_t degree, double lo, double hi,
+                      poly_coeffs_t<N> &roots) noexcept {
+    if (degree == 0u) { return 0u; }
+    poly_coeffs_t<N> critical{};
+    std::size_t const nCritical = polyRoots(polyDerivative(c), degree - 1u, lo, hi, critical);
+    std::size_t nRoots = 0u;
+    double a = lo;
+    for (std::size_t i = 0u; i <= nCritical; ++i) {
+        double const b = (i < nCritical) ? critical[i] : hi;
+        double fa = polyEval(c, a), fb = polyEval(c, b);
+        if ((fa < 0. && fb > 0.) || (fa > 0. && fb < 0.)) {
+            double l = a, h = b;
+            for (int iteration = 0; iteration < 200 && l < h; ++iteration) {
+                double const m = l + (h - l) / 2.;
+                if (m <= l || m >= h) { break; }
+                double const fm = polyEval(c, m);
+                if ((fm < 0.) == (fa < 0.)) { l = m; fa = fm; }
+                else { h = m; }
+            }
+            roots[nRoots++] = l + (h - l) / 2.;
+        }
+        else if (fb == 0. && b < hi) { roots[nRoots++] = b; }
+        a = b;
+    }
+    return nRoots;
+}
+
+/** \returns the minimum and the maximum of the given polynomial within the interval [lo, hi],
+ * i.e. the extremes of the values at the limits and at the roots of the derivative. */
+template< std::size_t N >
+consteval
+std::pair<double, double> polyRange(poly_coeffs_t<N> const &c, double lo, double hi) noexcept {
+    poly_coeffs_t<N> critical{};
+    std::size_t const nCritical = (N > 1u) ? polyRoots(polyDerivative(c), N - 2u, lo, hi, critical) : 0u;
+    double min = std::min(polyEval(c, lo), polyEval(c, hi));
+    double max = std::max(polyEval(c, lo), polyEval(c, hi));
+    for (std::size_t i = 0u; i < nCritical; ++i) {
+        min = std::min(min, polyEval(c, critical[i]));
+        max = std::max(max, polyEval(c, critical[i]));
+    }
+    return { min, max };
+}
+
+/** Calculates upper bounds of the magnitudes of the intermediate values of Horner's scheme
+ * P_n = c_n, P_k = c_k + x * P_(k+1) with interval arithmetic, for x within [lo, hi].
+ * \returns the bound of max(|P_k|, |x * P_(k+1)|) for each step k. */
+template< std::size_t N >
+consteval
+poly_coeffs_t<N> polyStepBounds(poly_coeffs_t<N> const &c, double lo, double hi) noexcept {
+    poly_coeffs_t<N> bounds{};
+    double pLo = c[N - 1u], pHi = c[N - 1u];
+    bounds[N - 1u] = std::max(abs(pLo), abs(pHi));
+    for (std::size_t k = N - 1u; k > 0u; --k) {
+        double const p1 = lo * pLo, p2 = lo * pHi, p3 = hi * pLo, p4 = hi * pHi;
+        double const xpLo = std::min(std::min(p1, p2), std::min(p3, p4));
+        double const xpHi = std::max(std::max(p1, p2), std::max(p3, p4));
+        pLo = xpLo + c[k - 1u];
+        pHi = xpHi + c[k - 1u];
+        bounds[k - 1u] = std::max(std::max(abs(xpLo), abs(xpHi)), std::max(abs(pLo), abs(pHi)));
+    }
+    return bounds;
+}
+
+/** \returns the smallest integer e with 2^e >= the given positive number. */
+consteval
+int ceilLog2(double number) noexcept {
+    int e = 0;
+    while (number > 1.) { number /= 2.; ++e; }
+    while (number <= 0.5) { number *= 2.; --e; }
+    return e;
+}
+
+/** Determines the additional scaling fc of the coefficients for the evaluation of a polynomial
+ * of an Sq value with scaling f in an integer with the given number of bits. In step k of
+ * Horner's scheme, the intermediate value is scaled by 2^(fc + (n-k)*f), thus the products need
+ * no rescaling. fc is the largest value for which all intermediate values fit into the integer
+ * with one bit of headroom, and for which the final shift does not exceed the integer.
+ * \returns fc; may be negative if the intermediate values do not fit at all. */
+template< std::size_t N >
+consteval
+int polyCoeffScaling(poly_coeffs_t<N> const &c, double lo, double hi, scaling_t f, int bits) noexcept {
+    constexpr int n = static_cast<int>(N) - 1;
+    poly_coeffs_t<N> const bounds = polyStepBounds(c, lo, hi);
+    int fc = bits - 2 - (n - 1) * f;  // final shift: fc + n*f - f <= bits - 2
+    for (int k = 0; k <= n; ++k) {
+        if (bounds[k] > 0.) {
+            fc = std::min(fc, bits - 2 - ceilLog2(bounds[k]) - (n - k) * f);
+        }
+    }
+    return fc;
+}
+
+/** \returns the smallest scaling fc of the coefficients for which the accumulated rounding errors
+ * of the scaled coefficients stay below half a resolution step 2^-f of the result:
+ * (n+1) * 2^-(fc+1) * max(1, |x|)^n <= 2^-(f+1). */
+template< std::size_t N >
+consteval
+int polyCoeffScalingNeeded(double lo, double hi, scaling_t f) noexcept {
+    constexpr int n = static_cast<int>(N) - 1;
+    double const xMax = std::max(1., std::max(abs(lo), abs(hi)));
+    return f + ceilLog2(static_cast<double>(n + 1)) + n * ceilLog2(xMax);
+}
+
+}  // namespace fpm::detail
+
+
+#endif
+// EOF
@@ -0,0 +1,156 @@
+/** \file
+ * Declaration of the Pwl type, a piecewise-linear function with non-uniform breakpoints.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_PWL_HPP_8E1B4D97_3A2C_4F6E_B7D0_1C9E5A6F2B34
+#define FPM_FPM_PWL_HPP_8E1B4D97_3A2C_4F6E_B7D0_1C9E5A6F2B34
+
+#include "q.hpp"
+
+
+namespace fpm::sq {
+/** \ingroup grp_fpmSq
+ * \{ */
+
+using fpm::detail::SqType;
+using fpm::detail::QType;
+
+
+/// Piecewise-linear function SqX -> SqY, defined by knots (breakpoints) with strictly increasing
+/// x values, e.g. Pwl<SqX, SqY, Knot{0., 0.}, Knot{0.1, 0.5}, Knot{1., 1.}>. The knots are stored
+/// as scaled values, and the slope of each segment is precomputed as fixed-point value, so an
+/// evaluation consists of a segment lookup, one multiplication and one addition, without division.
+/// The segment is found by counting the knots below the input for up to 16 knots, which can be
+/// vectorized, and with a branch-free binary search for more knots.
+/// \note Inputs outside of the knots are limited to the first and the last knot, respectively.
+/// The slopes are rounded towards zero, thus the result is always between the values of the two
+/// knots of the segment, and it is exact at the knots. The deviation from the exact interpolation
+/// is at most one resolution step of SqY, plus (x - x[i]) * 2^-SLOPE_F in scaled units.
+template< SqType SqX, SqType SqY, Knot... knots >
+requires fpm::detail::CanBeUsedInPwl<SqX, SqY, sizeof...(knots)>
+class Pwl final {
+public:
+    using x_t = SqX;                                        ///< Sq type of the input
+    using y_t = SqY;                                        ///< Sq type of the output
+    static constexpr std::size_t nKnots = sizeof...(knots);  ///< number of knots
+
+private:
+    using x_base_t = typename SqX::base_t;
+    using y_base_t = typename SqY::base_t;
+    static constexpr std::size_t N_SEGMENTS = nKnots - 1u;
+
+    static constexpr std::array<Knot, nKnots> REAL_KNOTS{ knots... };
+    static_assert(std::adjacent_find(REAL_KNOTS.begin(), REAL_KNOTS.end(), [](Knot const &a, Knot const &b) { return a.x >= b.x; }) == REAL_KNOTS.end(),
+        "The x values of the knots must be strictly increasing");
+    static_assert(std::all_of(REAL_KNOTS.begin(), REAL_KNOTS.end(), [](Knot const &k) {
+                      return SqX::realMin <= k.x && k.x <= SqX::realMax && SqY::realMin <= k.y && k.y <= SqY::realMax; }),
+        "The knots must be within the ranges of SqX and SqY");
+
+public:
+    /// Scaled x values of the knots.
+    static constexpr std::array<x_base_t, nKnots> xs{ fpm::scaled<SqX::f, x_base_t>(knots.x)... };
+    /// Scaled y values of the knots.
+    static constexpr std::array<y_base_t, nKnots> ys{ fpm::scaled<SqY::f, y_base_t>(knots.y)... };
+
+private:
+    /// \returns the largest magnitude of the scaled y difference of a segment.
+    static consteval
+    int64_t maxYDelta() noexcept {
+        int64_t max = 1;
+        for (std::size_t i = 0u; i < N_SEGMENTS; ++i) {
+            max = std::max(max, fpm::detail::abs( static_cast<int64_t>(ys[i + 1u]) - static_cast<int64_t>(ys[i]) ));
+        }
+        return max;
+    }
+
+public:
+    /// Scaling of the slopes; the largest value for which the product of a slope and an x
+    /// difference within its segment fits into int64_t.
+    static constexpr int SLOPE_F = 62 - static_cast<int>( std::bit_width( static_cast<uint64_t>(maxYDelta()) ) );
+
+private:
+    /// \returns the slopes of the segments, scaled by 2^SLOPE_F and rounded towards zero. The last
+    /// knot is treated as segment with slope 0, so that the last knot is exact.
+    static consteval
+    std::array<int64_t, nKnots> makeSlopes() noexcept {
+        std::array<int64_t, nKnots> slopes{};
+        for (std::size_t i = 0u; i < N_SEGMENTS; ++i) {
+            int64_t const dy = static_cast<int64_t>(ys[i + 1u]) - static_cast<int64_t>(ys[i]);
+            int64_t const dx = static_cast<int64_t>(xs[i + 1u]) - static_cast<int64_t>(xs[i]);
+            slopes[i] = (dy * (int64_t(1) << SLOPE_F)) / dx;
+        }
+        return slopes;
+    }
+
+public:
+    /// Slopes of the segments, i.e. (y[i+1] - y[i]) / (x[i+1] - x[i]) in scaled units, scaled by
+    /// 2^SLOPE_F. The last entry belongs to the last knot and is 0.
+    static constexpr std::array<int64_t, nKnots> slopes = makeSlopes();
+
+private:
+    /// \returns the index of the segment of the given scaled x value, which is within the knots.
+    static constexpr
+    std::size_t segmentOf(x_base_t xv) noexcept {
+        if constexpr (nKnots <= 16u) {
+            // count the knots after the first one which are not larger than x
+            std::size_t index = 0u;
+            FPM_SIMD_LOOP
+            for (std::size_t i = 1u; i < nKnots; ++i) {
+                index += static_cast<std::size_t>(xs[i] <= xv);
+            }
+            return index;
+        }
+        else {
+            // branch-free binary search for the last knot which is not larger than x
+            std::size_t base = 0u, length = nKnots;
+            while (length > 1u) {
+                std::size_t const half = length / 2u;
+                base = (xs[base + half] <= xv) ? base + half : base;
+                length -= half;
+            }
+            return base;
+        }
+    }
+
+public:
+    /// Evaluates the piecewise-linear function at the given input value.
+    /// \returns the value, wrapped into SqY.
+    constexpr
+    SqY operator()(SqX const &x) const noexcept {
+        x_base_t xv = x.value;
+        if constexpr (SqX::scaledMin < xs.front()) { xv = std::max(xv, xs.front()); }
+        if constexpr (SqX::scaledMax > xs.back()) { xv = std::min(xv, xs.back()); }
+        std::size_t const i = segmentOf(xv);
+        // y <=> [ y[i] + ((x - x[i]) * slope[i] * 2^SLOPE_F) / 2^SLOPE_F ]
+        int64_t const dx = static_cast<int64_t>(xv) - static_cast<int64_t>(xs[i]);
+        int64_t const dy = (dx * slopes[i] + (int64_t(1) << (SLOPE_F - 1))) >> SLOPE_F;
+        return SqY( static_cast<y_base_t>( static_cast<int64_t>(ys[i]) + dy ) );
+    }
+
+    /// Evaluates the piecewise-linear function at the given Q value, which must have the same
+    /// base type, scaling and range as SqX.
+    /// \returns the value, wrapped into SqY.
+    template< /* deduced: */ QType QX >
+    requires std::same_as< decltype( std::declval<QX const &>().toSq() ), SqX >
+    constexpr
+    SqY operator()(QX const &x) const noexcept { return (*this)( x.toSq() ); }
+};
+
+/**\}*/
+}  // namespace fpm::sq
+
+
+#endif
+// EOF
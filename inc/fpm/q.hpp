@@ -18,6 +18,7 @@
 #define FPM_FPM_Q_HPP_D7920966_3ECD_4275_96CB_7B5D755A3B18
 
 #include "sq.hpp"
+#include <span>
 
 
 namespace fpm::q {
@@ -47,7 +48,8 @@ template<
     scaling_t f_,         ///< number of fraction bits (precision 2^(-f))
     double realMin_ = fpm::detail::realMin<BaseT, f_>(),  ///< minimum real value represented by the type
     double realMax_ = fpm::detail::realMax<BaseT, f_>(),  ///< maximum real value represented by the type
-    Overflow ovfBx_ = Overflow::error >  ///< overflow behavior
+    Overflow ovfBx_ = Overflow::error,                    ///< overflow behavior
+    Rounding rnd_ = fpm::detail::DEFAULT_ROUNDING >       ///< rounding mode of down-scalings
 requires fpm::detail::QRequirements<BaseT, f_, realMin_, realMax_, ovfBx_>
 class Q final {
 public:
@@ -57,20 +59,21 @@ public:
     static constexpr double realMin = realMin_;  ///< minimum real value
     static constexpr double realMax = realMax_;  ///< maximum real value
     static constexpr Overflow ovfBx = ovfBx_;    ///< overflow behavior
+    static constexpr Rounding rounding = rnd_;   ///< rounding mode of down-scalings
     static constexpr base_t scaledMin = fpm::scaled<f, base_t>(realMin_);  ///< minimum value of scaled integer value range
     static constexpr base_t scaledMax = fpm::scaled<f, base_t>(realMax_);  ///< maximum value of scaled integer value range
     static constexpr double resolution = fpm::detail::resolution<f>();     ///< real resolution
 
-    /// Corresponding (related) Sq type.
+    /// Corresponding (related) Sq type, with the same rounding mode.
     template< double realMinSq = realMin, double realMaxSq = realMax >
-    using Sq = sq::Sq< base_t, f, realMinSq, realMaxSq >;
+    using Sq = sq::Sq< base_t, f, realMinSq, realMaxSq, rounding >;
 
     /// Create a new Q type with the same base type and scaling but a different real value range
     /// and overflow behavior. The default overflow behavior is Ovf::clamp, or the behavior of the
     /// source type if it is stricter.
     template< double newRealMin, double newRealMax,
         Overflow ovfBxOvrd = is_ovf_stricter_v<ovfBx, Ovf::clamp> ? ovfBx : Ovf::clamp >
-    struct clamp { using type = Q< base_t, f, newRealMin, newRealMax, ovfBxOvrd >; };
+    struct clamp { using type = Q< base_t, f, newRealMin, newRealMax, ovfBxOvrd, rounding >; };
 
     /// Type alias for clamp::type.
     template< double newRealMin, double newRealMax, Overflow ovfBxOvrd = ovfBx >
@@ -118,7 +121,7 @@ private:
         static constexpr Overflow ovfBx = ovfBxOvrd;
         // include overflow check if value range of from-type is not fully within range of target type,
         // or if different overflow properties could result in overflow if not checked
-        static constexpr bool ovfCheckNeeded = (QFrom::realMin < realMin || realMax < QFrom::realMax
+        static constexpr bool ovfCheckNeeded = (fpm::detail::convertedMin<QFrom, Q> < realMin || realMax < fpm::detail::convertedMax<QFrom, Q>
                                                 || is_ovf_stricter_v<Q::ovfBx, QFrom::ovfBx> || is_ovf_stricter_v<ovfBx, QFrom::ovfBx>);
         static constexpr bool innerConstraints = fpm::detail::OvfCheckAllowedWhenNeeded<ovfBx, ovfCheckNeeded>;
 
@@ -126,15 +129,15 @@ private:
         static constexpr bool isOvfOvrdIgnored = ( !ovfCheckNeeded && is_ovf_stricter_v<Q::ovfBx, ovfBx> );
         [[deprecated("WARNING: Unnecessary overflow override ignored. Omit, or use safe_q_cast for enforced checks.")]]
         static constexpr base_t value(typename QFrom::base_t from) noexcept requires ( isOvfOvrdIgnored ) {
-            base_t value = s2s<QFrom::f, f, base_t>( from );
+            base_t value = s2s<QFrom::f, f, base_t, rounding>( from );
             return value;
         }
 
         static constexpr base_t value(typename QFrom::base_t from) noexcept requires ( !isOvfOvrdIgnored ) {
-            base_t value = s2s<QFrom::f, f, base_t>( from );
+            base_t value = s2s<QFrom::f, f, base_t, rounding>( from );
             // perform overflow check if needed
             if constexpr (ovfCheckNeeded) {
-                fpm::detail::checkOverflow<ovfBxOvrd>( value, Q::scaledMin, Q::scaledMax );
+                fpm::detail::checkOverflow<ovfBxOvrd>( value, Q::scaledMin, Q::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{} );
             }
             return value;
         }
@@ -150,14 +153,15 @@ private:
         static constexpr double realMin = Q::realMin;
         static constexpr double realMax = Q::realMax;
         static constexpr Overflow ovfBx = ovfBxOvrd;
-        // include overflow check if value range of source is not fully within range of target
-        static constexpr bool ovfCheckNeeded = (SqFrom::realMin < realMin || realMax < SqFrom::realMax);
+        // include overflow check if value range of source, rounded to the scaling of the target,
+        // is not fully within range of target
+        static constexpr bool ovfCheckNeeded = (fpm::detail::convertedMin<SqFrom, Q> < realMin || realMax < fpm::detail::convertedMax<SqFrom, Q>);
         static constexpr bool innerConstraints = fpm::detail::OvfCheckAllowedWhenNeeded<ovfBx, ovfCheckNeeded>;
         static constexpr base_t value(typename SqFrom::base_t fromSq) noexcept {
-            base_t value = s2s<SqFrom::f, f, base_t>(fromSq);
+            base_t value = s2s<SqFrom::f, f, base_t, rounding>(fromSq);
             // perform overflow check if needed
             if constexpr (ovfCheckNeeded) {
-                fpm::detail::checkOverflow<ovfBxOvrd, base_t>(value, Q::scaledMin, Q::scaledMax);
+                fpm::detail::checkOverflow<ovfBxOvrd, base_t>(value, Q::scaledMin, Q::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
             }
             return value;
         }
@@ -178,7 +182,7 @@ private:
             base_t sqValue = qValue;
             // perform overflow check if needed
             if constexpr (ovfCheckNeeded) {
-                fpm::detail::checkOverflow<ovfBxOvrd, base_t>(sqValue, SqTo::scaledMin, SqTo::scaledMax);
+                fpm::detail::checkOverflow<ovfBxOvrd, base_t>(sqValue, SqTo::scaledMin, SqTo::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
             }
             return sqValue;
         }
@@ -198,13 +202,13 @@ private:
         // include overflow check if value range of source type Q is not fully within range of target
         // type QC, or if different overflow properties could result in overflow if not checked
         //       cannot be compared so easily
-        static constexpr bool ovfCheckNeeded = (Q::realMin < realMin || realMax < Q::realMax);
+        static constexpr bool ovfCheckNeeded = (fpm::detail::convertedMin<Q, QC> < realMin || realMax < fpm::detail::convertedMax<Q, QC>);
         static constexpr bool innerConstraints = fpm::detail::OvfCheckAllowedWhenNeeded<ovfBx, ovfCheckNeeded>;
         static constexpr base_t value(typename Q::base_t from) noexcept {
-            auto cValue = s2s<Q::f, f, cast_t>(from);
+            auto cValue = s2s<Q::f, f, cast_t, QC::rounding>(from);
             // perform overflow check if needed
             if constexpr (ovfCheckNeeded) {
-                fpm::detail::checkOverflow<ovfBx, cast_t, typename Q::base_t>(cValue, QC::scaledMin, QC::scaledMax);
+                fpm::detail::checkOverflow<ovfBx, cast_t, typename Q::base_t>(cValue, QC::scaledMin, QC::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
             }
             return static_cast<base_t>(cValue);
         }
@@ -224,7 +228,7 @@ private:
         static constexpr Overflow ovfBx = ovfBxOvrd;
         // include overflow check if value range of source type Q is not fully within range of target
         // type QC, or if different overflow properties could result in overflow if not checked
-        static constexpr bool ovfCheckNeeded = (Q::realMin < QC::realMin || QC::realMax < Q::realMax
+        static constexpr bool ovfCheckNeeded = (fpm::detail::convertedMin<Q, QC> < QC::realMin || QC::realMax < fpm::detail::convertedMax<Q, QC>
                                                 || is_ovf_stricter_v<QC::ovfBx, Q::ovfBx> || is_ovf_stricter_v<ovfBx, Q::ovfBx>);
         static constexpr bool innerConstraints = fpm::detail::OvfCheckAllowedWhenNeeded<ovfBx, ovfCheckNeeded>;
 
@@ -232,15 +236,15 @@ private:
         static constexpr bool isOvfOvrdIgnored = ( !ovfCheckNeeded && is_ovf_stricter_v<QC::ovfBx, ovfBx> );
         [[deprecated("WARNING: Unnecessary overflow override ignored. Omit, or use safe_q_cast for enforced checks.")]]
         static constexpr base_t value(typename Q::base_t from) noexcept requires ( isOvfOvrdIgnored ) {
-            auto cValue = s2s<Q::f, f, cast_t>(from);
+            auto cValue = s2s<Q::f, f, cast_t, QC::rounding>(from);
             return static_cast<base_t>(cValue);
         }
 
         static constexpr base_t value(typename Q::base_t from) noexcept requires ( !isOvfOvrdIgnored ) {
-            auto cValue = s2s<Q::f, f, cast_t>(from);
+            auto cValue = s2s<Q::f, f, cast_t, QC::rounding>(from);
             // perform overflow check if needed
             if constexpr (ovfCheckNeeded) {
-                fpm::detail::checkOverflow<ovfBx, cast_t, typename Q::base_t>(cValue, QC::scaledMin, QC::scaledMax);
+                fpm::detail::checkOverflow<ovfBx, cast_t, typename Q::base_t>(cValue, QC::scaledMin, QC::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
             }
             return static_cast<base_t>(cValue);
         }
@@ -260,23 +264,170 @@ private:
         static constexpr Overflow ovfBx = ovfBxOvrd;
         static constexpr bool innerConstraints = true;
         static constexpr base_t value(typename Q::base_t from) noexcept {
-            auto cValue = s2s<Q::f, f, cast_t>(from);
+            auto cValue = s2s<Q::f, f, cast_t, QC::rounding>(from);
             // always perform overflow checks
-            fpm::detail::checkOverflow<ovfBx, cast_t, typename Q::base_t>(cValue, QC::scaledMin, QC::scaledMax);
+            fpm::detail::checkOverflow<ovfBx, cast_t, typename Q::base_t>(cValue, QC::scaledMin, QC::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
             return static_cast<base_t>(cValue);
         }
     };
 
+    /// Implements the multiply-accumulate of Sq values into this Q type.
+    template< SqType SqA, SqType SqB, Overflow ovfBxOvrd >
+    struct Mac {
+        using fma_t = typename SqA::template Fma< SqB, Sq<> >;  // accumulator is the addend
+        using calc_t = typename fma_t::calc_t;
+        using base_t = typename Q::base_t;
+        static constexpr scaling_t f = Q::f;
+        static constexpr double realMin = Q::realMin;
+        static constexpr double realMax = Q::realMax;
+        static constexpr Overflow ovfBx = ovfBxOvrd;
+        static constexpr bool ovfCheckNeeded = (fpm::detail::roundedMin(fma_t::realMin, f, rounding) < realMin
+                                                || realMax < fpm::detail::roundedMax(fma_t::realMax, f, rounding));
+        static constexpr bool innerConstraints = ( fma_t::innerConstraints
+                                                   && fpm::detail::OvfCheckAllowedWhenNeeded<ovfBx, ovfCheckNeeded> );
+        static constexpr base_t value(typename SqA::base_t av, typename SqB::base_t bv, base_t acc) noexcept {
+            // add product to accumulator at double scaling, rescale once to the accumulator's scaling
+            auto sum = s2s<2*fma_t::f, f, calc_t, rounding>( fma_t::wide(av, bv, acc) );
+            if constexpr (ovfCheckNeeded) {
+                fpm::detail::checkOverflow<ovfBx, calc_t>(sum, Q::scaledMin, Q::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
+            }
+            return static_cast<base_t>(sum);
+        }
+    };
+
+    /// Implements the saturating addition and subtraction of a Sq value to and from this Q type.
+    /// The Sq value is scaled to the scaling of this Q type in the base type, which must be exact,
+    /// thus the operation does not need a wider calculation type. An overflow of the base type is
+    /// detected via the overflow flag, and the result is clamped to the limits without a branch.
+    /// With the overflow telemetry, clamped results are recorded like with Ovf::clamp.
+    template< SqType SqRhs >
+    struct Saturating {
+        using base_t = typename Q::base_t;
+        static constexpr scaling_t f = Q::f;
+        static constexpr double realMin = Q::realMin;
+        static constexpr double realMax = Q::realMax;
+        static constexpr bool innerConstraints = (
+            SqRhs::f <= f
+            && fpm::detail::RealLimitsInRangeOfCalcType<base_t, f, SqRhs::realMin, SqRhs::realMax> );
+        static constexpr base_t clamp(base_t v) noexcept {
+            fpm::detail::checkOverflow<Overflow::clamp, base_t>(v, Q::scaledMin, Q::scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
+            return v;
+        }
+        static constexpr base_t add(base_t lv, typename SqRhs::base_t rv) noexcept {
+            return clamp( fpm::detail::saturatingAdd(lv, s2s<SqRhs::f, f, base_t>(rv)) );
+        }
+        static constexpr base_t sub(base_t lv, typename SqRhs::base_t rv) noexcept {
+            return clamp( fpm::detail::saturatingSub(lv, s2s<SqRhs::f, f, base_t>(rv)) );
+        }
+    };
+
+    /// Implements the bulk construction of this Q type from a range of scaled values.
+    /// The values are processed in blocks of as many lanes as fit into a vector register. Within a
+    /// block, the values are clamped via min/max and the index of the first out-of-range value is
+    /// determined via a min-reduction, i.e. without a branch per value, so that the compiler can
+    /// vectorize the block. Source and destination may be the same range (in-place construction).
+    /// With the overflow telemetry and Ovf::clamp, the number of clamped values and their extreme
+    /// values are reduced in the same way and recorded once per block.
+    template< Overflow ovfBxOvrd, /* deduced: */ typename SrcT >
+    static constexpr
+    std::size_t constructRangeImpl(SrcT const *src, Q *dst, std::size_t const n) noexcept {
+        constexpr std::size_t lanes = fpm::detail::lanes_v<base_t>;
+        constexpr bool isChecked = (Overflow::assert == ovfBxOvrd || Overflow::clamp == ovfBxOvrd);
+
+        // processes the values in [begin, end); returns the index of the first out-of-range value,
+        // or end if all values are within range
+        auto const block = [src, dst](std::size_t const begin, std::size_t const end) noexcept {
+            std::size_t first = end;
+#if defined FPM_OVF_TELEMETRY
+            uint32_t clampedCount = 0u;
+            base_t clampedMin = std::numeric_limits<base_t>::max();
+            base_t clampedMax = std::numeric_limits<base_t>::lowest();
+#endif
+            FPM_SIMD_LOOP
+            for (std::size_t k = begin; k < end; ++k) {
+                base_t value;
+                if constexpr (std::is_same_v<SrcT, Q>) { value = src[k].value; }
+                else { value = src[k]; }
+
+                if constexpr (isChecked) {
+                    bool const outOfRange = (value < scaledMin) | (value > scaledMax);
+                    first = std::min(first, outOfRange ? k : end);
+#if defined FPM_OVF_TELEMETRY
+                    if constexpr (Overflow::clamp == ovfBxOvrd) {
+                        clampedCount += static_cast<uint32_t>(outOfRange);
+                        clampedMin = std::min(clampedMin, outOfRange ? value : std::numeric_limits<base_t>::max());
+                        clampedMax = std::max(clampedMax, outOfRange ? value : std::numeric_limits<base_t>::lowest());
+                    }
+#endif
+                }
+                if constexpr (Overflow::clamp == ovfBxOvrd) {
+                    dst[k].value = std::min(std::max(value, scaledMin), scaledMax);
+                }
+                else { dst[k].value = value; }
+            }
+#if defined FPM_OVF_TELEMETRY
+            if constexpr (Overflow::clamp == ovfBxOvrd) {
+                if (clampedCount != 0u && !std::is_constant_evaluated()) [[unlikely]] {
+                    fpm::detail::recordOverflows( fpm::detail::OvfTelemetry<fpm::detail::OvfKey<base_t, f, realMin, realMax>>::record,
+                                                  clampedCount, static_cast<intmax_t>(clampedMin), static_cast<intmax_t>(clampedMax) );
+                }
+            }
+#endif
+            return first;
+        };
+
+        std::size_t first = n;
+        auto const check = [&](std::size_t const begin, std::size_t const end) noexcept {
+            std::size_t const firstInBlock = block(begin, end);
+            if constexpr (rangeProfilerEnabled) {
+                for (std::size_t k = begin; k < end; ++k) { profile(dst[k].value); }
+            }
+            if (firstInBlock != end && first == n) [[unlikely]] {
+                first = firstInBlock;
+                if constexpr (Overflow::assert == ovfBxOvrd) {
+                    ovfAssertTrap(first);  // value is out of range; this does not return!
+                }
+            }
+        };
+
+        std::size_t i = 0u;
+        for (; i + lanes <= n; i += lanes) { check(i, i + lanes); }
+        if (i < n) { check(i, n); }  // remaining values
+        return first;
+    }
+
 public:
     /// Named "constructor" from a runtime variable (lvalue) or a constant (rvalue).
     /// \note Overflow check is always included unless explicitly discarded.
     template< Overflow ovfBxOvrd = ovfBx >
     static constexpr
     Q construct(base_t value) noexcept {
-        fpm::detail::checkOverflow<ovfBxOvrd, base_t>(value, scaledMin, scaledMax);
+        fpm::detail::checkOverflow<ovfBxOvrd, base_t>(value, scaledMin, scaledMax, fpm::detail::OvfKey<base_t, f, realMin, realMax>{});
         return Q( value );
     }
 
+    /// Named bulk "constructor" from a range of runtime scaled values, e.g. raw samples of an ADC
+    /// read via DMA. Behaves like construct() applied to each value, however the overflow check is
+    /// performed block-wise without a branch per value, which allows vectorization.
+    /// \returns the index of the first value that is out of range, or the number of constructed
+    ///          values (the size of the smaller range) if all values are within range.
+    /// \note With Ovf::clamp, out-of-range values are clamped. With Ovf::assert, the bulk assert trap
+    ///       ovfAssertTrap(index) is called with the index of the first out-of-range value.
+    ///       No checks are performed with Ovf::error and Ovf::unchecked.
+    template< Overflow ovfBxOvrd = ovfBx >
+    static constexpr
+    std::size_t constructRange(std::span<base_t const> values, std::span<Q> out) noexcept {
+        return Q::template constructRangeImpl<ovfBxOvrd>(values.data(), out.data(), std::min(values.size(), out.size()));
+    }
+
+    /// In-place variant of constructRange() for a range of Q values which were written without any
+    /// check, e.g. directly by DMA. The values are checked (and clamped) in place.
+    template< Overflow ovfBxOvrd = ovfBx >
+    static constexpr
+    std::size_t constructRange(std::span<Q> values) noexcept {
+        return Q::template constructRangeImpl<ovfBxOvrd>(values.data(), values.data(), values.size());
+    }
+
     /// Named COMPILE-TIME "constructor" from a floating-point value. This will use v2s to scale
     /// the given floating-point value at compile-time before the Q value is constructed with the
     /// scaled integer value.
@@ -306,7 +457,7 @@ public:
     /// will not change because the underlying integer value is just multiplied by some integral power
     /// of two factor. However, if the Q value is down-scaled to a smaller resolution, the resulting
     /// representation error may become larger since the underlying integer is divided and the result
-    /// rounded towards zero to the next integer. The resulting representation error is at most the
+    /// rounded with the rounding mode of the target type. The resulting representation error is at most the
     /// sum of the two resolutions before and after a down-scaling operation.
     template< Overflow ovfBxOvrd = ovfBx, /* deduced: */ QType QFrom >
     requires fpm::detail::ValidImplType< FromQ<QFrom, ovfBxOvrd> >
@@ -340,7 +491,7 @@ public:
     /// will not change because the underlying integer value is just multiplied by some integral power
     /// of two factor. However, if the Q value is down-scaled to a smaller resolution, the resulting
     /// representation error may become larger since the underlying integer is divided and the result
-    /// rounded towards zero to the next integer. The resulting representation error is at most the
+    /// rounded with the rounding mode of the target type. The resulting representation error is at most the
     /// sum of the two resolutions before and after a down-scaling operation.
     template< /* deduced: */ QType QFrom >
     requires requires(QFrom const &from) {
@@ -356,7 +507,7 @@ public:
     template< /* deduced: */ SqType SqFrom >
     requires fpm::detail::ImplicitlyConvertible<SqFrom, Q>
     constexpr
-    Q(SqFrom const &from) noexcept : value( s2s<SqFrom::f, f, base_t>(from.value) ) {}
+    Q(SqFrom const &from) noexcept : value( s2s<SqFrom::f, f, base_t, rounding>(from.value) ) { profile(value); }
 
     /// Copy-Constructor from the same type.
     constexpr
@@ -392,6 +543,57 @@ public:
         return *this;
     }
 
+    /// Multiply-accumulate: adds the product of the given Sq values to this Q value (acc += a * b).
+    /// The product is added at double scaling in the calculation type of the multiplication, and the
+    /// sum is rescaled only once to the scaling of this Q type.
+    /// \note An overflow check is included according to the overflow behavior of this Q type or the
+    /// override, unless the product cannot leave the value range of this Q type.
+    template< Overflow ovfBxOvrd = ovfBx, /* deduced: */ SqType SqA, SqType SqB >
+    requires fpm::detail::ValidImplType< Mac<SqA, SqB, ovfBxOvrd> >
+    constexpr
+    Q& mac(SqA const &a, SqB const &b) noexcept {
+        value = Mac<SqA, SqB, ovfBxOvrd>::value(a.value, b.value, value);
+        profile(value);
+        return *this;
+    }
+
+    /// Saturating addition: adds the given Sq value to this Q value (value += rhs) and clamps the
+    /// sum to the value range of this Q type, regardless of the overflow behavior of the type.
+    /// The sum is calculated in the base type with an overflow flag instead of a wider type, which
+    /// is cheaper for clamped accumulations on targets without a wide ALU.
+    /// \note The rhs value must be representable in the base type at the scaling of this Q type.
+    template< /* deduced: */ SqType SqRhs >
+    requires fpm::detail::ValidImplType< Saturating<SqRhs> >
+    constexpr
+    Q& saturatingAdd(SqRhs const &rhs) noexcept {
+        value = Saturating<SqRhs>::add(value, rhs.value);
+        profile(value);
+        return *this;
+    }
+
+    /// Saturating addition of a Q value. See saturatingAdd(Sq).
+    template< /* deduced: */ QType QRhs >
+    requires fpm::detail::ValidImplType< Saturating< decltype(std::declval<QRhs const &>().toSq()) > >
+    constexpr
+    Q& saturatingAdd(QRhs const &rhs) noexcept { return saturatingAdd( rhs.toSq() ); }
+
+    /// Saturating subtraction: subtracts the given Sq value from this Q value (value -= rhs) and
+    /// clamps the difference to the value range of this Q type. See saturatingAdd(Sq).
+    template< /* deduced: */ SqType SqRhs >
+    requires fpm::detail::ValidImplType< Saturating<SqRhs> >
+    constexpr
+    Q& saturatingSub(SqRhs const &rhs) noexcept {
+        value = Saturating<SqRhs>::sub(value, rhs.value);
+        profile(value);
+        return *this;
+    }
+
+    /// Saturating subtraction of a Q value. See saturatingSub(Sq).
+    template< /* deduced: */ QType QRhs >
+    requires fpm::detail::ValidImplType< Saturating< decltype(std::declval<QRhs const &>().toSq()) > >
+    constexpr
+    Q& saturatingSub(QRhs const &rhs) noexcept { return saturatingSub( rhs.toSq() ); }
+
     /// Explicit (static-) cast to a different Q type with a potentially different base type.
     /// \note If a cast does not work it's most probably due to unfulfilled requirements. Double check
     ///       whether a runtime overflow check is needed and make sure that it is allowed!
@@ -460,11 +662,22 @@ private:
 
     /// Explicit, possibly compile-time constructor from integer value.
     explicit constexpr
-    Q(base_t value) noexcept : value(value) {}
+    Q(base_t value) noexcept : value(value) { profile(value); }
+
+    /// Records the given value in the range profile of this type if the range profiler is enabled
+    /// (FPM_RANGE_PROFILER); otherwise does nothing.
+    static constexpr
+    void profile([[maybe_unused]] base_t value) noexcept {
+#if defined FPM_RANGE_PROFILER
+        if (!std::is_constant_evaluated()) {
+            fpm::detail::recordRange(fpm::detail::RangeProfile<base_t, f, realMin, realMax>::record, static_cast<intmax_t>(value));
+        }
+#endif
+    }
 
     // friend all Q types so that private members of similar types can be accessed for construction
     // Note: As of May 2023, partial specializations cannot be friended, so we friend Q in general.
-    template< std::integral BaseTQ, scaling_t fQ, double realMinQ, double realMaxQ, Overflow ovfQ >
+    template< std::integral BaseTQ, scaling_t fQ, double realMinQ, double realMaxQ, Overflow ovfQ, Rounding rndQ >
     requires fpm::detail::QRequirements<BaseTQ, fQ, realMinQ, realMaxQ, ovfQ>
     friend class Q;
 
@@ -543,7 +756,43 @@ constexpr auto rsqrt(QType auto const &q) noexcept { return rsqrt( +q ); }
 // Cube(-Root)
 constexpr auto cube(QType auto const &q) noexcept { return cube( +q ); }
 constexpr auto cbrt(QType auto const &q) noexcept { return cbrt( +q ); }
-//constexpr auto rcbrt(QType auto const &q) noexcept { return rcbrt( +q ); }
+constexpr auto rcbrt(QType auto const &q) noexcept { return rcbrt( +q ); }
+
+// Power
+template< /* deduced: */ std::integral T, T n >
+constexpr auto pow(QType auto const &q, std::integral_constant<T, n> const ic) noexcept { return pow( +q, ic ); }
+
+// Polynomial
+template< double... coeffs >
+constexpr auto poly(QType auto const &q) noexcept { return poly<coeffs...>( +q ); }
+
+// Exponential, Logarithm
+constexpr auto log2(QType auto const &q) noexcept { return log2( +q ); }
+constexpr auto log(QType auto const &q) noexcept { return log( +q ); }
+constexpr auto exp2(QType auto const &q) noexcept { return exp2( +q ); }
+constexpr auto exp(QType auto const &q) noexcept { return exp( +q ); }
+
+// Trigonometry
+template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+constexpr auto sin(QType auto const &q) noexcept { return sin<engine, unit>( +q ); }
+template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+constexpr auto cos(QType auto const &q) noexcept { return cos<engine, unit>( +q ); }
+template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+constexpr auto sincos(QType auto const &q) noexcept { return sincos<engine, unit>( +q ); }
+template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+constexpr auto tan(QType auto const &q) noexcept { return tan<engine, unit>( +q ); }
+template< AngleUnit unit = AngleUnit::rad >
+constexpr auto atan2(QType auto const &y, SqType auto const &x) noexcept { return atan2<unit>( +y, x ); }
+template< AngleUnit unit = AngleUnit::rad >
+constexpr auto atan2(SqType auto const &y, QType auto const &x) noexcept { return atan2<unit>( y, +x ); }
+template< AngleUnit unit = AngleUnit::rad >
+constexpr auto atan2(QType auto const &y, QType auto const &x) noexcept { return atan2<unit>( +y, +x ); }
+template< AngleUnit unit = AngleUnit::rad >
+constexpr auto polar(QType auto const &x, SqType auto const &y) noexcept { return polar<unit>( +x, y ); }
+template< AngleUnit unit = AngleUnit::rad >
+constexpr auto polar(SqType auto const &x, QType auto const &y) noexcept { return polar<unit>( x, +y ); }
+template< AngleUnit unit = AngleUnit::rad >
+constexpr auto polar(QType auto const &x, QType auto const &y) noexcept { return polar<unit>( +x, +y ); }
 
 // Clamp
 constexpr auto clamp(QType auto const &value, QType auto const &lo, QType auto const &hi) { return clamp( +value, +lo, +hi ); }
@@ -26,174 +26,349 @@ namespace fpm::q::inline types {
 
 /* q types */
 
-template< double lower = fpm::detail::realMin<  int8_t,  -4>(), double upper = fpm::detail::realMax<  int8_t,  -4>(), Overflow ovfBx = Ovf::error > using   i8qm4 = Q<  int8_t,  -4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,  -3>(), double upper = fpm::detail::realMax<  int8_t,  -3>(), Overflow ovfBx = Ovf::error > using   i8qm3 = Q<  int8_t,  -3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,  -2>(), double upper = fpm::detail::realMax<  int8_t,  -2>(), Overflow ovfBx = Ovf::error > using   i8qm2 = Q<  int8_t,  -2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,  -1>(), double upper = fpm::detail::realMax<  int8_t,  -1>(), Overflow ovfBx = Ovf::error > using   i8qm1 = Q<  int8_t,  -1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   0>(), double upper = fpm::detail::realMax<  int8_t,   0>(), Overflow ovfBx = Ovf::error > using    i8q0 = Q<  int8_t,   0, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   1>(), double upper = fpm::detail::realMax<  int8_t,   1>(), Overflow ovfBx = Ovf::error > using    i8q1 = Q<  int8_t,   1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   2>(), double upper = fpm::detail::realMax<  int8_t,   2>(), Overflow ovfBx = Ovf::error > using    i8q2 = Q<  int8_t,   2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   3>(), double upper = fpm::detail::realMax<  int8_t,   3>(), Overflow ovfBx = Ovf::error > using    i8q3 = Q<  int8_t,   3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   4>(), double upper = fpm::detail::realMax<  int8_t,   4>(), Overflow ovfBx = Ovf::error > using    i8q4 = Q<  int8_t,   4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   5>(), double upper = fpm::detail::realMax<  int8_t,   5>(), Overflow ovfBx = Ovf::error > using    i8q5 = Q<  int8_t,   5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   6>(), double upper = fpm::detail::realMax<  int8_t,   6>(), Overflow ovfBx = Ovf::error > using    i8q6 = Q<  int8_t,   6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<  int8_t,   7>(), double upper = fpm::detail::realMax<  int8_t,   7>(), Overflow ovfBx = Ovf::error > using    i8q7 = Q<  int8_t,   7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,  -4>(), double upper = fpm::detail::realMax< uint8_t,  -4>(), Overflow ovfBx = Ovf::error > using   u8qm4 = Q< uint8_t,  -4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,  -3>(), double upper = fpm::detail::realMax< uint8_t,  -3>(), Overflow ovfBx = Ovf::error > using   u8qm3 = Q< uint8_t,  -3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,  -2>(), double upper = fpm::detail::realMax< uint8_t,  -2>(), Overflow ovfBx = Ovf::error > using   u8qm2 = Q< uint8_t,  -2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,  -1>(), double upper = fpm::detail::realMax< uint8_t,  -1>(), Overflow ovfBx = Ovf::error > using   u8qm1 = Q< uint8_t,  -1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   0>(), double upper = fpm::detail::realMax< uint8_t,   0>(), Overflow ovfBx = Ovf::error > using    u8q0 = Q< uint8_t,   0, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   1>(), double upper = fpm::detail::realMax< uint8_t,   1>(), Overflow ovfBx = Ovf::error > using    u8q1 = Q< uint8_t,   1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   2>(), double upper = fpm::detail::realMax< uint8_t,   2>(), Overflow ovfBx = Ovf::error > using    u8q2 = Q< uint8_t,   2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   3>(), double upper = fpm::detail::realMax< uint8_t,   3>(), Overflow ovfBx = Ovf::error > using    u8q3 = Q< uint8_t,   3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   4>(), double upper = fpm::detail::realMax< uint8_t,   4>(), Overflow ovfBx = Ovf::error > using    u8q4 = Q< uint8_t,   4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   5>(), double upper = fpm::detail::realMax< uint8_t,   5>(), Overflow ovfBx = Ovf::error > using    u8q5 = Q< uint8_t,   5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   6>(), double upper = fpm::detail::realMax< uint8_t,   6>(), Overflow ovfBx = Ovf::error > using    u8q6 = Q< uint8_t,   6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< uint8_t,   7>(), double upper = fpm::detail::realMax< uint8_t,   7>(), Overflow ovfBx = Ovf::error > using    u8q7 = Q< uint8_t,   7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -8>(), double upper = fpm::detail::realMax< int16_t,  -8>(), Overflow ovfBx = Ovf::error > using  i16qm8 = Q< int16_t,  -8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -7>(), double upper = fpm::detail::realMax< int16_t,  -7>(), Overflow ovfBx = Ovf::error > using  i16qm7 = Q< int16_t,  -7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -6>(), double upper = fpm::detail::realMax< int16_t,  -6>(), Overflow ovfBx = Ovf::error > using  i16qm6 = Q< int16_t,  -6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -5>(), double upper = fpm::detail::realMax< int16_t,  -5>(), Overflow ovfBx = Ovf::error > using  i16qm5 = Q< int16_t,  -5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -4>(), double upper = fpm::detail::realMax< int16_t,  -4>(), Overflow ovfBx = Ovf::error > using  i16qm4 = Q< int16_t,  -4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -3>(), double upper = fpm::detail::realMax< int16_t,  -3>(), Overflow ovfBx = Ovf::error > using  i16qm3 = Q< int16_t,  -3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -2>(), double upper = fpm::detail::realMax< int16_t,  -2>(), Overflow ovfBx = Ovf::error > using  i16qm2 = Q< int16_t,  -2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  -1>(), double upper = fpm::detail::realMax< int16_t,  -1>(), Overflow ovfBx = Ovf::error > using  i16qm1 = Q< int16_t,  -1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   0>(), double upper = fpm::detail::realMax< int16_t,   0>(), Overflow ovfBx = Ovf::error > using   i16q0 = Q< int16_t,   0, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   1>(), double upper = fpm::detail::realMax< int16_t,   1>(), Overflow ovfBx = Ovf::error > using   i16q1 = Q< int16_t,   1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   2>(), double upper = fpm::detail::realMax< int16_t,   2>(), Overflow ovfBx = Ovf::error > using   i16q2 = Q< int16_t,   2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   3>(), double upper = fpm::detail::realMax< int16_t,   3>(), Overflow ovfBx = Ovf::error > using   i16q3 = Q< int16_t,   3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   4>(), double upper = fpm::detail::realMax< int16_t,   4>(), Overflow ovfBx = Ovf::error > using   i16q4 = Q< int16_t,   4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   5>(), double upper = fpm::detail::realMax< int16_t,   5>(), Overflow ovfBx = Ovf::error > using   i16q5 = Q< int16_t,   5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   6>(), double upper = fpm::detail::realMax< int16_t,   6>(), Overflow ovfBx = Ovf::error > using   i16q6 = Q< int16_t,   6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   7>(), double upper = fpm::detail::realMax< int16_t,   7>(), Overflow ovfBx = Ovf::error > using   i16q7 = Q< int16_t,   7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   8>(), double upper = fpm::detail::realMax< int16_t,   8>(), Overflow ovfBx = Ovf::error > using   i16q8 = Q< int16_t,   8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,   9>(), double upper = fpm::detail::realMax< int16_t,   9>(), Overflow ovfBx = Ovf::error > using   i16q9 = Q< int16_t,   9, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  10>(), double upper = fpm::detail::realMax< int16_t,  10>(), Overflow ovfBx = Ovf::error > using  i16q10 = Q< int16_t,  10, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  11>(), double upper = fpm::detail::realMax< int16_t,  11>(), Overflow ovfBx = Ovf::error > using  i16q11 = Q< int16_t,  11, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  12>(), double upper = fpm::detail::realMax< int16_t,  12>(), Overflow ovfBx = Ovf::error > using  i16q12 = Q< int16_t,  12, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  13>(), double upper = fpm::detail::realMax< int16_t,  13>(), Overflow ovfBx = Ovf::error > using  i16q13 = Q< int16_t,  13, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  14>(), double upper = fpm::detail::realMax< int16_t,  14>(), Overflow ovfBx = Ovf::error > using  i16q14 = Q< int16_t,  14, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int16_t,  15>(), double upper = fpm::detail::realMax< int16_t,  15>(), Overflow ovfBx = Ovf::error > using  i16q15 = Q< int16_t,  15, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -8>(), double upper = fpm::detail::realMax<uint16_t,  -8>(), Overflow ovfBx = Ovf::error > using  u16qm8 = Q<uint16_t,  -8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -7>(), double upper = fpm::detail::realMax<uint16_t,  -7>(), Overflow ovfBx = Ovf::error > using  u16qm7 = Q<uint16_t,  -7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -6>(), double upper = fpm::detail::realMax<uint16_t,  -6>(), Overflow ovfBx = Ovf::error > using  u16qm6 = Q<uint16_t,  -6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -5>(), double upper = fpm::detail::realMax<uint16_t,  -5>(), Overflow ovfBx = Ovf::error > using  u16qm5 = Q<uint16_t,  -5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -4>(), double upper = fpm::detail::realMax<uint16_t,  -4>(), Overflow ovfBx = Ovf::error > using  u16qm4 = Q<uint16_t,  -4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -3>(), double upper = fpm::detail::realMax<uint16_t,  -3>(), Overflow ovfBx = Ovf::error > using  u16qm3 = Q<uint16_t,  -3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -2>(), double upper = fpm::detail::realMax<uint16_t,  -2>(), Overflow ovfBx = Ovf::error > using  u16qm2 = Q<uint16_t,  -2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  -1>(), double upper = fpm::detail::realMax<uint16_t,  -1>(), Overflow ovfBx = Ovf::error > using  u16qm1 = Q<uint16_t,  -1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   0>(), double upper = fpm::detail::realMax<uint16_t,   0>(), Overflow ovfBx = Ovf::error > using   u16q0 = Q<uint16_t,   0, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   1>(), double upper = fpm::detail::realMax<uint16_t,   1>(), Overflow ovfBx = Ovf::error > using   u16q1 = Q<uint16_t,   1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   2>(), double upper = fpm::detail::realMax<uint16_t,   2>(), Overflow ovfBx = Ovf::error > using   u16q2 = Q<uint16_t,   2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   3>(), double upper = fpm::detail::realMax<uint16_t,   3>(), Overflow ovfBx = Ovf::error > using   u16q3 = Q<uint16_t,   3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   4>(), double upper = fpm::detail::realMax<uint16_t,   4>(), Overflow ovfBx = Ovf::error > using   u16q4 = Q<uint16_t,   4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   5>(), double upper = fpm::detail::realMax<uint16_t,   5>(), Overflow ovfBx = Ovf::error > using   u16q5 = Q<uint16_t,   5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   6>(), double upper = fpm::detail::realMax<uint16_t,   6>(), Overflow ovfBx = Ovf::error > using   u16q6 = Q<uint16_t,   6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   7>(), double upper = fpm::detail::realMax<uint16_t,   7>(), Overflow ovfBx = Ovf::error > using   u16q7 = Q<uint16_t,   7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   8>(), double upper = fpm::detail::realMax<uint16_t,   8>(), Overflow ovfBx = Ovf::error > using   u16q8 = Q<uint16_t,   8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,   9>(), double upper = fpm::detail::realMax<uint16_t,   9>(), Overflow ovfBx = Ovf::error > using   u16q9 = Q<uint16_t,   9, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  10>(), double upper = fpm::detail::realMax<uint16_t,  10>(), Overflow ovfBx = Ovf::error > using  u16q10 = Q<uint16_t,  10, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  11>(), double upper = fpm::detail::realMax<uint16_t,  11>(), Overflow ovfBx = Ovf::error > using  u16q11 = Q<uint16_t,  11, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  12>(), double upper = fpm::detail::realMax<uint16_t,  12>(), Overflow ovfBx = Ovf::error > using  u16q12 = Q<uint16_t,  12, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  13>(), double upper = fpm::detail::realMax<uint16_t,  13>(), Overflow ovfBx = Ovf::error > using  u16q13 = Q<uint16_t,  13, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  14>(), double upper = fpm::detail::realMax<uint16_t,  14>(), Overflow ovfBx = Ovf::error > using  u16q14 = Q<uint16_t,  14, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint16_t,  15>(), double upper = fpm::detail::realMax<uint16_t,  15>(), Overflow ovfBx = Ovf::error > using  u16q15 = Q<uint16_t,  15, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t, -16>(), double upper = fpm::detail::realMax< int32_t, -16>(), Overflow ovfBx = Ovf::error > using i32qm16 = Q< int32_t, -16, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t, -15>(), double upper = fpm::detail::realMax< int32_t, -15>(), Overflow ovfBx = Ovf::error > using i32qm15 = Q< int32_t, -15, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t, -14>(), double upper = fpm::detail::realMax< int32_t, -14>(), Overflow ovfBx = Ovf::error > using i32qm14 = Q< int32_t, -14, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t, -13>(), double upper = fpm::detail::realMax< int32_t, -13>(), Overflow ovfBx = Ovf::error > using i32qm13 = Q< int32_t, -13, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t, -12>(), double upper = fpm::detail::realMax< int32_t, -12>(), Overflow ovfBx = Ovf::error > using i32qm12 = Q< int32_t, -12, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t, -11>(), double upper = fpm::detail::realMax< int32_t, -11>(), Overflow ovfBx = Ovf::error > using i32qm11 = Q< int32_t, -11, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t, -10>(), double upper = fpm::detail::realMax< int32_t, -10>(), Overflow ovfBx = Ovf::error > using i32qm10 = Q< int32_t, -10, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -9>(), double upper = fpm::detail::realMax< int32_t,  -9>(), Overflow ovfBx = Ovf::error > using  i32qm9 = Q< int32_t,  -9, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -8>(), double upper = fpm::detail::realMax< int32_t,  -8>(), Overflow ovfBx = Ovf::error > using  i32qm8 = Q< int32_t,  -8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -7>(), double upper = fpm::detail::realMax< int32_t,  -7>(), Overflow ovfBx = Ovf::error > using  i32qm7 = Q< int32_t,  -7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -6>(), double upper = fpm::detail::realMax< int32_t,  -6>(), Overflow ovfBx = Ovf::error > using  i32qm6 = Q< int32_t,  -6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -5>(), double upper = fpm::detail::realMax< int32_t,  -5>(), Overflow ovfBx = Ovf::error > using  i32qm5 = Q< int32_t,  -5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -4>(), double upper = fpm::detail::realMax< int32_t,  -4>(), Overflow ovfBx = Ovf::error > using  i32qm4 = Q< int32_t,  -4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -3>(), double upper = fpm::detail::realMax< int32_t,  -3>(), Overflow ovfBx = Ovf::error > using  i32qm3 = Q< int32_t,  -3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -2>(), double upper = fpm::detail::realMax< int32_t,  -2>(), Overflow ovfBx = Ovf::error > using  i32qm2 = Q< int32_t,  -2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  -1>(), double upper = fpm::detail::realMax< int32_t,  -1>(), Overflow ovfBx = Ovf::error > using  i32qm1 = Q< int32_t,  -1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   0>(), double upper = fpm::detail::realMax< int32_t,   0>(), Overflow ovfBx = Ovf::error > using   i32q0 = Q< int32_t,   0, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   1>(), double upper = fpm::detail::realMax< int32_t,   1>(), Overflow ovfBx = Ovf::error > using   i32q1 = Q< int32_t,   1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   2>(), double upper = fpm::detail::realMax< int32_t,   2>(), Overflow ovfBx = Ovf::error > using   i32q2 = Q< int32_t,   2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   3>(), double upper = fpm::detail::realMax< int32_t,   3>(), Overflow ovfBx = Ovf::error > using   i32q3 = Q< int32_t,   3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   4>(), double upper = fpm::detail::realMax< int32_t,   4>(), Overflow ovfBx = Ovf::error > using   i32q4 = Q< int32_t,   4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   5>(), double upper = fpm::detail::realMax< int32_t,   5>(), Overflow ovfBx = Ovf::error > using   i32q5 = Q< int32_t,   5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   6>(), double upper = fpm::detail::realMax< int32_t,   6>(), Overflow ovfBx = Ovf::error > using   i32q6 = Q< int32_t,   6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   7>(), double upper = fpm::detail::realMax< int32_t,   7>(), Overflow ovfBx = Ovf::error > using   i32q7 = Q< int32_t,   7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   8>(), double upper = fpm::detail::realMax< int32_t,   8>(), Overflow ovfBx = Ovf::error > using   i32q8 = Q< int32_t,   8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,   9>(), double upper = fpm::detail::realMax< int32_t,   9>(), Overflow ovfBx = Ovf::error > using   i32q9 = Q< int32_t,   9, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  10>(), double upper = fpm::detail::realMax< int32_t,  10>(), Overflow ovfBx = Ovf::error > using  i32q10 = Q< int32_t,  10, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  11>(), double upper = fpm::detail::realMax< int32_t,  11>(), Overflow ovfBx = Ovf::error > using  i32q11 = Q< int32_t,  11, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  12>(), double upper = fpm::detail::realMax< int32_t,  12>(), Overflow ovfBx = Ovf::error > using  i32q12 = Q< int32_t,  12, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  13>(), double upper = fpm::detail::realMax< int32_t,  13>(), Overflow ovfBx = Ovf::error > using  i32q13 = Q< int32_t,  13, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  14>(), double upper = fpm::detail::realMax< int32_t,  14>(), Overflow ovfBx = Ovf::error > using  i32q14 = Q< int32_t,  14, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  15>(), double upper = fpm::detail::realMax< int32_t,  15>(), Overflow ovfBx = Ovf::error > using  i32q15 = Q< int32_t,  15, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  16>(), double upper = fpm::detail::realMax< int32_t,  16>(), Overflow ovfBx = Ovf::error > using  i32q16 = Q< int32_t,  16, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  17>(), double upper = fpm::detail::realMax< int32_t,  17>(), Overflow ovfBx = Ovf::error > using  i32q17 = Q< int32_t,  17, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  18>(), double upper = fpm::detail::realMax< int32_t,  18>(), Overflow ovfBx = Ovf::error > using  i32q18 = Q< int32_t,  18, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  19>(), double upper = fpm::detail::realMax< int32_t,  19>(), Overflow ovfBx = Ovf::error > using  i32q19 = Q< int32_t,  19, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  20>(), double upper = fpm::detail::realMax< int32_t,  20>(), Overflow ovfBx = Ovf::error > using  i32q20 = Q< int32_t,  20, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  21>(), double upper = fpm::detail::realMax< int32_t,  21>(), Overflow ovfBx = Ovf::error > using  i32q21 = Q< int32_t,  21, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  22>(), double upper = fpm::detail::realMax< int32_t,  22>(), Overflow ovfBx = Ovf::error > using  i32q22 = Q< int32_t,  22, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  23>(), double upper = fpm::detail::realMax< int32_t,  23>(), Overflow ovfBx = Ovf::error > using  i32q23 = Q< int32_t,  23, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  24>(), double upper = fpm::detail::realMax< int32_t,  24>(), Overflow ovfBx = Ovf::error > using  i32q24 = Q< int32_t,  24, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  25>(), double upper = fpm::detail::realMax< int32_t,  25>(), Overflow ovfBx = Ovf::error > using  i32q25 = Q< int32_t,  25, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  26>(), double upper = fpm::detail::realMax< int32_t,  26>(), Overflow ovfBx = Ovf::error > using  i32q26 = Q< int32_t,  26, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  27>(), double upper = fpm::detail::realMax< int32_t,  27>(), Overflow ovfBx = Ovf::error > using  i32q27 = Q< int32_t,  27, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  28>(), double upper = fpm::detail::realMax< int32_t,  28>(), Overflow ovfBx = Ovf::error > using  i32q28 = Q< int32_t,  28, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  29>(), double upper = fpm::detail::realMax< int32_t,  29>(), Overflow ovfBx = Ovf::error > using  i32q29 = Q< int32_t,  29, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  30>(), double upper = fpm::detail::realMax< int32_t,  30>(), Overflow ovfBx = Ovf::error > using  i32q30 = Q< int32_t,  30, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin< int32_t,  31>(), double upper = fpm::detail::realMax< int32_t,  31>(), Overflow ovfBx = Ovf::error > using  i32q31 = Q< int32_t,  31, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t, -16>(), double upper = fpm::detail::realMax<uint32_t, -16>(), Overflow ovfBx = Ovf::error > using u32qm16 = Q<uint32_t, -16, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t, -15>(), double upper = fpm::detail::realMax<uint32_t, -15>(), Overflow ovfBx = Ovf::error > using u32qm15 = Q<uint32_t, -15, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t, -14>(), double upper = fpm::detail::realMax<uint32_t, -14>(), Overflow ovfBx = Ovf::error > using u32qm14 = Q<uint32_t, -14, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t, -13>(), double upper = fpm::detail::realMax<uint32_t, -13>(), Overflow ovfBx = Ovf::error > using u32qm13 = Q<uint32_t, -13, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t, -12>(), double upper = fpm::detail::realMax<uint32_t, -12>(), Overflow ovfBx = Ovf::error > using u32qm12 = Q<uint32_t, -12, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t, -11>(), double upper = fpm::detail::realMax<uint32_t, -11>(), Overflow ovfBx = Ovf::error > using u32qm11 = Q<uint32_t, -11, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t, -10>(), double upper = fpm::detail::realMax<uint32_t, -10>(), Overflow ovfBx = Ovf::error > using u32qm10 = Q<uint32_t, -10, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -9>(), double upper = fpm::detail::realMax<uint32_t,  -9>(), Overflow ovfBx = Ovf::error > using  u32qm9 = Q<uint32_t,  -9, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -8>(), double upper = fpm::detail::realMax<uint32_t,  -8>(), Overflow ovfBx = Ovf::error > using  u32qm8 = Q<uint32_t,  -8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -7>(), double upper = fpm::detail::realMax<uint32_t,  -7>(), Overflow ovfBx = Ovf::error > using  u32qm7 = Q<uint32_t,  -7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -6>(), double upper = fpm::detail::realMax<uint32_t,  -6>(), Overflow ovfBx = Ovf::error > using  u32qm6 = Q<uint32_t,  -6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -5>(), double upper = fpm::detail::realMax<uint32_t,  -5>(), Overflow ovfBx = Ovf::error > using  u32qm5 = Q<uint32_t,  -5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -4>(), double upper = fpm::detail::realMax<uint32_t,  -4>(), Overflow ovfBx = Ovf::error > using  u32qm4 = Q<uint32_t,  -4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -3>(), double upper = fpm::detail::realMax<uint32_t,  -3>(), Overflow ovfBx = Ovf::error > using  u32qm3 = Q<uint32_t,  -3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -2>(), double upper = fpm::detail::realMax<uint32_t,  -2>(), Overflow ovfBx = Ovf::error > using  u32qm2 = Q<uint32_t,  -2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  -1>(), double upper = fpm::detail::realMax<uint32_t,  -1>(), Overflow ovfBx = Ovf::error > using  u32qm1 = Q<uint32_t,  -1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   0>(), double upper = fpm::detail::realMax<uint32_t,   0>(), Overflow ovfBx = Ovf::error > using   u32q0 = Q<uint32_t,   0, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   1>(), double upper = fpm::detail::realMax<uint32_t,   1>(), Overflow ovfBx = Ovf::error > using   u32q1 = Q<uint32_t,   1, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   2>(), double upper = fpm::detail::realMax<uint32_t,   2>(), Overflow ovfBx = Ovf::error > using   u32q2 = Q<uint32_t,   2, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   3>(), double upper = fpm::detail::realMax<uint32_t,   3>(), Overflow ovfBx = Ovf::error > using   u32q3 = Q<uint32_t,   3, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   4>(), double upper = fpm::detail::realMax<uint32_t,   4>(), Overflow ovfBx = Ovf::error > using   u32q4 = Q<uint32_t,   4, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   5>(), double upper = fpm::detail::realMax<uint32_t,   5>(), Overflow ovfBx = Ovf::error > using   u32q5 = Q<uint32_t,   5, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   6>(), double upper = fpm::detail::realMax<uint32_t,   6>(), Overflow ovfBx = Ovf::error > using   u32q6 = Q<uint32_t,   6, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   7>(), double upper = fpm::detail::realMax<uint32_t,   7>(), Overflow ovfBx = Ovf::error > using   u32q7 = Q<uint32_t,   7, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   8>(), double upper = fpm::detail::realMax<uint32_t,   8>(), Overflow ovfBx = Ovf::error > using   u32q8 = Q<uint32_t,   8, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,   9>(), double upper = fpm::detail::realMax<uint32_t,   9>(), Overflow ovfBx = Ovf::error > using   u32q9 = Q<uint32_t,   9, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  10>(), double upper = fpm::detail::realMax<uint32_t,  10>(), Overflow ovfBx = Ovf::error > using  u32q10 = Q<uint32_t,  10, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  11>(), double upper = fpm::detail::realMax<uint32_t,  11>(), Overflow ovfBx = Ovf::error > using  u32q11 = Q<uint32_t,  11, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  12>(), double upper = fpm::detail::realMax<uint32_t,  12>(), Overflow ovfBx = Ovf::error > using  u32q12 = Q<uint32_t,  12, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  13>(), double upper = fpm::detail::realMax<uint32_t,  13>(), Overflow ovfBx = Ovf::error > using  u32q13 = Q<uint32_t,  13, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  14>(), double upper = fpm::detail::realMax<uint32_t,  14>(), Overflow ovfBx = Ovf::error > using  u32q14 = Q<uint32_t,  14, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  15>(), double upper = fpm::detail::realMax<uint32_t,  15>(), Overflow ovfBx = Ovf::error > using  u32q15 = Q<uint32_t,  15, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  16>(), double upper = fpm::detail::realMax<uint32_t,  16>(), Overflow ovfBx = Ovf::error > using  u32q16 = Q<uint32_t,  16, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  17>(), double upper = fpm::detail::realMax<uint32_t,  17>(), Overflow ovfBx = Ovf::error > using  u32q17 = Q<uint32_t,  17, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  18>(), double upper = fpm::detail::realMax<uint32_t,  18>(), Overflow ovfBx = Ovf::error > using  u32q18 = Q<uint32_t,  18, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  19>(), double upper = fpm::detail::realMax<uint32_t,  19>(), Overflow ovfBx = Ovf::error > using  u32q19 = Q<uint32_t,  19, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  20>(), double upper = fpm::detail::realMax<uint32_t,  20>(), Overflow ovfBx = Ovf::error > using  u32q20 = Q<uint32_t,  20, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  21>(), double upper = fpm::detail::realMax<uint32_t,  21>(), Overflow ovfBx = Ovf::error > using  u32q21 = Q<uint32_t,  21, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  22>(), double upper = fpm::detail::realMax<uint32_t,  22>(), Overflow ovfBx = Ovf::error > using  u32q22 = Q<uint32_t,  22, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  23>(), double upper = fpm::detail::realMax<uint32_t,  23>(), Overflow ovfBx = Ovf::error > using  u32q23 = Q<uint32_t,  23, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  24>(), double upper = fpm::detail::realMax<uint32_t,  24>(), Overflow ovfBx = Ovf::error > using  u32q24 = Q<uint32_t,  24, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  25>(), double upper = fpm::detail::realMax<uint32_t,  25>(), Overflow ovfBx = Ovf::error > using  u32q25 = Q<uint32_t,  25, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  26>(), double upper = fpm::detail::realMax<uint32_t,  26>(), Overflow ovfBx = Ovf::error > using  u32q26 = Q<uint32_t,  26, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  27>(), double upper = fpm::detail::realMax<uint32_t,  27>(), Overflow ovfBx = Ovf::error > using  u32q27 = Q<uint32_t,  27, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  28>(), double upper = fpm::detail::realMax<uint32_t,  28>(), Overflow ovfBx = Ovf::error > using  u32q28 = Q<uint32_t,  28, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  29>(), double upper = fpm::detail::realMax<uint32_t,  29>(), Overflow ovfBx = Ovf::error > using  u32q29 = Q<uint32_t,  29, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  30>(), double upper = fpm::detail::realMax<uint32_t,  30>(), Overflow ovfBx = Ovf::error > using  u32q30 = Q<uint32_t,  30, lower, upper, ovfBx>;
-template< double lower = fpm::detail::realMin<uint32_t,  31>(), double upper = fpm::detail::realMax<uint32_t,  31>(), Overflow ovfBx = Ovf::error > using  u32q31 = Q<uint32_t,  31, lower, upper, ovfBx>;
+template< double lower = fpm::detail::realMin<  int8_t,  -4>(), double upper = fpm::detail::realMax<  int8_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8qm4 = Q<  int8_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,  -3>(), double upper = fpm::detail::realMax<  int8_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8qm3 = Q<  int8_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,  -2>(), double upper = fpm::detail::realMax<  int8_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8qm2 = Q<  int8_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,  -1>(), double upper = fpm::detail::realMax<  int8_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8qm1 = Q<  int8_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   0>(), double upper = fpm::detail::realMax<  int8_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q0 = Q<  int8_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   1>(), double upper = fpm::detail::realMax<  int8_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q1 = Q<  int8_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   2>(), double upper = fpm::detail::realMax<  int8_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q2 = Q<  int8_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   3>(), double upper = fpm::detail::realMax<  int8_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q3 = Q<  int8_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   4>(), double upper = fpm::detail::realMax<  int8_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q4 = Q<  int8_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   5>(), double upper = fpm::detail::realMax<  int8_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q5 = Q<  int8_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   6>(), double upper = fpm::detail::realMax<  int8_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q6 = Q<  int8_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   7>(), double upper = fpm::detail::realMax<  int8_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8q7 = Q<  int8_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -4>(), double upper = fpm::detail::realMax< uint8_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8qm4 = Q< uint8_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -3>(), double upper = fpm::detail::realMax< uint8_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8qm3 = Q< uint8_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -2>(), double upper = fpm::detail::realMax< uint8_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8qm2 = Q< uint8_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -1>(), double upper = fpm::detail::realMax< uint8_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8qm1 = Q< uint8_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   0>(), double upper = fpm::detail::realMax< uint8_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q0 = Q< uint8_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   1>(), double upper = fpm::detail::realMax< uint8_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q1 = Q< uint8_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   2>(), double upper = fpm::detail::realMax< uint8_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q2 = Q< uint8_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   3>(), double upper = fpm::detail::realMax< uint8_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q3 = Q< uint8_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   4>(), double upper = fpm::detail::realMax< uint8_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q4 = Q< uint8_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   5>(), double upper = fpm::detail::realMax< uint8_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q5 = Q< uint8_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   6>(), double upper = fpm::detail::realMax< uint8_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q6 = Q< uint8_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   7>(), double upper = fpm::detail::realMax< uint8_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8q7 = Q< uint8_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -8>(), double upper = fpm::detail::realMax< int16_t,  -8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm8 = Q< int16_t,  -8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -7>(), double upper = fpm::detail::realMax< int16_t,  -7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm7 = Q< int16_t,  -7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -6>(), double upper = fpm::detail::realMax< int16_t,  -6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm6 = Q< int16_t,  -6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -5>(), double upper = fpm::detail::realMax< int16_t,  -5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm5 = Q< int16_t,  -5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -4>(), double upper = fpm::detail::realMax< int16_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm4 = Q< int16_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -3>(), double upper = fpm::detail::realMax< int16_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm3 = Q< int16_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -2>(), double upper = fpm::detail::realMax< int16_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm2 = Q< int16_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -1>(), double upper = fpm::detail::realMax< int16_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16qm1 = Q< int16_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   0>(), double upper = fpm::detail::realMax< int16_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q0 = Q< int16_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   1>(), double upper = fpm::detail::realMax< int16_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q1 = Q< int16_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   2>(), double upper = fpm::detail::realMax< int16_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q2 = Q< int16_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   3>(), double upper = fpm::detail::realMax< int16_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q3 = Q< int16_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   4>(), double upper = fpm::detail::realMax< int16_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q4 = Q< int16_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   5>(), double upper = fpm::detail::realMax< int16_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q5 = Q< int16_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   6>(), double upper = fpm::detail::realMax< int16_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q6 = Q< int16_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   7>(), double upper = fpm::detail::realMax< int16_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q7 = Q< int16_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   8>(), double upper = fpm::detail::realMax< int16_t,   8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q8 = Q< int16_t,   8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   9>(), double upper = fpm::detail::realMax< int16_t,   9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16q9 = Q< int16_t,   9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  10>(), double upper = fpm::detail::realMax< int16_t,  10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16q10 = Q< int16_t,  10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  11>(), double upper = fpm::detail::realMax< int16_t,  11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16q11 = Q< int16_t,  11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  12>(), double upper = fpm::detail::realMax< int16_t,  12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16q12 = Q< int16_t,  12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  13>(), double upper = fpm::detail::realMax< int16_t,  13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16q13 = Q< int16_t,  13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  14>(), double upper = fpm::detail::realMax< int16_t,  14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16q14 = Q< int16_t,  14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  15>(), double upper = fpm::detail::realMax< int16_t,  15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16q15 = Q< int16_t,  15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -8>(), double upper = fpm::detail::realMax<uint16_t,  -8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm8 = Q<uint16_t,  -8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -7>(), double upper = fpm::detail::realMax<uint16_t,  -7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm7 = Q<uint16_t,  -7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -6>(), double upper = fpm::detail::realMax<uint16_t,  -6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm6 = Q<uint16_t,  -6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -5>(), double upper = fpm::detail::realMax<uint16_t,  -5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm5 = Q<uint16_t,  -5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -4>(), double upper = fpm::detail::realMax<uint16_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm4 = Q<uint16_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -3>(), double upper = fpm::detail::realMax<uint16_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm3 = Q<uint16_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -2>(), double upper = fpm::detail::realMax<uint16_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm2 = Q<uint16_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -1>(), double upper = fpm::detail::realMax<uint16_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16qm1 = Q<uint16_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   0>(), double upper = fpm::detail::realMax<uint16_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q0 = Q<uint16_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   1>(), double upper = fpm::detail::realMax<uint16_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q1 = Q<uint16_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   2>(), double upper = fpm::detail::realMax<uint16_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q2 = Q<uint16_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   3>(), double upper = fpm::detail::realMax<uint16_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q3 = Q<uint16_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   4>(), double upper = fpm::detail::realMax<uint16_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q4 = Q<uint16_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   5>(), double upper = fpm::detail::realMax<uint16_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q5 = Q<uint16_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   6>(), double upper = fpm::detail::realMax<uint16_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q6 = Q<uint16_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   7>(), double upper = fpm::detail::realMax<uint16_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q7 = Q<uint16_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   8>(), double upper = fpm::detail::realMax<uint16_t,   8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q8 = Q<uint16_t,   8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   9>(), double upper = fpm::detail::realMax<uint16_t,   9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16q9 = Q<uint16_t,   9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  10>(), double upper = fpm::detail::realMax<uint16_t,  10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16q10 = Q<uint16_t,  10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  11>(), double upper = fpm::detail::realMax<uint16_t,  11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16q11 = Q<uint16_t,  11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  12>(), double upper = fpm::detail::realMax<uint16_t,  12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16q12 = Q<uint16_t,  12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  13>(), double upper = fpm::detail::realMax<uint16_t,  13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16q13 = Q<uint16_t,  13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  14>(), double upper = fpm::detail::realMax<uint16_t,  14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16q14 = Q<uint16_t,  14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  15>(), double upper = fpm::detail::realMax<uint16_t,  15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16q15 = Q<uint16_t,  15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -16>(), double upper = fpm::detail::realMax< int32_t, -16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32qm16 = Q< int32_t, -16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -15>(), double upper = fpm::detail::realMax< int32_t, -15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32qm15 = Q< int32_t, -15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -14>(), double upper = fpm::detail::realMax< int32_t, -14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32qm14 = Q< int32_t, -14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -13>(), double upper = fpm::detail::realMax< int32_t, -13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32qm13 = Q< int32_t, -13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -12>(), double upper = fpm::detail::realMax< int32_t, -12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32qm12 = Q< int32_t, -12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -11>(), double upper = fpm::detail::realMax< int32_t, -11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32qm11 = Q< int32_t, -11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -10>(), double upper = fpm::detail::realMax< int32_t, -10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32qm10 = Q< int32_t, -10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -9>(), double upper = fpm::detail::realMax< int32_t,  -9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm9 = Q< int32_t,  -9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -8>(), double upper = fpm::detail::realMax< int32_t,  -8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm8 = Q< int32_t,  -8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -7>(), double upper = fpm::detail::realMax< int32_t,  -7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm7 = Q< int32_t,  -7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -6>(), double upper = fpm::detail::realMax< int32_t,  -6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm6 = Q< int32_t,  -6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -5>(), double upper = fpm::detail::realMax< int32_t,  -5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm5 = Q< int32_t,  -5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -4>(), double upper = fpm::detail::realMax< int32_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm4 = Q< int32_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -3>(), double upper = fpm::detail::realMax< int32_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm3 = Q< int32_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -2>(), double upper = fpm::detail::realMax< int32_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm2 = Q< int32_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -1>(), double upper = fpm::detail::realMax< int32_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32qm1 = Q< int32_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   0>(), double upper = fpm::detail::realMax< int32_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q0 = Q< int32_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   1>(), double upper = fpm::detail::realMax< int32_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q1 = Q< int32_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   2>(), double upper = fpm::detail::realMax< int32_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q2 = Q< int32_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   3>(), double upper = fpm::detail::realMax< int32_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q3 = Q< int32_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   4>(), double upper = fpm::detail::realMax< int32_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q4 = Q< int32_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   5>(), double upper = fpm::detail::realMax< int32_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q5 = Q< int32_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   6>(), double upper = fpm::detail::realMax< int32_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q6 = Q< int32_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   7>(), double upper = fpm::detail::realMax< int32_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q7 = Q< int32_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   8>(), double upper = fpm::detail::realMax< int32_t,   8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q8 = Q< int32_t,   8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   9>(), double upper = fpm::detail::realMax< int32_t,   9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32q9 = Q< int32_t,   9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  10>(), double upper = fpm::detail::realMax< int32_t,  10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q10 = Q< int32_t,  10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  11>(), double upper = fpm::detail::realMax< int32_t,  11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q11 = Q< int32_t,  11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  12>(), double upper = fpm::detail::realMax< int32_t,  12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q12 = Q< int32_t,  12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  13>(), double upper = fpm::detail::realMax< int32_t,  13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q13 = Q< int32_t,  13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  14>(), double upper = fpm::detail::realMax< int32_t,  14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q14 = Q< int32_t,  14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  15>(), double upper = fpm::detail::realMax< int32_t,  15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q15 = Q< int32_t,  15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  16>(), double upper = fpm::detail::realMax< int32_t,  16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q16 = Q< int32_t,  16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  17>(), double upper = fpm::detail::realMax< int32_t,  17>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q17 = Q< int32_t,  17, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  18>(), double upper = fpm::detail::realMax< int32_t,  18>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q18 = Q< int32_t,  18, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  19>(), double upper = fpm::detail::realMax< int32_t,  19>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q19 = Q< int32_t,  19, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  20>(), double upper = fpm::detail::realMax< int32_t,  20>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q20 = Q< int32_t,  20, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  21>(), double upper = fpm::detail::realMax< int32_t,  21>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q21 = Q< int32_t,  21, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  22>(), double upper = fpm::detail::realMax< int32_t,  22>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q22 = Q< int32_t,  22, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  23>(), double upper = fpm::detail::realMax< int32_t,  23>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q23 = Q< int32_t,  23, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  24>(), double upper = fpm::detail::realMax< int32_t,  24>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q24 = Q< int32_t,  24, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  25>(), double upper = fpm::detail::realMax< int32_t,  25>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q25 = Q< int32_t,  25, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  26>(), double upper = fpm::detail::realMax< int32_t,  26>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q26 = Q< int32_t,  26, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  27>(), double upper = fpm::detail::realMax< int32_t,  27>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q27 = Q< int32_t,  27, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  28>(), double upper = fpm::detail::realMax< int32_t,  28>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q28 = Q< int32_t,  28, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  29>(), double upper = fpm::detail::realMax< int32_t,  29>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q29 = Q< int32_t,  29, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  30>(), double upper = fpm::detail::realMax< int32_t,  30>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q30 = Q< int32_t,  30, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  31>(), double upper = fpm::detail::realMax< int32_t,  31>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32q31 = Q< int32_t,  31, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -16>(), double upper = fpm::detail::realMax<uint32_t, -16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32qm16 = Q<uint32_t, -16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -15>(), double upper = fpm::detail::realMax<uint32_t, -15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32qm15 = Q<uint32_t, -15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -14>(), double upper = fpm::detail::realMax<uint32_t, -14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32qm14 = Q<uint32_t, -14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -13>(), double upper = fpm::detail::realMax<uint32_t, -13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32qm13 = Q<uint32_t, -13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -12>(), double upper = fpm::detail::realMax<uint32_t, -12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32qm12 = Q<uint32_t, -12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -11>(), double upper = fpm::detail::realMax<uint32_t, -11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32qm11 = Q<uint32_t, -11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -10>(), double upper = fpm::detail::realMax<uint32_t, -10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32qm10 = Q<uint32_t, -10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -9>(), double upper = fpm::detail::realMax<uint32_t,  -9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm9 = Q<uint32_t,  -9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -8>(), double upper = fpm::detail::realMax<uint32_t,  -8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm8 = Q<uint32_t,  -8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -7>(), double upper = fpm::detail::realMax<uint32_t,  -7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm7 = Q<uint32_t,  -7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -6>(), double upper = fpm::detail::realMax<uint32_t,  -6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm6 = Q<uint32_t,  -6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -5>(), double upper = fpm::detail::realMax<uint32_t,  -5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm5 = Q<uint32_t,  -5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -4>(), double upper = fpm::detail::realMax<uint32_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm4 = Q<uint32_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -3>(), double upper = fpm::detail::realMax<uint32_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm3 = Q<uint32_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -2>(), double upper = fpm::detail::realMax<uint32_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm2 = Q<uint32_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -1>(), double upper = fpm::detail::realMax<uint32_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32qm1 = Q<uint32_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   0>(), double upper = fpm::detail::realMax<uint32_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q0 = Q<uint32_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   1>(), double upper = fpm::detail::realMax<uint32_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q1 = Q<uint32_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   2>(), double upper = fpm::detail::realMax<uint32_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q2 = Q<uint32_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   3>(), double upper = fpm::detail::realMax<uint32_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q3 = Q<uint32_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   4>(), double upper = fpm::detail::realMax<uint32_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q4 = Q<uint32_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   5>(), double upper = fpm::detail::realMax<uint32_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q5 = Q<uint32_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   6>(), double upper = fpm::detail::realMax<uint32_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q6 = Q<uint32_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   7>(), double upper = fpm::detail::realMax<uint32_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q7 = Q<uint32_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   8>(), double upper = fpm::detail::realMax<uint32_t,   8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q8 = Q<uint32_t,   8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   9>(), double upper = fpm::detail::realMax<uint32_t,   9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32q9 = Q<uint32_t,   9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  10>(), double upper = fpm::detail::realMax<uint32_t,  10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q10 = Q<uint32_t,  10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  11>(), double upper = fpm::detail::realMax<uint32_t,  11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q11 = Q<uint32_t,  11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  12>(), double upper = fpm::detail::realMax<uint32_t,  12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q12 = Q<uint32_t,  12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  13>(), double upper = fpm::detail::realMax<uint32_t,  13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q13 = Q<uint32_t,  13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  14>(), double upper = fpm::detail::realMax<uint32_t,  14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q14 = Q<uint32_t,  14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  15>(), double upper = fpm::detail::realMax<uint32_t,  15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q15 = Q<uint32_t,  15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  16>(), double upper = fpm::detail::realMax<uint32_t,  16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q16 = Q<uint32_t,  16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  17>(), double upper = fpm::detail::realMax<uint32_t,  17>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q17 = Q<uint32_t,  17, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  18>(), double upper = fpm::detail::realMax<uint32_t,  18>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q18 = Q<uint32_t,  18, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  19>(), double upper = fpm::detail::realMax<uint32_t,  19>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q19 = Q<uint32_t,  19, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  20>(), double upper = fpm::detail::realMax<uint32_t,  20>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q20 = Q<uint32_t,  20, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  21>(), double upper = fpm::detail::realMax<uint32_t,  21>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q21 = Q<uint32_t,  21, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  22>(), double upper = fpm::detail::realMax<uint32_t,  22>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q22 = Q<uint32_t,  22, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  23>(), double upper = fpm::detail::realMax<uint32_t,  23>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q23 = Q<uint32_t,  23, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  24>(), double upper = fpm::detail::realMax<uint32_t,  24>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q24 = Q<uint32_t,  24, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  25>(), double upper = fpm::detail::realMax<uint32_t,  25>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q25 = Q<uint32_t,  25, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  26>(), double upper = fpm::detail::realMax<uint32_t,  26>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q26 = Q<uint32_t,  26, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  27>(), double upper = fpm::detail::realMax<uint32_t,  27>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q27 = Q<uint32_t,  27, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  28>(), double upper = fpm::detail::realMax<uint32_t,  28>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q28 = Q<uint32_t,  28, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  29>(), double upper = fpm::detail::realMax<uint32_t,  29>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q29 = Q<uint32_t,  29, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  30>(), double upper = fpm::detail::realMax<uint32_t,  30>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q30 = Q<uint32_t,  30, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  31>(), double upper = fpm::detail::realMax<uint32_t,  31>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32q31 = Q<uint32_t,  31, lower, upper, ovfBx, rnd>;
+
+#if defined __SIZEOF_INT128__  // 64-bit types need 128-bit intermediate types
+template< double lower = fpm::detail::realMin< int64_t, -32>(), double upper = fpm::detail::realMax< int64_t, -32>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm32 = Q< int64_t, -32, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -31>(), double upper = fpm::detail::realMax< int64_t, -31>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm31 = Q< int64_t, -31, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -30>(), double upper = fpm::detail::realMax< int64_t, -30>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm30 = Q< int64_t, -30, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -29>(), double upper = fpm::detail::realMax< int64_t, -29>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm29 = Q< int64_t, -29, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -28>(), double upper = fpm::detail::realMax< int64_t, -28>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm28 = Q< int64_t, -28, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -27>(), double upper = fpm::detail::realMax< int64_t, -27>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm27 = Q< int64_t, -27, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -26>(), double upper = fpm::detail::realMax< int64_t, -26>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm26 = Q< int64_t, -26, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -25>(), double upper = fpm::detail::realMax< int64_t, -25>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm25 = Q< int64_t, -25, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -24>(), double upper = fpm::detail::realMax< int64_t, -24>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm24 = Q< int64_t, -24, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -23>(), double upper = fpm::detail::realMax< int64_t, -23>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm23 = Q< int64_t, -23, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -22>(), double upper = fpm::detail::realMax< int64_t, -22>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm22 = Q< int64_t, -22, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -21>(), double upper = fpm::detail::realMax< int64_t, -21>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm21 = Q< int64_t, -21, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -20>(), double upper = fpm::detail::realMax< int64_t, -20>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm20 = Q< int64_t, -20, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -19>(), double upper = fpm::detail::realMax< int64_t, -19>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm19 = Q< int64_t, -19, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -18>(), double upper = fpm::detail::realMax< int64_t, -18>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm18 = Q< int64_t, -18, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -17>(), double upper = fpm::detail::realMax< int64_t, -17>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm17 = Q< int64_t, -17, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -16>(), double upper = fpm::detail::realMax< int64_t, -16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm16 = Q< int64_t, -16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -15>(), double upper = fpm::detail::realMax< int64_t, -15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm15 = Q< int64_t, -15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -14>(), double upper = fpm::detail::realMax< int64_t, -14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm14 = Q< int64_t, -14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -13>(), double upper = fpm::detail::realMax< int64_t, -13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm13 = Q< int64_t, -13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -12>(), double upper = fpm::detail::realMax< int64_t, -12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm12 = Q< int64_t, -12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -11>(), double upper = fpm::detail::realMax< int64_t, -11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm11 = Q< int64_t, -11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -10>(), double upper = fpm::detail::realMax< int64_t, -10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64qm10 = Q< int64_t, -10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -9>(), double upper = fpm::detail::realMax< int64_t,  -9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm9 = Q< int64_t,  -9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -8>(), double upper = fpm::detail::realMax< int64_t,  -8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm8 = Q< int64_t,  -8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -7>(), double upper = fpm::detail::realMax< int64_t,  -7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm7 = Q< int64_t,  -7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -6>(), double upper = fpm::detail::realMax< int64_t,  -6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm6 = Q< int64_t,  -6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -5>(), double upper = fpm::detail::realMax< int64_t,  -5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm5 = Q< int64_t,  -5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -4>(), double upper = fpm::detail::realMax< int64_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm4 = Q< int64_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -3>(), double upper = fpm::detail::realMax< int64_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm3 = Q< int64_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -2>(), double upper = fpm::detail::realMax< int64_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm2 = Q< int64_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -1>(), double upper = fpm::detail::realMax< int64_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64qm1 = Q< int64_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   0>(), double upper = fpm::detail::realMax< int64_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q0 = Q< int64_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   1>(), double upper = fpm::detail::realMax< int64_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q1 = Q< int64_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   2>(), double upper = fpm::detail::realMax< int64_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q2 = Q< int64_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   3>(), double upper = fpm::detail::realMax< int64_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q3 = Q< int64_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   4>(), double upper = fpm::detail::realMax< int64_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q4 = Q< int64_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   5>(), double upper = fpm::detail::realMax< int64_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q5 = Q< int64_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   6>(), double upper = fpm::detail::realMax< int64_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q6 = Q< int64_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   7>(), double upper = fpm::detail::realMax< int64_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q7 = Q< int64_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   8>(), double upper = fpm::detail::realMax< int64_t,   8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q8 = Q< int64_t,   8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   9>(), double upper = fpm::detail::realMax< int64_t,   9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64q9 = Q< int64_t,   9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  10>(), double upper = fpm::detail::realMax< int64_t,  10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q10 = Q< int64_t,  10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  11>(), double upper = fpm::detail::realMax< int64_t,  11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q11 = Q< int64_t,  11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  12>(), double upper = fpm::detail::realMax< int64_t,  12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q12 = Q< int64_t,  12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  13>(), double upper = fpm::detail::realMax< int64_t,  13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q13 = Q< int64_t,  13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  14>(), double upper = fpm::detail::realMax< int64_t,  14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q14 = Q< int64_t,  14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  15>(), double upper = fpm::detail::realMax< int64_t,  15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q15 = Q< int64_t,  15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  16>(), double upper = fpm::detail::realMax< int64_t,  16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q16 = Q< int64_t,  16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  17>(), double upper = fpm::detail::realMax< int64_t,  17>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q17 = Q< int64_t,  17, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  18>(), double upper = fpm::detail::realMax< int64_t,  18>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q18 = Q< int64_t,  18, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  19>(), double upper = fpm::detail::realMax< int64_t,  19>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q19 = Q< int64_t,  19, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  20>(), double upper = fpm::detail::realMax< int64_t,  20>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q20 = Q< int64_t,  20, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  21>(), double upper = fpm::detail::realMax< int64_t,  21>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q21 = Q< int64_t,  21, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  22>(), double upper = fpm::detail::realMax< int64_t,  22>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q22 = Q< int64_t,  22, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  23>(), double upper = fpm::detail::realMax< int64_t,  23>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q23 = Q< int64_t,  23, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  24>(), double upper = fpm::detail::realMax< int64_t,  24>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q24 = Q< int64_t,  24, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  25>(), double upper = fpm::detail::realMax< int64_t,  25>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q25 = Q< int64_t,  25, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  26>(), double upper = fpm::detail::realMax< int64_t,  26>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q26 = Q< int64_t,  26, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  27>(), double upper = fpm::detail::realMax< int64_t,  27>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q27 = Q< int64_t,  27, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  28>(), double upper = fpm::detail::realMax< int64_t,  28>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q28 = Q< int64_t,  28, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  29>(), double upper = fpm::detail::realMax< int64_t,  29>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q29 = Q< int64_t,  29, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  30>(), double upper = fpm::detail::realMax< int64_t,  30>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q30 = Q< int64_t,  30, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  31>(), double upper = fpm::detail::realMax< int64_t,  31>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q31 = Q< int64_t,  31, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  32>(), double upper = fpm::detail::realMax< int64_t,  32>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q32 = Q< int64_t,  32, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  33>(), double upper = fpm::detail::realMax< int64_t,  33>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q33 = Q< int64_t,  33, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  34>(), double upper = fpm::detail::realMax< int64_t,  34>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q34 = Q< int64_t,  34, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  35>(), double upper = fpm::detail::realMax< int64_t,  35>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q35 = Q< int64_t,  35, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  36>(), double upper = fpm::detail::realMax< int64_t,  36>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q36 = Q< int64_t,  36, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  37>(), double upper = fpm::detail::realMax< int64_t,  37>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q37 = Q< int64_t,  37, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  38>(), double upper = fpm::detail::realMax< int64_t,  38>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q38 = Q< int64_t,  38, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  39>(), double upper = fpm::detail::realMax< int64_t,  39>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q39 = Q< int64_t,  39, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  40>(), double upper = fpm::detail::realMax< int64_t,  40>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q40 = Q< int64_t,  40, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  41>(), double upper = fpm::detail::realMax< int64_t,  41>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q41 = Q< int64_t,  41, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  42>(), double upper = fpm::detail::realMax< int64_t,  42>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q42 = Q< int64_t,  42, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  43>(), double upper = fpm::detail::realMax< int64_t,  43>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q43 = Q< int64_t,  43, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  44>(), double upper = fpm::detail::realMax< int64_t,  44>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q44 = Q< int64_t,  44, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  45>(), double upper = fpm::detail::realMax< int64_t,  45>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q45 = Q< int64_t,  45, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  46>(), double upper = fpm::detail::realMax< int64_t,  46>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q46 = Q< int64_t,  46, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  47>(), double upper = fpm::detail::realMax< int64_t,  47>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q47 = Q< int64_t,  47, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  48>(), double upper = fpm::detail::realMax< int64_t,  48>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q48 = Q< int64_t,  48, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  49>(), double upper = fpm::detail::realMax< int64_t,  49>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q49 = Q< int64_t,  49, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  50>(), double upper = fpm::detail::realMax< int64_t,  50>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q50 = Q< int64_t,  50, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  51>(), double upper = fpm::detail::realMax< int64_t,  51>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q51 = Q< int64_t,  51, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  52>(), double upper = fpm::detail::realMax< int64_t,  52>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q52 = Q< int64_t,  52, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  53>(), double upper = fpm::detail::realMax< int64_t,  53>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64q53 = Q< int64_t,  53, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -32>(), double upper = fpm::detail::realMax<uint64_t, -32>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm32 = Q<uint64_t, -32, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -31>(), double upper = fpm::detail::realMax<uint64_t, -31>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm31 = Q<uint64_t, -31, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -30>(), double upper = fpm::detail::realMax<uint64_t, -30>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm30 = Q<uint64_t, -30, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -29>(), double upper = fpm::detail::realMax<uint64_t, -29>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm29 = Q<uint64_t, -29, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -28>(), double upper = fpm::detail::realMax<uint64_t, -28>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm28 = Q<uint64_t, -28, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -27>(), double upper = fpm::detail::realMax<uint64_t, -27>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm27 = Q<uint64_t, -27, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -26>(), double upper = fpm::detail::realMax<uint64_t, -26>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm26 = Q<uint64_t, -26, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -25>(), double upper = fpm::detail::realMax<uint64_t, -25>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm25 = Q<uint64_t, -25, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -24>(), double upper = fpm::detail::realMax<uint64_t, -24>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm24 = Q<uint64_t, -24, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -23>(), double upper = fpm::detail::realMax<uint64_t, -23>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm23 = Q<uint64_t, -23, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -22>(), double upper = fpm::detail::realMax<uint64_t, -22>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm22 = Q<uint64_t, -22, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -21>(), double upper = fpm::detail::realMax<uint64_t, -21>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm21 = Q<uint64_t, -21, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -20>(), double upper = fpm::detail::realMax<uint64_t, -20>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm20 = Q<uint64_t, -20, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -19>(), double upper = fpm::detail::realMax<uint64_t, -19>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm19 = Q<uint64_t, -19, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -18>(), double upper = fpm::detail::realMax<uint64_t, -18>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm18 = Q<uint64_t, -18, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -17>(), double upper = fpm::detail::realMax<uint64_t, -17>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm17 = Q<uint64_t, -17, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -16>(), double upper = fpm::detail::realMax<uint64_t, -16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm16 = Q<uint64_t, -16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -15>(), double upper = fpm::detail::realMax<uint64_t, -15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm15 = Q<uint64_t, -15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -14>(), double upper = fpm::detail::realMax<uint64_t, -14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm14 = Q<uint64_t, -14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -13>(), double upper = fpm::detail::realMax<uint64_t, -13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm13 = Q<uint64_t, -13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -12>(), double upper = fpm::detail::realMax<uint64_t, -12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm12 = Q<uint64_t, -12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -11>(), double upper = fpm::detail::realMax<uint64_t, -11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm11 = Q<uint64_t, -11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -10>(), double upper = fpm::detail::realMax<uint64_t, -10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64qm10 = Q<uint64_t, -10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -9>(), double upper = fpm::detail::realMax<uint64_t,  -9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm9 = Q<uint64_t,  -9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -8>(), double upper = fpm::detail::realMax<uint64_t,  -8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm8 = Q<uint64_t,  -8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -7>(), double upper = fpm::detail::realMax<uint64_t,  -7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm7 = Q<uint64_t,  -7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -6>(), double upper = fpm::detail::realMax<uint64_t,  -6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm6 = Q<uint64_t,  -6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -5>(), double upper = fpm::detail::realMax<uint64_t,  -5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm5 = Q<uint64_t,  -5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -4>(), double upper = fpm::detail::realMax<uint64_t,  -4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm4 = Q<uint64_t,  -4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -3>(), double upper = fpm::detail::realMax<uint64_t,  -3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm3 = Q<uint64_t,  -3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -2>(), double upper = fpm::detail::realMax<uint64_t,  -2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm2 = Q<uint64_t,  -2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -1>(), double upper = fpm::detail::realMax<uint64_t,  -1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64qm1 = Q<uint64_t,  -1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   0>(), double upper = fpm::detail::realMax<uint64_t,   0>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q0 = Q<uint64_t,   0, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   1>(), double upper = fpm::detail::realMax<uint64_t,   1>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q1 = Q<uint64_t,   1, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   2>(), double upper = fpm::detail::realMax<uint64_t,   2>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q2 = Q<uint64_t,   2, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   3>(), double upper = fpm::detail::realMax<uint64_t,   3>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q3 = Q<uint64_t,   3, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   4>(), double upper = fpm::detail::realMax<uint64_t,   4>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q4 = Q<uint64_t,   4, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   5>(), double upper = fpm::detail::realMax<uint64_t,   5>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q5 = Q<uint64_t,   5, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   6>(), double upper = fpm::detail::realMax<uint64_t,   6>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q6 = Q<uint64_t,   6, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   7>(), double upper = fpm::detail::realMax<uint64_t,   7>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q7 = Q<uint64_t,   7, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   8>(), double upper = fpm::detail::realMax<uint64_t,   8>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q8 = Q<uint64_t,   8, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   9>(), double upper = fpm::detail::realMax<uint64_t,   9>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64q9 = Q<uint64_t,   9, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  10>(), double upper = fpm::detail::realMax<uint64_t,  10>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q10 = Q<uint64_t,  10, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  11>(), double upper = fpm::detail::realMax<uint64_t,  11>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q11 = Q<uint64_t,  11, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  12>(), double upper = fpm::detail::realMax<uint64_t,  12>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q12 = Q<uint64_t,  12, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  13>(), double upper = fpm::detail::realMax<uint64_t,  13>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q13 = Q<uint64_t,  13, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  14>(), double upper = fpm::detail::realMax<uint64_t,  14>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q14 = Q<uint64_t,  14, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  15>(), double upper = fpm::detail::realMax<uint64_t,  15>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q15 = Q<uint64_t,  15, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  16>(), double upper = fpm::detail::realMax<uint64_t,  16>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q16 = Q<uint64_t,  16, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  17>(), double upper = fpm::detail::realMax<uint64_t,  17>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q17 = Q<uint64_t,  17, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  18>(), double upper = fpm::detail::realMax<uint64_t,  18>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q18 = Q<uint64_t,  18, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  19>(), double upper = fpm::detail::realMax<uint64_t,  19>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q19 = Q<uint64_t,  19, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  20>(), double upper = fpm::detail::realMax<uint64_t,  20>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q20 = Q<uint64_t,  20, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  21>(), double upper = fpm::detail::realMax<uint64_t,  21>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q21 = Q<uint64_t,  21, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  22>(), double upper = fpm::detail::realMax<uint64_t,  22>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q22 = Q<uint64_t,  22, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  23>(), double upper = fpm::detail::realMax<uint64_t,  23>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q23 = Q<uint64_t,  23, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  24>(), double upper = fpm::detail::realMax<uint64_t,  24>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q24 = Q<uint64_t,  24, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  25>(), double upper = fpm::detail::realMax<uint64_t,  25>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q25 = Q<uint64_t,  25, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  26>(), double upper = fpm::detail::realMax<uint64_t,  26>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q26 = Q<uint64_t,  26, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  27>(), double upper = fpm::detail::realMax<uint64_t,  27>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q27 = Q<uint64_t,  27, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  28>(), double upper = fpm::detail::realMax<uint64_t,  28>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q28 = Q<uint64_t,  28, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  29>(), double upper = fpm::detail::realMax<uint64_t,  29>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q29 = Q<uint64_t,  29, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  30>(), double upper = fpm::detail::realMax<uint64_t,  30>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q30 = Q<uint64_t,  30, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  31>(), double upper = fpm::detail::realMax<uint64_t,  31>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q31 = Q<uint64_t,  31, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  32>(), double upper = fpm::detail::realMax<uint64_t,  32>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q32 = Q<uint64_t,  32, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  33>(), double upper = fpm::detail::realMax<uint64_t,  33>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q33 = Q<uint64_t,  33, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  34>(), double upper = fpm::detail::realMax<uint64_t,  34>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q34 = Q<uint64_t,  34, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  35>(), double upper = fpm::detail::realMax<uint64_t,  35>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q35 = Q<uint64_t,  35, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  36>(), double upper = fpm::detail::realMax<uint64_t,  36>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q36 = Q<uint64_t,  36, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  37>(), double upper = fpm::detail::realMax<uint64_t,  37>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q37 = Q<uint64_t,  37, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  38>(), double upper = fpm::detail::realMax<uint64_t,  38>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q38 = Q<uint64_t,  38, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  39>(), double upper = fpm::detail::realMax<uint64_t,  39>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q39 = Q<uint64_t,  39, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  40>(), double upper = fpm::detail::realMax<uint64_t,  40>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q40 = Q<uint64_t,  40, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  41>(), double upper = fpm::detail::realMax<uint64_t,  41>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q41 = Q<uint64_t,  41, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  42>(), double upper = fpm::detail::realMax<uint64_t,  42>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q42 = Q<uint64_t,  42, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  43>(), double upper = fpm::detail::realMax<uint64_t,  43>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q43 = Q<uint64_t,  43, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  44>(), double upper = fpm::detail::realMax<uint64_t,  44>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q44 = Q<uint64_t,  44, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  45>(), double upper = fpm::detail::realMax<uint64_t,  45>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q45 = Q<uint64_t,  45, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  46>(), double upper = fpm::detail::realMax<uint64_t,  46>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q46 = Q<uint64_t,  46, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  47>(), double upper = fpm::detail::realMax<uint64_t,  47>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q47 = Q<uint64_t,  47, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  48>(), double upper = fpm::detail::realMax<uint64_t,  48>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q48 = Q<uint64_t,  48, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  49>(), double upper = fpm::detail::realMax<uint64_t,  49>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q49 = Q<uint64_t,  49, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  50>(), double upper = fpm::detail::realMax<uint64_t,  50>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q50 = Q<uint64_t,  50, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  51>(), double upper = fpm::detail::realMax<uint64_t,  51>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q51 = Q<uint64_t,  51, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  52>(), double upper = fpm::detail::realMax<uint64_t,  52>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q52 = Q<uint64_t,  52, lower, upper, ovfBx, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  53>(), double upper = fpm::detail::realMax<uint64_t,  53>(), Overflow ovfBx = Ovf::error, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64q53 = Q<uint64_t,  53, lower, upper, ovfBx, rnd>;
+#endif
 
 /* literal operators */
 
@@ -366,6 +541,181 @@ FPM_Q_BIND_LITERAL( u32q29<>, u32q29 )
 FPM_Q_BIND_LITERAL( u32q30<>, u32q30 )
 FPM_Q_BIND_LITERAL( u32q31<>, u32q31 )
 
+#if defined __SIZEOF_INT128__
+FPM_Q_BIND_LITERAL(i64qm32<>, i64qm32)
+FPM_Q_BIND_LITERAL(i64qm31<>, i64qm31)
+FPM_Q_BIND_LITERAL(i64qm30<>, i64qm30)
+FPM_Q_BIND_LITERAL(i64qm29<>, i64qm29)
+FPM_Q_BIND_LITERAL(i64qm28<>, i64qm28)
+FPM_Q_BIND_LITERAL(i64qm27<>, i64qm27)
+FPM_Q_BIND_LITERAL(i64qm26<>, i64qm26)
+FPM_Q_BIND_LITERAL(i64qm25<>, i64qm25)
+FPM_Q_BIND_LITERAL(i64qm24<>, i64qm24)
+FPM_Q_BIND_LITERAL(i64qm23<>, i64qm23)
+FPM_Q_BIND_LITERAL(i64qm22<>, i64qm22)
+FPM_Q_BIND_LITERAL(i64qm21<>, i64qm21)
+FPM_Q_BIND_LITERAL(i64qm20<>, i64qm20)
+FPM_Q_BIND_LITERAL(i64qm19<>, i64qm19)
+FPM_Q_BIND_LITERAL(i64qm18<>, i64qm18)
+FPM_Q_BIND_LITERAL(i64qm17<>, i64qm17)
+FPM_Q_BIND_LITERAL(i64qm16<>, i64qm16)
+FPM_Q_BIND_LITERAL(i64qm15<>, i64qm15)
+FPM_Q_BIND_LITERAL(i64qm14<>, i64qm14)
+FPM_Q_BIND_LITERAL(i64qm13<>, i64qm13)
+FPM_Q_BIND_LITERAL(i64qm12<>, i64qm12)
+FPM_Q_BIND_LITERAL(i64qm11<>, i64qm11)
+FPM_Q_BIND_LITERAL(i64qm10<>, i64qm10)
+FPM_Q_BIND_LITERAL( i64qm9<>, i64qm9 )
+FPM_Q_BIND_LITERAL( i64qm8<>, i64qm8 )
+FPM_Q_BIND_LITERAL( i64qm7<>, i64qm7 )
+FPM_Q_BIND_LITERAL( i64qm6<>, i64qm6 )
+FPM_Q_BIND_LITERAL( i64qm5<>, i64qm5 )
+FPM_Q_BIND_LITERAL( i64qm4<>, i64qm4 )
+FPM_Q_BIND_LITERAL( i64qm3<>, i64qm3 )
+FPM_Q_BIND_LITERAL( i64qm2<>, i64qm2 )
+FPM_Q_BIND_LITERAL( i64qm1<>, i64qm1 )
+FPM_Q_BIND_LITERAL(  i64q0<>, i64q0  )
+FPM_Q_BIND_LITERAL(  i64q1<>, i64q1  )
+FPM_Q_BIND_LITERAL(  i64q2<>, i64q2  )
+FPM_Q_BIND_LITERAL(  i64q3<>, i64q3  )
+FPM_Q_BIND_LITERAL(  i64q4<>, i64q4  )
+FPM_Q_BIND_LITERAL(  i64q5<>, i64q5  )
+FPM_Q_BIND_LITERAL(  i64q6<>, i64q6  )
+FPM_Q_BIND_LITERAL(  i64q7<>, i64q7  )
+FPM_Q_BIND_LITERAL(  i64q8<>, i64q8  )
+FPM_Q_BIND_LITERAL(  i64q9<>, i64q9  )
+FPM_Q_BIND_LITERAL( i64q10<>, i64q10 )
+FPM_Q_BIND_LITERAL( i64q11<>, i64q11 )
+FPM_Q_BIND_LITERAL( i64q12<>, i64q12 )
+FPM_Q_BIND_LITERAL( i64q13<>, i64q13 )
+FPM_Q_BIND_LITERAL( i64q14<>, i64q14 )
+FPM_Q_BIND_LITERAL( i64q15<>, i64q15 )
+FPM_Q_BIND_LITERAL( i64q16<>, i64q16 )
+FPM_Q_BIND_LITERAL( i64q17<>, i64q17 )
+FPM_Q_BIND_LITERAL( i64q18<>, i64q18 )
+FPM_Q_BIND_LITERAL( i64q19<>, i64q19 )
+FPM_Q_BIND_LITERAL( i64q20<>, i64q20 )
+FPM_Q_BIND_LITERAL( i64q21<>, i64q21 )
+FPM_Q_BIND_LITERAL( i64q22<>, i64q22 )
+FPM_Q_BIND_LITERAL( i64q23<>, i64q23 )
+FPM_Q_BIND_LITERAL( i64q24<>, i64q24 )
+FPM_Q_BIND_LITERAL( i64q25<>, i64q25 )
+FPM_Q_BIND_LITERAL( i64q26<>, i64q26 )
+FPM_Q_BIND_LITERAL( i64q27<>, i64q27 )
+FPM_Q_BIND_LITERAL( i64q28<>, i64q28 )
+FPM_Q_BIND_LITERAL( i64q29<>, i64q29 )
+FPM_Q_BIND_LITERAL( i64q30<>, i64q30 )
+FPM_Q_BIND_LITERAL( i64q31<>, i64q31 )
+FPM_Q_BIND_LITERAL( i64q32<>, i64q32 )
+FPM_Q_BIND_LITERAL( i64q33<>, i64q33 )
+FPM_Q_BIND_LITERAL( i64q34<>, i64q34 )
+FPM_Q_BIND_LITERAL( i64q35<>, i64q35 )
+FPM_Q_BIND_LITERAL( i64q36<>, i64q36 )
+FPM_Q_BIND_LITERAL( i64q37<>, i64q37 )
+FPM_Q_BIND_LITERAL( i64q38<>, i64q38 )
+FPM_Q_BIND_LITERAL( i64q39<>, i64q39 )
+FPM_Q_BIND_LITERAL( i64q40<>, i64q40 )
+FPM_Q_BIND_LITERAL( i64q41<>, i64q41 )
+FPM_Q_BIND_LITERAL( i64q42<>, i64q42 )
+FPM_Q_BIND_LITERAL( i64q43<>, i64q43 )
+FPM_Q_BIND_LITERAL( i64q44<>, i64q44 )
+FPM_Q_BIND_LITERAL( i64q45<>, i64q45 )
+FPM_Q_BIND_LITERAL( i64q46<>, i64q46 )
+FPM_Q_BIND_LITERAL( i64q47<>, i64q47 )
+FPM_Q_BIND_LITERAL( i64q48<>, i64q48 )
+FPM_Q_BIND_LITERAL( i64q49<>, i64q49 )
+FPM_Q_BIND_LITERAL( i64q50<>, i64q50 )
+FPM_Q_BIND_LITERAL( i64q51<>, i64q51 )
+FPM_Q_BIND_LITERAL( i64q52<>, i64q52 )
+FPM_Q_BIND_LITERAL( i64q53<>, i64q53 )
+FPM_Q_BIND_LITERAL(u64qm32<>, u64qm32)
+FPM_Q_BIND_LITERAL(u64qm31<>, u64qm31)
+FPM_Q_BIND_LITERAL(u64qm30<>, u64qm30)
+FPM_Q_BIND_LITERAL(u64qm29<>, u64qm29)
+FPM_Q_BIND_LITERAL(u64qm28<>, u64qm28)
+FPM_Q_BIND_LITERAL(u64qm27<>, u64qm27)
+FPM_Q_BIND_LITERAL(u64qm26<>, u64qm26)
+FPM_Q_BIND_LITERAL(u64qm25<>, u64qm25)
+FPM_Q_BIND_LITERAL(u64qm24<>, u64qm24)
+FPM_Q_BIND_LITERAL(u64qm23<>, u64qm23)
+FPM_Q_BIND_LITERAL(u64qm22<>, u64qm22)
+FPM_Q_BIND_LITERAL(u64qm21<>, u64qm21)
+FPM_Q_BIND_LITERAL(u64qm20<>, u64qm20)
+FPM_Q_BIND_LITERAL(u64qm19<>, u64qm19)
+FPM_Q_BIND_LITERAL(u64qm18<>, u64qm18)
+FPM_Q_BIND_LITERAL(u64qm17<>, u64qm17)
+FPM_Q_BIND_LITERAL(u64qm16<>, u64qm16)
+FPM_Q_BIND_LITERAL(u64qm15<>, u64qm15)
+FPM_Q_BIND_LITERAL(u64qm14<>, u64qm14)
+FPM_Q_BIND_LITERAL(u64qm13<>, u64qm13)
+FPM_Q_BIND_LITERAL(u64qm12<>, u64qm12)
+FPM_Q_BIND_LITERAL(u64qm11<>, u64qm11)
+FPM_Q_BIND_LITERAL(u64qm10<>, u64qm10)
+FPM_Q_BIND_LITERAL( u64qm9<>, u64qm9 )
+FPM_Q_BIND_LITERAL( u64qm8<>, u64qm8 )
+FPM_Q_BIND_LITERAL( u64qm7<>, u64qm7 )
+FPM_Q_BIND_LITERAL( u64qm6<>, u64qm6 )
+FPM_Q_BIND_LITERAL( u64qm5<>, u64qm5 )
+FPM_Q_BIND_LITERAL( u64qm4<>, u64qm4 )
+FPM_Q_BIND_LITERAL( u64qm3<>, u64qm3 )
+FPM_Q_BIND_LITERAL( u64qm2<>, u64qm2 )
+FPM_Q_BIND_LITERAL( u64qm1<>, u64qm1 )
+FPM_Q_BIND_LITERAL(  u64q0<>, u64q0  )
+FPM_Q_BIND_LITERAL(  u64q1<>, u64q1  )
+FPM_Q_BIND_LITERAL(  u64q2<>, u64q2  )
+FPM_Q_BIND_LITERAL(  u64q3<>, u64q3  )
+FPM_Q_BIND_LITERAL(  u64q4<>, u64q4  )
+FPM_Q_BIND_LITERAL(  u64q5<>, u64q5  )
+FPM_Q_BIND_LITERAL(  u64q6<>, u64q6  )
+FPM_Q_BIND_LITERAL(  u64q7<>, u64q7  )
+FPM_Q_BIND_LITERAL(  u64q8<>, u64q8  )
+FPM_Q_BIND_LITERAL(  u64q9<>, u64q9  )
+FPM_Q_BIND_LITERAL( u64q10<>, u64q10 )
+FPM_Q_BIND_LITERAL( u64q11<>, u64q11 )
+FPM_Q_BIND_LITERAL( u64q12<>, u64q12 )
+FPM_Q_BIND_LITERAL( u64q13<>, u64q13 )
+FPM_Q_BIND_LITERAL( u64q14<>, u64q14 )
+FPM_Q_BIND_LITERAL( u64q15<>, u64q15 )
+FPM_Q_BIND_LITERAL( u64q16<>, u64q16 )
+FPM_Q_BIND_LITERAL( u64q17<>, u64q17 )
+FPM_Q_BIND_LITERAL( u64q18<>, u64q18 )
+FPM_Q_BIND_LITERAL( u64q19<>, u64q19 )
+FPM_Q_BIND_LITERAL( u64q20<>, u64q20 )
+FPM_Q_BIND_LITERAL( u64q21<>, u64q21 )
+FPM_Q_BIND_LITERAL( u64q22<>, u64q22 )
+FPM_Q_BIND_LITERAL( u64q23<>, u64q23 )
+FPM_Q_BIND_LITERAL( u64q24<>, u64q24 )
+FPM_Q_BIND_LITERAL( u64q25<>, u64q25 )
+FPM_Q_BIND_LITERAL( u64q26<>, u64q26 )
+FPM_Q_BIND_LITERAL( u64q27<>, u64q27 )
+FPM_Q_BIND_LITERAL( u64q28<>, u64q28 )
+FPM_Q_BIND_LITERAL( u64q29<>, u64q29 )
+FPM_Q_BIND_LITERAL( u64q30<>, u64q30 )
+FPM_Q_BIND_LITERAL( u64q31<>, u64q31 )
+FPM_Q_BIND_LITERAL( u64q32<>, u64q32 )
+FPM_Q_BIND_LITERAL( u64q33<>, u64q33 )
+FPM_Q_BIND_LITERAL( u64q34<>, u64q34 )
+FPM_Q_BIND_LITERAL( u64q35<>, u64q35 )
+FPM_Q_BIND_LITERAL( u64q36<>, u64q36 )
+FPM_Q_BIND_LITERAL( u64q37<>, u64q37 )
+FPM_Q_BIND_LITERAL( u64q38<>, u64q38 )
+FPM_Q_BIND_LITERAL( u64q39<>, u64q39 )
+FPM_Q_BIND_LITERAL( u64q40<>, u64q40 )
+FPM_Q_BIND_LITERAL( u64q41<>, u64q41 )
+FPM_Q_BIND_LITERAL( u64q42<>, u64q42 )
+FPM_Q_BIND_LITERAL( u64q43<>, u64q43 )
+FPM_Q_BIND_LITERAL( u64q44<>, u64q44 )
+FPM_Q_BIND_LITERAL( u64q45<>, u64q45 )
+FPM_Q_BIND_LITERAL( u64q46<>, u64q46 )
+FPM_Q_BIND_LITERAL( u64q47<>, u64q47 )
+FPM_Q_BIND_LITERAL( u64q48<>, u64q48 )
+FPM_Q_BIND_LITERAL( u64q49<>, u64q49 )
+FPM_Q_BIND_LITERAL( u64q50<>, u64q50 )
+FPM_Q_BIND_LITERAL( u64q51<>, u64q51 )
+FPM_Q_BIND_LITERAL( u64q52<>, u64q52 )
+FPM_Q_BIND_LITERAL( u64q53<>, u64q53 )
+#endif
+
 /**\}*/
 }  // namespace fpm::q::types
 
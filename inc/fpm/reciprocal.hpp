@@ -0,0 +1,178 @@
+/** \file
+ * Declaration of the Reciprocal type, which replaces repeated divisions by the same runtime divisor
+ * with multiplications.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_RECIPROCAL_HPP_6C1F9E27_0B4D_4A3E_8D75_E2A94B3F1C08
+#define FPM_FPM_RECIPROCAL_HPP_6C1F9E27_0B4D_4A3E_8D75_E2A94B3F1C08
+
+#include "q.hpp"
+#include <span>
+
+
+namespace fpm::sq {
+/** \ingroup grp_fpmSq
+ * \{ */
+
+using fpm::detail::SqType;
+using fpm::detail::QType;
+
+
+/// Reciprocal of a runtime Sq divisor. The reciprocal is calculated once on construction (one wide
+/// division); each subsequent division by the divisor is performed with a multiplication and a
+/// shift only. The type of the quotient is the same as for the division operator of Sq.
+/// \note Accuracy: With D being the scaled divisor, the magnitude of the reciprocal is stored as
+/// R = ceil(2^K / |D|), where K is chosen such that R has the full width of the reciprocal type.
+/// The magnitude of the quotient is calculated as (|lhs| * R) * 2^-s, which is larger than the
+/// magnitude of the exact quotient (lhs / divisor) by less than 1 LSB, and is then rounded with the
+/// rounding mode of the quotient type (truncated for native and towardZero). Thus the result is
+/// either the same as the result of the division operator, or its magnitude is one resolution step
+/// (1 LSB) larger. The result is limited to the value range of the quotient type.
+template< SqType SqDivisor >
+requires fpm::detail::CanBeUsedAsDivisor<SqDivisor>
+class Reciprocal final {
+public:
+    using divisor_t = SqDivisor;  ///< Sq type of the divisor
+
+private:
+    /// Unsigned type of the magnitude of the reciprocal. Has at least 32 bits.
+    using r_t = fpm::detail::fit_type_t< std::max(sizeof(typename SqDivisor::base_t), sizeof(uint32_t)), false >;
+    /// Unsigned calculation type with twice the size of the reciprocal type.
+    using calc_t = fpm::detail::fit_type_t< 2u * sizeof(r_t), false >;
+
+    /// Number of bits of the reciprocal type.
+    static constexpr int R_BITS = sizeof(r_t) * CHAR_BIT;
+    /// Smallest magnitude of the scaled divisor. Since the divisor range does not include 0, this
+    /// is either the magnitude of the scaled minimum or of the scaled maximum.
+    static constexpr r_t DIVISOR_MIN = (SqDivisor::realMin > 0.)
+        ? static_cast<r_t>(SqDivisor::scaledMin)
+        : r_t(0) - static_cast<r_t>(SqDivisor::scaledMax);
+    /// Scaling of the reciprocal; the largest value for which the reciprocal fits into r_t.
+    static constexpr int K = R_BITS - 1 + (static_cast<int>( std::bit_width(DIVISOR_MIN) ) - 1);
+
+    /// Implements the division of an Sq value by the divisor via the reciprocal.
+    template< SqType SqLhs >
+    requires requires (SqLhs const &lhs, SqDivisor const &divisor) { lhs / divisor; }
+    struct DivR {
+        using result_t = decltype( std::declval<SqLhs const &>() / std::declval<SqDivisor const &>() );
+        using base_t = typename result_t::base_t;
+        static constexpr scaling_t f = result_t::f;
+        static constexpr double realMin = result_t::realMin;
+        static constexpr double realMax = result_t::realMax;
+        /// Magnitude of the largest scaled lhs value.
+        static constexpr calc_t LHS_MAX = static_cast<calc_t>( std::max(
+            fpm::detail::abs( static_cast<fpm::detail::widest_int_t>(SqLhs::scaledMin) ),
+            fpm::detail::abs( static_cast<fpm::detail::widest_int_t>(SqLhs::scaledMax) ) ) );
+        /// Shift to obtain the resolution of the quotient:
+        /// lhs / divisor * 2^(f - fLhs + fDivisor) = lhs * R * 2^-K * 2^(f - fLhs + fDivisor)
+        static constexpr int s = K - (f - SqLhs::f + SqDivisor::f);
+        /// The lhs value must fit into the reciprocal type, and the error must be smaller than 1.
+        static constexpr bool innerConstraints = ( sizeof(typename SqLhs::base_t) <= sizeof(r_t)
+                                                   && 0 <= s && s < 2*R_BITS && LHS_MAX <= (calc_t(1) << s) );
+
+        static constexpr base_t value(typename SqLhs::base_t lv, r_t magnitude, bool negative) noexcept {
+            bool const isLhsNegative = (lv < 0);
+            calc_t const lhsMagnitude = isLhsNegative ? calc_t(0) - static_cast<calc_t>(lv) : static_cast<calc_t>(lv);
+            bool const isResultNegative = (isLhsNegative != negative);
+
+            // limit the magnitude of the quotient to the range of the result
+            constexpr calc_t resultMin = calc_t(0) - static_cast<calc_t>(result_t::scaledMin);
+            constexpr calc_t resultMax = static_cast<calc_t>(result_t::scaledMax);
+            calc_t const quotient = std::min( roundedShift(lhsMagnitude * magnitude, isResultNegative),
+                                              isResultNegative ? resultMin : resultMax );
+            return isResultNegative ? static_cast<base_t>(calc_t(0) - quotient) : static_cast<base_t>(quotient);
+        }
+
+        /// Shifts the given magnitude of the product right by s and rounds it with the rounding
+        /// mode of the quotient type. Native and towardZero truncate the magnitude like the
+        /// division operator. Nearest rounds ties towards positive infinity, i.e. the magnitude of a
+        /// negative quotient is rounded down on a tie; convergent rounds ties to even.
+        static constexpr calc_t roundedShift(calc_t product, bool isResultNegative) noexcept {
+            constexpr Rounding rnd = result_t::rounding;
+            calc_t const quotient = product >> s;
+            if constexpr (rnd == Rounding::native || rnd == Rounding::towardZero || s == 0) { return quotient; }
+            else {
+                constexpr calc_t half = calc_t(1) << (s - 1);
+                calc_t const rest = product & ((calc_t(1) << s) - 1u);
+                bool const tieUp = (rnd == Rounding::nearest) ? !isResultNegative : (quotient & 1u) != 0u;
+                return quotient + static_cast<calc_t>( rest > half || (rest == half && tieUp) );
+            }
+        }
+    };
+
+public:
+    /// Calculates the reciprocal of the given divisor.
+    explicit constexpr
+    Reciprocal(SqDivisor const &divisor) noexcept
+        : magnitude( reciprocalOf(divisor.value) ), negative( divisor.value < 0 ) {}
+
+    /// Divides the lhs Sq value by the divisor of this reciprocal.
+    /// \returns the quotient, wrapped in the same Sq type as returned by lhs / divisor.
+    template< /* deduced: */ SqType SqLhs >
+    requires fpm::detail::ValidImplType< DivR<SqLhs> >
+    friend constexpr
+    auto operator /(SqLhs const &lhs, Reciprocal const &rhs) noexcept { return rhs.divideSq(lhs); }
+
+    /// Divides the lhs Q value by the divisor of this reciprocal.
+    /// \returns the quotient, wrapped in the same Sq type as returned by lhs / divisor.
+    template< /* deduced: */ QType QLhs >
+    requires requires (QLhs const &lhs, Reciprocal const &rhs) { lhs.toSq() / rhs; }
+    friend constexpr
+    auto operator /(QLhs const &lhs, Reciprocal const &rhs) noexcept { return lhs.toSq() / rhs; }
+
+    /// Divides the given values element-wise by the divisor of this reciprocal: out[i] = lhs[i] / divisor.
+    /// \returns the number of processed elements (size of the smaller range).
+    /// \note The quotient type must be implicitly convertible to the element type of the output.
+    template< /* deduced: */ fpm::detail::SqOrQType Lhs, QType QOut >
+    requires requires (Lhs const &lhs, Reciprocal const &rhs) {
+        { lhs / rhs } -> fpm::detail::ImplicitlyConvertible<QOut>;
+    }
+    constexpr
+    std::size_t divide(std::span<Lhs const> lhs, std::span<QOut> out) const noexcept {
+        std::size_t const n = std::min(lhs.size(), out.size());
+        FPM_SIMD_LOOP
+        for (std::size_t i = 0u; i < n; ++i) {
+            out[i] = lhs[i] / *this;
+        }
+        return n;
+    }
+
+private:
+    /// Divides the given Sq value by the divisor. Implemented as a member, because the friend
+    /// relation of Reciprocal to Sq does not extend to the friend functions of Reciprocal.
+    template< SqType SqLhs >
+    constexpr
+    auto divideSq(SqLhs const &lhs) const noexcept {
+        using result_t = typename DivR<SqLhs>::result_t;
+        return result_t( DivR<SqLhs>::value(lhs.value, magnitude, negative) );
+    }
+
+    /// \returns the magnitude of the reciprocal of the given scaled divisor, rounded up.
+    static constexpr
+    r_t reciprocalOf(typename SqDivisor::base_t divisor) noexcept {
+        calc_t const divisorMagnitude = (divisor < 0) ? calc_t(0) - static_cast<calc_t>(divisor) : static_cast<calc_t>(divisor);
+        return static_cast<r_t>( ((calc_t(1) << K) + divisorMagnitude - 1u) / divisorMagnitude );
+    }
+
+    r_t magnitude;  ///< magnitude of the reciprocal, scaled by 2^K
+    bool negative;  ///< whether the divisor is negative
+};
+
+/**\}*/
+}  // namespace fpm::sq
+
+
+#endif
+// EOF
@@ -0,0 +1,130 @@
+/** \file
+ * Batch kernels for element-wise arithmetics of (S)Q values over contiguous memory.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_SIMD_HPP_3B0E5C1A_7F2D_4C8E_9A61_52D4E0B7C9F3
+#define FPM_FPM_SIMD_HPP_3B0E5C1A_7F2D_4C8E_9A61_52D4E0B7C9F3
+
+#include "q.hpp"
+#include <algorithm>
+#include <functional>
+#include <span>
+
+
+/** Batch kernels for (S)Q types.
+ * The kernels apply the arithmetic operators of the Sq type element-wise to contiguous ranges of
+ * values. The result type of each element is deduced at compile-time exactly as for the scalar
+ * operator; it must be implicitly convertible to the element type of the output range, so the
+ * overflow-free guarantee of the scalar operators is retained for the whole range.
+ * \note The elements are processed in blocks of as many lanes as fit into a vector register of the
+ * target (SSE2/NEON: 16 bytes, AVX2: 32 bytes, AVX-512: 64 bytes), followed by a scalar loop for
+ * the remaining elements. There are no intrinsics; the blocks are lowered to vector instructions
+ * by the auto-vectorizer of the compiler when optimizing for speed (-O2 and above), which is
+ * checked by the FpmVectorizeCheck target. On targets without a known SIMD extension, or when
+ * optimizing for size (-Os, -Oz), the kernels fall back to the scalar loop.
+ * \note There is no vector instruction for integer division on common targets, hence div() mainly
+ * saves the loop overhead. */
+namespace fpm::simd {
+/** \ingroup grp_fpm
+ * \defgroup grp_fpmSimd SIMD Batch Kernels
+ * \{ */
+
+using fpm::detail::SqOrQType;
+using fpm::detail::QType;
+
+
+// Internal implementations.
+namespace detail {
+
+/** Concept: The result of the element-wise operation Op on Lhs and Rhs can be stored into QOut
+ * without an overflow check. */
+template< class Op, class Lhs, class Rhs, class QOut >
+concept StorableResult = (
+    SqOrQType<Lhs> && SqOrQType<Rhs> && QType<QOut>
+    && std::is_invocable_v<Op, Lhs const&, Rhs const&>
+    && fpm::detail::ImplicitlyConvertible< std::invoke_result_t<Op, Lhs const&, Rhs const&>, QOut >
+);
+
+/** Applies the given operation element-wise to the given ranges.
+ * \returns the number of processed elements, which is the size of the smallest range. */
+template< class Op, class Lhs, class Rhs, class QOut >
+requires StorableResult<Op, Lhs, Rhs, QOut>
+constexpr
+std::size_t apply(Op op, std::span<Lhs const> lhs, std::span<Rhs const> rhs, std::span<QOut> out) noexcept {
+    using result_t = std::invoke_result_t<Op, Lhs const&, Rhs const&>;
+    constexpr std::size_t lanes = fpm::detail::lanes_v< typename Lhs::base_t, typename Rhs::base_t, typename result_t::base_t >;
+
+    std::size_t const n = std::min({ lhs.size(), rhs.size(), out.size() });
+    std::size_t i = 0u;
+    if constexpr (lanes > 1u) {
+        for (; i + lanes <= n; i += lanes) {
+            FPM_SIMD_LOOP
+            for (std::size_t l = 0u; l < lanes; ++l) {
+                out[i + l] = op(lhs[i + l], rhs[i + l]);
+            }
+        }
+    }
+    // scalar fallback for the remaining elements
+    for (; i < n; ++i) {
+        out[i] = op(lhs[i], rhs[i]);
+    }
+    return n;
+}
+
+}  // namespace detail
+
+
+/** Element-wise addition: out[i] = lhs[i] + rhs[i].
+ * \returns the number of processed elements (size of the smallest range). */
+template< /* deduced: */ SqOrQType Lhs, SqOrQType Rhs, QType QOut >
+requires detail::StorableResult< std::plus<>, Lhs, Rhs, QOut >
+constexpr
+std::size_t add(std::span<Lhs const> lhs, std::span<Rhs const> rhs, std::span<QOut> out) noexcept {
+    return detail::apply(std::plus<>{}, lhs, rhs, out);
+}
+
+/** Element-wise subtraction: out[i] = lhs[i] - rhs[i].
+ * \returns the number of processed elements (size of the smallest range). */
+template< /* deduced: */ SqOrQType Lhs, SqOrQType Rhs, QType QOut >
+requires detail::StorableResult< std::minus<>, Lhs, Rhs, QOut >
+constexpr
+std::size_t sub(std::span<Lhs const> lhs, std::span<Rhs const> rhs, std::span<QOut> out) noexcept {
+    return detail::apply(std::minus<>{}, lhs, rhs, out);
+}
+
+/** Element-wise multiplication: out[i] = lhs[i] * rhs[i].
+ * \returns the number of processed elements (size of the smallest range). */
+template< /* deduced: */ SqOrQType Lhs, SqOrQType Rhs, QType QOut >
+requires detail::StorableResult< std::multiplies<>, Lhs, Rhs, QOut >
+constexpr
+std::size_t mul(std::span<Lhs const> lhs, std::span<Rhs const> rhs, std::span<QOut> out) noexcept {
+    return detail::apply(std::multiplies<>{}, lhs, rhs, out);
+}
+
+/** Element-wise division: out[i] = lhs[i] / rhs[i].
+ * \returns the number of processed elements (size of the smallest range). */
+template< /* deduced: */ SqOrQType Lhs, SqOrQType Rhs, QType QOut >
+requires detail::StorableResult< std::divides<>, Lhs, Rhs, QOut >
+constexpr
+std::size_t div(std::span<Lhs const> lhs, std::span<Rhs const> rhs, std::span<QOut> out) noexcept {
+    return detail::apply(std::divides<>{}, lhs, rhs, out);
+}
+
+/**\}*/
+}  // namespace fpm::simd
+
+
+#endif
+// EOF
@@ -18,12 +18,15 @@
 #define FPM_FPM_SQ_HPP_F6ED28B6_D4B0_4418_B39B_9658F2D6587E
 
 #include "fpm.hpp"
+#include "trig.hpp"
+#include "explog.hpp"
+#include "poly.hpp"
 #include <compare>
 
 
 // forward declare fpm::q::Q so that it can be friended by fpm::sq::Sq
 namespace fpm::q {
-template< std::integral BaseTQ, scaling_t fQ, double realMinQ, double realMaxQ, Overflow ovfQ >
+template< std::integral BaseTQ, scaling_t fQ, double realMinQ, double realMaxQ, Overflow ovfQ, Rounding rndQ >
 requires fpm::detail::QRequirements<BaseTQ, fQ, realMinQ, realMaxQ, ovfQ>
 class Q;
 }
@@ -36,6 +39,37 @@ namespace fpm::sq {
 
 using fpm::detail::SqType;
 
+// forward declare Reciprocal so that it can be friended by Sq
+template< SqType SqDivisor >
+requires fpm::detail::CanBeUsedAsDivisor<SqDivisor>
+class Reciprocal;
+
+// forward declare Accumulator so that it can be friended by Sq
+template< SqType SqElem, std::size_t N >
+requires ( N > 0u )
+class Accumulator;
+
+// forward declare Lut so that it can be friended by Sq
+template< SqType SqIn, SqType SqOut, std::size_t N, auto fn >
+requires fpm::detail::CanBeUsedInLut<SqIn, SqOut, N>
+class Lut;
+
+
+/// Breakpoint of a piecewise-linear function (see Pwl), given as real values.
+struct Knot {
+    double x;  ///< real input value
+    double y;  ///< real output value
+};
+
+// forward declare Pwl so that it can be friended by Sq
+template< SqType SqX, SqType SqY, Knot... knots >
+requires fpm::detail::CanBeUsedInPwl<SqX, SqY, sizeof...(knots)>
+class Pwl;
+
+// forward declare Expr so that it can be friended by Sq
+template< class Node >
+class Expr;
+
 
 /// Static (safe) Q-type variant. Implements mathematical operations and checks at compile-time whether
 /// these operations can be performed for the specified value range without running into overflow issues.
@@ -50,7 +84,8 @@ template<
     std::integral BaseT,  ///< type of the scaled integer stored in memory
     scaling_t f_,         ///< number of fraction bits (precision 2^(-f))
     double realMin_ = fpm::detail::realMin<BaseT, f_>(),   ///< minimum real value represented by the type
-    double realMax_ = fpm::detail::realMax<BaseT, f_>() >  ///< maximum real value represented by the type
+    double realMax_ = fpm::detail::realMax<BaseT, f_>(),   ///< maximum real value represented by the type
+    Rounding rnd_ = fpm::detail::DEFAULT_ROUNDING >        ///< rounding mode of down-scalings
 requires fpm::detail::SqRequirements<BaseT, f_, realMin_, realMax_>
 class Sq final {
 public:
@@ -59,13 +94,14 @@ public:
     static constexpr scaling_t f = f_;           ///< number of fraction bits
     static constexpr double realMin = realMin_;  ///< minimum real value
     static constexpr double realMax = realMax_;  ///< maximum real value
+    static constexpr Rounding rounding = rnd_;   ///< rounding mode of down-scalings
     static constexpr base_t scaledMin = fpm::scaled<f, base_t>(realMin_);  ///< minimum value of integer value range
     static constexpr base_t scaledMax = fpm::scaled<f, base_t>(realMax_);  ///< maximum value of integer value range
     static constexpr double resolution = fpm::detail::resolution<f>();     ///< real resolution
 
-    /// Create a new Sq type with the same base type and scaling but a different real value range.
+    /// Create a new Sq type with the same base type, scaling and rounding but a different real value range.
     template< double newRealMin, double newRealMax >
-    struct clamp { using type = Sq< base_t, f, newRealMin, newRealMax >; };
+    struct clamp { using type = Sq< base_t, f, newRealMin, newRealMax, rounding >; };
 
     /// Type alias for clamp::type.
     template< double newRealMin, double newRealMax >
@@ -96,13 +132,13 @@ public:
     /// will not change because the underlying integer value is just multiplied by some integral power
     /// of two factor. However, if the Sq value is down-scaled to a smaller resolution, the resulting
     /// representation error may become larger since the underlying integer is divided and the result
-    /// rounded towards zero to the next integer. The resulting representation error is at most the
+    /// rounded with the rounding mode of the target type. The resulting representation error is at most the
     /// sum of the two resolutions before and after a down-scaling operation.
     template< /* deduced: */ SqType SqFrom >
     requires fpm::detail::ImplicitlyConvertible<SqFrom, Sq>
     static constexpr
     Sq fromSq(SqFrom const &from) noexcept {
-        return Sq( s2s<SqFrom::f, f, base_t>(from.scaled()) );
+        return Sq( s2s<SqFrom::f, f, base_t, rounding>(from.scaled()) );
     }
 
     /// Copy-Constructor from another Sq type value with the same base type.
@@ -111,13 +147,13 @@ public:
     /// will not change because the underlying integer value is just multiplied by some integral power
     /// of two factor. However, if the Sq value is down-scaled to a smaller resolution, the resulting
     /// representation error may become larger since the underlying integer is divided and the result
-    /// rounded towards zero to the next integer. The resulting representation error is at most the
+    /// rounded with the rounding mode of the target type. The resulting representation error is at most the
     /// sum of the two resolutions before and after a down-scaling operation.
     template< /* deduced: */ SqType SqFrom >
     requires ( !std::is_same_v< Sq, SqFrom >  // when the same, default copy constructor should be used
                && fpm::detail::ImplicitlyConvertible<SqFrom, Sq> )
     constexpr
-    Sq(SqFrom const &from) noexcept : value( s2s<SqFrom::f, f, base_t>(from.scaled()) ) {}
+    Sq(SqFrom const &from) noexcept : value( s2s<SqFrom::f, f, base_t, rounding>(from.scaled()) ) {}
 
     /// Copy-Constructor from the same type.
     constexpr
@@ -154,8 +190,9 @@ private:
     // so that hover help texts and API descriptions are not too confusing.
 
     // Helper macro to extract the Sq type template arguments from the given implementation type.
+    // The result inherits the rounding mode of this (the lhs) type.
     // Note: Use of variadic macro so that template types with comma separators also work.
-#   define UNPACK(...)  typename __VA_ARGS__::base_t, __VA_ARGS__::f, __VA_ARGS__::realMin, __VA_ARGS__::realMax
+#   define UNPACK(...)  typename __VA_ARGS__::base_t, __VA_ARGS__::f, __VA_ARGS__::realMin, __VA_ARGS__::realMax, Sq::rounding
 
     /// Implements the cast of Sq to type SqC.
     template< SqType SqC >
@@ -167,7 +204,7 @@ private:
         static constexpr double realMax = SqC::realMax;
         static constexpr bool innerConstraints = true;
         static constexpr base_t value(typename Sq::base_t from) noexcept {
-            return s2s<Sq::f, f, base_t>(from);
+            return s2s<Sq::f, f, base_t, SqC::rounding>(from);
         }
     };
 
@@ -192,7 +229,7 @@ private:
         using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, typename SqRhs::base_t, f, realMin, realMax>;
         static constexpr bool innerConstraints = true;
         static constexpr base_t value(typename Sq::base_t lv, typename SqRhs::base_t rv) noexcept {
-            return static_cast<base_t>( s2s<Sq::f, f, base_t>(lv) + s2s<SqRhs::f, f, base_t>(rv) );  // add values
+            return static_cast<base_t>( s2s<Sq::f, f, base_t, rounding>(lv) + s2s<SqRhs::f, f, base_t, rounding>(rv) );  // add values
         }
     };
 
@@ -205,18 +242,23 @@ private:
         using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, typename SqRhs::base_t, f, realMin, realMax>;
         static constexpr bool innerConstraints = true;
         static constexpr base_t value(typename Sq::base_t lv, typename SqRhs::base_t rv) noexcept {
-            return static_cast<base_t>( s2s<Sq::f, f, base_t>(lv) - s2s<SqRhs::f, f, base_t>(rv) );  // subtract rv from lv
+            return static_cast<base_t>( s2s<Sq::f, f, base_t, rounding>(lv) - s2s<SqRhs::f, f, base_t, rounding>(rv) );  // subtract rv from lv
         }
     };
 
     /// Implements the multiplication operator.
+    /// \note The limits are rounded outward to the resolution if the product can be rounded beyond
+    /// them (see fpm::detail::roundsBeyondLimits()); this applies to all results below which are
+    /// rounded with the rounding mode of the lhs type.
     template< SqType SqRhs >
     struct Mult {
         static constexpr scaling_t f = std::max(Sq::f, SqRhs::f);
-        static constexpr double realMin = std::min(std::min(Sq::realMin * SqRhs::realMax, SqRhs::realMin * Sq::realMax),
-                                                   std::min(Sq::realMin * SqRhs::realMin, Sq::realMax * SqRhs::realMax));
-        static constexpr double realMax = std::max(std::max(Sq::realMax * SqRhs::realMin, SqRhs::realMax * Sq::realMin),
-                                                   std::max(Sq::realMin * SqRhs::realMin, Sq::realMax * SqRhs::realMax));
+        static constexpr double realMin = fpm::detail::roundedMin(
+            std::min(std::min(Sq::realMin * SqRhs::realMax, SqRhs::realMin * Sq::realMax),
+                     std::min(Sq::realMin * SqRhs::realMin, Sq::realMax * SqRhs::realMax)), f, rounding );
+        static constexpr double realMax = fpm::detail::roundedMax(
+            std::max(std::max(Sq::realMax * SqRhs::realMin, SqRhs::realMax * Sq::realMin),
+                     std::max(Sq::realMin * SqRhs::realMin, Sq::realMax * SqRhs::realMax)), f, rounding );
         using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, typename SqRhs::base_t, f, realMin, realMax>;
         using common_t = fpm::detail::common_base_t<typename Sq::base_t, typename SqRhs::base_t>;
         using calc_t = fpm::detail::fit_type_t<sizeof(common_t) * 2u, std::is_signed_v<common_t>>;
@@ -224,7 +266,35 @@ private:
         static constexpr base_t value(typename Sq::base_t lv, typename SqRhs::base_t rv) noexcept {
             // multiply lhs with rhs in calculation type and correct scaling to obtain result
             // a*b <=> (a * 2^f) * (b * 2^f) / 2^f = a*b * 2^f
-            return s2s<2*f, f, base_t>( s2s<Sq::f, f, calc_t>(lv) * s2s<SqRhs::f, f, calc_t>(rv) );
+            return s2s<2*f, f, base_t, rounding>( s2s<Sq::f, f, calc_t, rounding>(lv) * s2s<SqRhs::f, f, calc_t, rounding>(rv) );
+        }
+    };
+
+    /// Implements the fused multiply-add of Sq, SqB and SqC: Sq * SqB + SqC.
+    /// The product is kept at double scaling in the calculation type, SqC is added at the same
+    /// scaling, and the sum is rescaled only once.
+    template< SqType SqB, SqType SqC >
+    struct Fma {
+        using mult_t = Mult<SqB>;
+        static constexpr scaling_t f = std::max(mult_t::f, SqC::f);
+        static constexpr double realMin = fpm::detail::roundedMin(mult_t::realMin + SqC::realMin, f, rounding);
+        static constexpr double realMax = fpm::detail::roundedMax(mult_t::realMax + SqC::realMax, f, rounding);
+        using common_ab_t = fpm::detail::common_base_t<typename Sq::base_t, typename SqB::base_t>;
+        using base_t = fpm::detail::common_q_base_t<common_ab_t, typename SqC::base_t, f, realMin, realMax>;
+        using common_t = fpm::detail::common_base_t<common_ab_t, typename SqC::base_t>;
+        using calc_t = fpm::detail::fit_type_t<sizeof(common_t) * 2u, std::is_signed_v<common_t>>;
+        static constexpr bool innerConstraints = (
+            sizeof(common_t) <= fpm::detail::MAX_BASETYPE_SIZE
+            && fpm::detail::RealLimitsInRangeOfCalcType<calc_t, 2*f, mult_t::realMin, mult_t::realMax>
+            && fpm::detail::RealLimitsInRangeOfCalcType<calc_t, 2*f, SqC::realMin, SqC::realMax>
+            && fpm::detail::RealLimitsInRangeOfCalcType<calc_t, 2*f, realMin, realMax> );
+        /// \returns the unrounded sum a*b + c at scaling 2f in the calculation type.
+        static constexpr calc_t wide(typename Sq::base_t av, typename SqB::base_t bv, typename SqC::base_t cv) noexcept {
+            // a*b + c <=> (a * 2^f) * (b * 2^f) + (c * 2^(2f)) = (a*b + c) * 2^(2f)
+            return s2s<Sq::f, f, calc_t, rounding>(av) * s2s<SqB::f, f, calc_t, rounding>(bv) + s2s<SqC::f, 2*f, calc_t, rounding>(cv);
+        }
+        static constexpr base_t value(typename Sq::base_t av, typename SqB::base_t bv, typename SqC::base_t cv) noexcept {
+            return s2s<2*f, f, base_t, rounding>( wide(av, bv, cv) );  // rescale once
         }
     };
 
@@ -259,10 +329,12 @@ private:
     requires fpm::detail::CanBeUsedAsDivisor<SqRhs>
     struct Div {
         static constexpr scaling_t f = std::max(Sq::f, SqRhs::f);
-        static constexpr double realMin = std::min(std::min(Sq::realMin / SqRhs::realMax, Sq::realMin / SqRhs::realMin),
-                                                   std::min(Sq::realMax / SqRhs::realMin, Sq::realMax / SqRhs::realMax));
-        static constexpr double realMax = std::max(std::max(Sq::realMin / SqRhs::realMax, Sq::realMin / SqRhs::realMin),
-                                                   std::max(Sq::realMax / SqRhs::realMin, Sq::realMax / SqRhs::realMax));
+        static constexpr double realMin = fpm::detail::roundedMin(
+            std::min(std::min(Sq::realMin / SqRhs::realMax, Sq::realMin / SqRhs::realMin),
+                     std::min(Sq::realMax / SqRhs::realMin, Sq::realMax / SqRhs::realMax)), f, rounding );
+        static constexpr double realMax = fpm::detail::roundedMax(
+            std::max(std::max(Sq::realMin / SqRhs::realMax, Sq::realMin / SqRhs::realMin),
+                     std::max(Sq::realMax / SqRhs::realMin, Sq::realMax / SqRhs::realMax)), f, rounding );
         using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, typename SqRhs::base_t, f, realMin, realMax>;
         using calc_t = fpm::detail::fit_type_t<
             sizeof(typename Sq::base_t) + fpm::detail::div_ceil(2*f - Sq::f, CHAR_BIT),
@@ -271,7 +343,7 @@ private:
         static constexpr base_t value(typename Sq::base_t lv, typename SqRhs::base_t rv) noexcept {
             // divide lhs by rhs in calculation type and correct scaling to obtain result
             // a/b <=> (a * 2^(2f)) / (b * 2^f) = a/b * 2^f
-            return static_cast<base_t>( s2s<Sq::f, 2*f, calc_t>(lv) / s2s<SqRhs::f, f, calc_t>(rv) );
+            return static_cast<base_t>( fpm::detail::divr<rounding>( s2s<Sq::f, 2*f, calc_t>(lv), s2s<SqRhs::f, f, calc_t, rounding>(rv) ) );
         };
     };
 
@@ -280,12 +352,13 @@ private:
     requires ( ic != 0 )
     struct DivIcR {
         static constexpr scaling_t f = Sq::f;
-        static constexpr double realMin = std::min(Sq::realMin / ic, Sq::realMax / ic);
-        static constexpr double realMax = std::max(Sq::realMin / ic, Sq::realMax / ic);
+        static constexpr double realMin = fpm::detail::roundedMin(std::min(Sq::realMin / ic, Sq::realMax / ic), f, rounding);
+        static constexpr double realMax = fpm::detail::roundedMax(std::max(Sq::realMin / ic, Sq::realMax / ic), f, rounding);
         using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, T, f, realMin, realMax>;
         static constexpr bool innerConstraints = true;
         static constexpr base_t value(typename Sq::base_t lv, std::integral_constant<T, ic>) noexcept {
-            return static_cast<base_t>(lv) / static_cast<base_t>(ic);  // divide lhs value by the integral constant
+            // divide lhs value by the integral constant; multiply-shift instead of a runtime division
+            return fpm::detail::divicr< rounding, base_t, static_cast<base_t>(ic) >( static_cast<base_t>(lv) );
         }
     };
 
@@ -294,15 +367,16 @@ private:
     requires fpm::detail::CanBeUsedAsDivisor<Sq>
     struct DivIcL {
         static constexpr scaling_t f = Sq::f;
-        static constexpr double realMin = std::min(ic / Sq::realMin, ic / Sq::realMax);
-        static constexpr double realMax = std::max(ic / Sq::realMin, ic / Sq::realMax);
+        static constexpr double realMin = fpm::detail::roundedMin(std::min(ic / Sq::realMin, ic / Sq::realMax), f, rounding);
+        static constexpr double realMax = fpm::detail::roundedMax(std::max(ic / Sq::realMin, ic / Sq::realMax), f, rounding);
         using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, T, f, realMin, realMax>;
         using common_t = fpm::detail::common_base_t<typename Sq::base_t, T>;
         using calc_t = fpm::detail::fit_type_t< sizeof(T) + fpm::detail::div_ceil(2*f, CHAR_BIT), std::is_signed_v<common_t> >;
-        static constexpr bool innerConstraints = ( v2s<2*f, calc_t>(ic) <= std::numeric_limits<calc_t>::max() );
+        static constexpr bool innerConstraints = ( sizeof(T) + fpm::detail::div_ceil(2*f, CHAR_BIT) <= sizeof(calc_t)
+                                                   && v2s<2*f, calc_t>(ic) <= std::numeric_limits<calc_t>::max() );
         static constexpr base_t value(std::integral_constant<T, ic>, typename Sq::base_t rv) noexcept {
             // ic * 2^(2f) / (v*2^f) = ic/v * 2^f
-            return static_cast<base_t>( s2s<0, 2*f, calc_t>(ic) / static_cast<calc_t>(rv) );
+            return static_cast<base_t>( fpm::detail::divr<rounding>( s2s<0, 2*f, calc_t>(ic), static_cast<calc_t>(rv) ) );
         }
     };
 
@@ -323,7 +397,7 @@ private:
         static constexpr base_t value(typename Sq::base_t lv, typename SqRhs::base_t rv) noexcept {
             // divide lhs by rhs in calculation type and correct scaling to obtain result
             // a%b <=> (a * 2^f) % (b * 2^f) = a%b * 2^f
-            return static_cast<base_t>( s2s<Sq::f, f, calc_t>(lv) % s2s<SqRhs::f, f, calc_t>(rv) );
+            return static_cast<base_t>( s2s<Sq::f, f, calc_t, rounding>(lv) % s2s<SqRhs::f, f, calc_t, rounding>(rv) );
         }
     };
 
@@ -412,14 +486,13 @@ private:
         static constexpr double realMin = (std::is_signed_v<base_t> && Sq::scaledMin < 0 && Sq::scaledMax > 0)
             ? 0.0  // use 0 as new minimum if signed input type has a range of negative and positive values
             : std::min(Sq::realMin*Sq::realMin, Sq::realMax*Sq::realMax);
-        static constexpr double realMax = std::max(Sq::realMin*Sq::realMin, Sq::realMax*Sq::realMax);
+        static constexpr double realMax = fpm::detail::roundedMax(std::max(Sq::realMin*Sq::realMin, Sq::realMax*Sq::realMax), f, rounding);
         using calc_t = fpm::detail::fit_type_t< sizeof(typename Sq::base_t) * 2u, std::is_signed_v<base_t> >;
         static constexpr bool innerConstraints = true;
         static constexpr base_t value(typename Sq::base_t v) noexcept {
             // x^2 <=> [ (x*2^f)*(x*2^f) / 2^f ] = x*x*2^f
             auto const vIntm = static_cast<calc_t>(v);
-            constexpr auto fPower = v2s<f, calc_t>(1);
-            return static_cast<base_t>( vIntm*vIntm / fPower );
+            return static_cast<base_t>( s2s<2*f, f, calc_t, rounding>(vIntm*vIntm) );
         }
     };
 
@@ -474,16 +547,109 @@ private:
         static constexpr double l2 = Sq::realMin*Sq::realMin*Sq::realMax;
         static constexpr double l3 = Sq::realMin*Sq::realMax*Sq::realMax;
         static constexpr double l4 = Sq::realMax*Sq::realMax*Sq::realMax;
-        static constexpr double realMin = std::min(std::min(std::min(l1, l2), l3), l4);
-        static constexpr double realMax = std::max(std::max(std::max(l1, l2), l3), l4);
+        static constexpr double realMin = fpm::detail::roundedMin(std::min(std::min(std::min(l1, l2), l3), l4), f, rounding);
+        static constexpr double realMax = fpm::detail::roundedMax(std::max(std::max(std::max(l1, l2), l3), l4), f, rounding);
         using calc_t = fpm::detail::fit_type_t< sizeof(typename Sq::base_t) * 2u, std::is_signed_v<base_t> >;
         static constexpr bool innerConstraints = true;
+        /// Scaled limits of the result; the rounding error of the square is multiplied by x, so the
+        /// cube is clamped to them like the result of Pow.
+        static constexpr calc_t cubeMin = fpm::scaled<f, calc_t>(realMin);
+        static constexpr calc_t cubeMax = fpm::scaled<f, calc_t>(realMax);
         static constexpr base_t value(typename Sq::base_t v) noexcept {
             // x^3 <=> [ (x*2^f)*(x*2^f) / 2^f * (x*2^f) / 2^f ] = [ sqr(x)*(x*2^f) / 2^f ] = x*x*x*2^f
             auto xIntm = static_cast<calc_t>(v);
             auto xSqr = static_cast<calc_t>( Square::value(v) );
-            constexpr auto fPower = v2s<f, calc_t>(1);
-            return static_cast<base_t>( xSqr*xIntm / fPower );
+            return static_cast<base_t>( std::clamp(s2s<2*f, f, calc_t, rounding>(xSqr*xIntm), cubeMin, cubeMax) );
+        }
+    };
+
+    /// Implements the integer power function with exponentiation by squaring.
+    template< std::integral T, T n >
+    requires ( n >= 1 )
+    struct Pow {
+        static constexpr int N = static_cast<int>(n);
+        static constexpr scaling_t f = Sq::f;
+        static constexpr double lN = fpm::detail::dpowi(Sq::realMin, N);
+        static constexpr double hN = fpm::detail::dpowi(Sq::realMax, N);
+        static constexpr double realMin = (N % 2 == 0 && Sq::scaledMin < 0 && Sq::scaledMax > 0)
+            ? 0.0  // use 0 as new minimum for even powers of a range of negative and positive values
+            : std::min(lN, hN);
+        static constexpr double realMax = std::max(lN, hN);
+        using base_t = fpm::detail::common_q_base_t<fpm::detail::common_base_t<int32_t, typename Sq::base_t>,
+                                                    fpm::detail::common_base_t<int32_t, typename Sq::base_t>, f, realMin, realMax>;
+        /// Largest magnitude of the scaled intermediate values; the intermediate powers do not exceed
+        /// the result if the magnitude of x is at least 1, and they do not exceed 1 otherwise.
+        static constexpr double intmMax = std::max( 1., std::max(fpm::detail::abs(lN), fpm::detail::abs(hN)) ) * v2s<f, double>(1);
+        static constexpr bool isSigned = std::is_signed_v<typename Sq::base_t>;
+        /// Single wide intermediate type; holds the product of two intermediate values.
+        using calc_t = std::conditional_t< (intmMax * intmMax < 0x1p62),
+            fpm::detail::fit_type_t<sizeof(int64_t), isSigned>,
+            std::conditional_t<isSigned, fpm::detail::widest_int_t, fpm::detail::widest_uint_t> >;
+        static constexpr double calcMax = (sizeof(calc_t) > sizeof(int64_t)) ? 0x1p126 : 0x1p62;
+        static constexpr bool innerConstraints = ( intmMax * intmMax < calcMax );
+        /// Scaled limits of the result; the rounding errors of the products accumulate, so the
+        /// power is clamped to them.
+        static constexpr calc_t powerMin = fpm::scaled<f, calc_t>(realMin);
+        static constexpr calc_t powerMax = fpm::scaled<f, calc_t>(realMax);
+        static constexpr base_t value(typename Sq::base_t v) noexcept {
+            // x^n <=> [ (x*2^f)^n / 2^(f*(n-1)) ] = x^n * 2^f; each product is rescaled by 2^f
+            auto square = static_cast<calc_t>(v);
+            auto power = square;
+            bool first = true;
+            for (int e = N; e > 0; e >>= 1) {
+                if (e & 1) {
+                    power = first ? square : s2s<2*f, f, calc_t, Sq::rounding>(power*square);
+                    first = false;
+                }
+                if (e > 1) { square = s2s<2*f, f, calc_t, Sq::rounding>(square*square); }
+            }
+            return static_cast<base_t>( std::clamp(power, powerMin, powerMax) );
+        }
+    };
+
+    /// Implements the polynomial evaluation with Horner's scheme.
+    template< double... coeffs >
+    requires ( sizeof...(coeffs) >= 1u )
+    struct Poly {
+        static constexpr std::size_t N = sizeof...(coeffs);
+        static constexpr int n = static_cast<int>(N) - 1;  ///< degree
+        static constexpr fpm::detail::poly_coeffs_t<N> c{ coeffs... };
+        static constexpr scaling_t f = Sq::f;
+        static constexpr auto range = fpm::detail::polyRange(c, Sq::realMin, Sq::realMax);
+        static constexpr double realMin = range.first;
+        static constexpr double realMax = range.second;
+        static constexpr bool isSigned = std::is_signed_v<typename Sq::base_t> || realMin < 0.;
+        using base_t = fpm::detail::common_q_base_t<fpm::detail::fit_type_t<sizeof(typename Sq::base_t), isSigned>,
+                                                    fpm::detail::fit_type_t<sizeof(typename Sq::base_t), isSigned>, f, realMin, realMax>;
+        /// Scaling of the coefficients; use 64 bits if sufficient, the widest integer otherwise.
+        static constexpr int fcNeeded = fpm::detail::polyCoeffScalingNeeded<N>(Sq::realMin, Sq::realMax, f);
+        static constexpr bool fitsInt64 = ( fpm::detail::polyCoeffScaling(c, Sq::realMin, Sq::realMax, f, 64) >= fcNeeded );
+        using calc_t = std::conditional_t<fitsInt64, int64_t, fpm::detail::widest_int_t>;
+        static constexpr int fc = fpm::detail::polyCoeffScaling(c, Sq::realMin, Sq::realMax, f, sizeof(calc_t) * CHAR_BIT);
+        static constexpr bool innerConstraints = ( fc >= fcNeeded );
+        /// Coefficient k, scaled by 2^(fc + (n-k)*f) and rounded to nearest.
+        static constexpr std::array<calc_t, N> scaledCoeffs = []() consteval {
+            std::array<calc_t, N> scaled{};
+            for (int k = 0; k <= n; ++k) {
+                double value = c[k];
+                for (int e = 0; e < fc + (n - k) * f; ++e) { value *= 2.; }
+                for (int e = 0; e > fc + (n - k) * f; --e) { value /= 2.; }
+                scaled[k] = static_cast<calc_t>( value + (value < 0. ? -0.5 : 0.5) );
+            }
+            return scaled;
+        }();
+        static constexpr base_t value(typename Sq::base_t v) noexcept {
+            // p(x) <=> [ ((cn*2^fc * (x*2^f) + cn-1*2^(fc+f)) * (x*2^f) + ... + c0*2^(fc+n*f)) / 2^(fc+(n-1)*f) ]
+            //        = p(x)*2^f; the intermediate values are not rescaled
+            auto const x = static_cast<calc_t>(v);
+            calc_t acc = scaledCoeffs[n];
+            for (int k = n - 1; k >= 0; --k) { acc = acc * x + scaledCoeffs[k]; }
+            constexpr int shift = fc + (n - 1) * f;
+            acc = s2s<shift, 0, calc_t, rounding>(acc);
+            // the value is off by less than one resolution step; limit it to the exact range
+            constexpr auto resultMin = static_cast<calc_t>( fpm::scaled<f, base_t>(realMin) );
+            constexpr auto resultMax = static_cast<calc_t>( fpm::scaled<f, base_t>(realMax) );
+            return static_cast<base_t>( std::clamp(acc, resultMin, resultMax) );
         }
     };
 
@@ -508,6 +674,179 @@ private:
         }
     };
 
+    /// Implements the reciprocal cube root function.
+    template< typename _ >  // unused template parameter to enable requires-clause
+    requires fpm::detail::CanBePassedToRCbrt<Sq>
+    struct RCbrt {
+        using base_t = typename Sq::base_t;
+        static constexpr scaling_t f = Sq::f;
+        static constexpr double thMax = fpm::detail::realMax<base_t, f>();
+        static constexpr double realMin = fpm::detail::floor( fpm::detail::rcbrt(Sq::realMax) );
+        static constexpr double realMax = std::min( thMax, fpm::detail::ceil( fpm::detail::rcbrt(Sq::realMin) ) );
+        using calc_t = fpm::detail::fit_type_t< sizeof(base_t) + fpm::detail::div_ceil(2*f, CHAR_BIT), std::is_signed_v<base_t> >;
+        static constexpr bool innerConstraints = true;
+        static constexpr base_t value(typename Sq::base_t v) noexcept {
+            // the root of the limits is approximated, and the root of the value is rounded down;
+            // limit the result to the maximum of the range
+            constexpr base_t resultMax = fpm::scaled<f, base_t>(realMax);
+            // 1/cbrt(x) <=> [ 2^(2f) / ((x*2^f) * 2^f * 2^f)^1/3 ] = 2^f / cbrt(x)
+            auto const root = static_cast<calc_t>( Cbrt<base_t>::value(v) );
+            return static_cast<base_t>( std::min( static_cast<calc_t>(s2s<0, 2*f, calc_t>(1) / root), static_cast<calc_t>(resultMax) ) );
+        }
+    };
+
+    /// Implements the 2-based and the natural logarithm functions.
+    template< bool natural >
+    requires fpm::detail::CanBePassedToLog<Sq>
+    struct Log {
+        static constexpr scaling_t f = Sq::f;
+        static constexpr double realMin = fpm::detail::floor( natural ? fpm::detail::log(Sq::realMin) : fpm::detail::log2(Sq::realMin) );
+        static constexpr double realMax = fpm::detail::ceil( natural ? fpm::detail::log(Sq::realMax) : fpm::detail::log2(Sq::realMax) );
+        using base_t = fpm::detail::common_q_base_t<fpm::detail::fit_type_t<sizeof(typename Sq::base_t), true>, typename Sq::base_t, f, realMin, realMax>;
+        static constexpr bool innerConstraints = true;
+        static constexpr base_t value(typename Sq::base_t v) noexcept {
+            // log2(x) <=> [ log2(x*2^f) - f ] = log2(x); v > 0 in the range; |log2| < 64 at 2^30
+            int64_t l = fpm::detail::ilog2( static_cast<uint64_t>(v) ) - (int64_t(f) << fpm::detail::EXPLOG_F);
+            if constexpr (natural) {
+                // ln(x) = log2(x) * ln(2); ln(2) at 2^26 keeps the product below 2^63
+                constexpr int64_t ln2 = fpm::scaled<26, int64_t>(fpm::detail::LN2);
+                l = (l * ln2 + (int64_t(1) << 25)) >> 26;
+            }
+            // the limits are approximated; limit the result to the range
+            constexpr auto resultMin = static_cast<int64_t>( fpm::scaled<f, base_t>(realMin) );
+            constexpr auto resultMax = static_cast<int64_t>( fpm::scaled<f, base_t>(realMax) );
+            return static_cast<base_t>( std::clamp(fpm::detail::fromExpLogScaling<f>(l), resultMin, resultMax) );
+        }
+    };
+
+    /// Implements the 2-based and the natural exponential functions.
+    template< bool natural >
+    requires fpm::detail::CanBePassedToExp<Sq>
+    struct Exp {
+        static constexpr scaling_t f = Sq::f;
+        static constexpr double realMin = fpm::detail::floor( natural ? fpm::detail::exp(Sq::realMin) : fpm::detail::exp2(Sq::realMin) );
+        static constexpr double realMax = fpm::detail::ceil( natural ? fpm::detail::exp(Sq::realMax) : fpm::detail::exp2(Sq::realMax) );
+        using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, typename Sq::base_t, f, realMin, realMax>;
+        /// The scaled result must fit into the 63 bits of the kernel.
+        static constexpr bool innerConstraints = ( realMax * v2s<f, double>(1) < 0x1p62 );
+        static constexpr base_t value(typename Sq::base_t v) noexcept {
+            // 2^x <=> [ 2^((x*2^f) / 2^f) * 2^f ] = 2^x * 2^f
+            int64_t e = static_cast<int64_t>(v) << (fpm::detail::EXPLOG_F - f);
+            if constexpr (natural) {
+                // e^x = 2^(x * log2(e)); |x*2^f| < 2^31, thus the product is below 2^62
+                constexpr int64_t log2e = fpm::scaled<fpm::detail::EXPLOG_F, int64_t>(fpm::detail::LOG2E);
+                e = (static_cast<int64_t>(v) * log2e) >> f;
+            }
+            // the limits are approximated; limit the result to the range
+            constexpr auto resultMin = static_cast<uint64_t>( fpm::scaled<f, base_t>(realMin) );
+            constexpr auto resultMax = static_cast<uint64_t>( fpm::scaled<f, base_t>(realMax) );
+            return static_cast<base_t>( std::clamp(fpm::detail::iexp2<f>(e), resultMin, resultMax) );
+        }
+    };
+
+    /// Implements the sine and cosine functions.
+    template< TrigEngine engine, AngleUnit unit >
+    requires fpm::detail::CanBePassedToTrig<Sq>
+    struct SinCos {
+        using base_t = fpm::detail::fit_type_t< sizeof(typename Sq::base_t), true >;
+        static constexpr scaling_t f = Sq::f;
+        static constexpr double realMin = -1.;
+        static constexpr double realMax = 1.;
+        static constexpr bool innerConstraints = true;
+        static constexpr std::pair<base_t, base_t> value(typename Sq::base_t v) noexcept {
+            auto const [sinValue, cosValue] = fpm::detail::sincos<engine>( fpm::detail::phaseOf<unit, Sq::f>(v) );
+            return { fpm::detail::fromTrigScaling<f, base_t>(sinValue), fpm::detail::fromTrigScaling<f, base_t>(cosValue) };
+        }
+    };
+
+    /// Implements the tangent function.
+    template< TrigEngine engine, AngleUnit unit >
+    requires fpm::detail::CanBePassedToTan<Sq, unit>
+    struct Tan {
+        using base_t = fpm::detail::fit_type_t< sizeof(typename Sq::base_t), true >;
+        static constexpr scaling_t f = Sq::f;
+        static constexpr double toRad = (unit == AngleUnit::turn) ? 2.*fpm::detail::PI : 1.;
+        static constexpr double realMin = fpm::detail::tan(Sq::realMin * toRad);
+        static constexpr double realMax = fpm::detail::tan(Sq::realMax * toRad);
+        static constexpr bool innerConstraints = true;
+        static constexpr base_t value(typename Sq::base_t v) noexcept {
+            // tan(x) <=> [ (sin(x)*2^30 * 2^f) / (cos(x)*2^30) ] = tan(x)*2^f; cos(x) > 0 in the range
+            auto const [sinValue, cosValue] = fpm::detail::sincos<engine>( fpm::detail::phaseOf<unit, Sq::f>(v) );
+            int64_t const quotient = (static_cast<int64_t>(sinValue) << f) / std::max(cosValue, int32_t(1));
+            // the limits are approximated; limit the result to the range
+            constexpr auto resultMin = static_cast<int64_t>( fpm::scaled<f, base_t>(realMin) );
+            constexpr auto resultMax = static_cast<int64_t>( fpm::scaled<f, base_t>(realMax) );
+            return static_cast<base_t>( std::clamp(quotient, resultMin, resultMax) );
+        }
+    };
+
+    /// Implements the atan2 function; Sq is the y component of the vector, SqX the x component.
+    template< SqType SqX, AngleUnit unit >
+    requires fpm::detail::CanBePassedToAtan2<Sq, SqX>
+    struct Atan2 {
+        static constexpr double PI = fpm::detail::PI;
+        static constexpr double toUnit = (unit == AngleUnit::turn) ? 1. / (2.*PI) : 1.;
+        static constexpr scaling_t f = std::max(Sq::f, SqX::f);
+        // atan2 is in (-pi, pi]; narrow the range to the half-planes and quadrants of the inputs
+        static constexpr double realMin = toUnit * (
+            (Sq::realMin >= 0.) ? ((SqX::realMax < 0.) ? PI/2. : 0.)
+            : (SqX::realMin >= 0.) ? -PI/2. : -PI );
+        static constexpr double realMax = toUnit * (
+            (Sq::realMax < 0.) ? ((SqX::realMax <= 0.) ? -PI/2. : 0.)
+            : (Sq::realMax == 0.) ? ((SqX::realMin >= 0.) ? 0. : PI)
+            : (SqX::realMin >= 0.) ? PI/2. : PI );
+        using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, typename SqX::base_t, f, realMin, realMax>;
+        /// Largest magnitude of the components at the common scaling.
+        static constexpr int64_t componentMax = static_cast<int64_t>( std::max(
+            std::max( fpm::detail::abs(Sq::realMin), fpm::detail::abs(Sq::realMax) ),
+            std::max( fpm::detail::abs(SqX::realMin), fpm::detail::abs(SqX::realMax) ) ) * v2s<f, double>(1) );
+        /// Shift that normalizes the components to at most 2^32.
+        static constexpr int shift = 32 - static_cast<int>( std::bit_width( static_cast<uint64_t>(componentMax) ) );
+        static constexpr bool innerConstraints = ( -fpm::detail::TRIG_F < shift );
+        /// \returns { magnitude, phase } of the vector, see fpm::detail::polarCordic.
+        static constexpr std::pair<int64_t, int64_t> polar(typename Sq::base_t yv, typename SqX::base_t xv) noexcept {
+            return fpm::detail::polarCordic<shift>( s2s<SqX::f, f, int64_t>(xv), s2s<Sq::f, f, int64_t>(yv) );
+        }
+        static constexpr base_t value(typename Sq::base_t yv, typename SqX::base_t xv) noexcept {
+            // the angle is approximated; limit it to the range
+            constexpr auto angleMin = static_cast<int64_t>( fpm::scaled<f, base_t>(realMin) );
+            constexpr auto angleMax = static_cast<int64_t>( fpm::scaled<f, base_t>(realMax) );
+            int64_t const angle = fpm::detail::fromPhase<unit, f, int64_t>( polar(yv, xv).second );
+            return static_cast<base_t>( std::clamp(angle, angleMin, angleMax) );
+        }
+    };
+
+    /// Implements the polar function; Sq is the x component of the vector, SqY the y component.
+    /// Implements the magnitude; the angle is implemented by Atan2 of SqY.
+    template< SqType SqY, AngleUnit unit >
+    requires fpm::detail::CanBePassedToAtan2<SqY, Sq>
+    struct Polar {
+        using angle_impl_t = typename SqY::template Atan2<Sq, unit>;
+        static constexpr scaling_t f = angle_impl_t::f;
+        /// Distance of the nearest point of the interval [min, max] to 0.
+        static constexpr double nearest(double min, double max) noexcept {
+            return (min > 0.) ? min : (max < 0.) ? -max : 0.;
+        }
+        static constexpr double realMin = fpm::detail::hypot( nearest(Sq::realMin, Sq::realMax), nearest(SqY::realMin, SqY::realMax) );
+        static constexpr double realMax = fpm::detail::hypot(
+            std::max( fpm::detail::abs(Sq::realMin), fpm::detail::abs(Sq::realMax) ),
+            std::max( fpm::detail::abs(SqY::realMin), fpm::detail::abs(SqY::realMax) ) );
+        using base_t = fpm::detail::common_q_base_t<typename Sq::base_t, typename SqY::base_t, f, realMin, realMax>;
+        static constexpr bool innerConstraints = fpm::detail::ValidImplType<angle_impl_t>;
+        /// \returns { magnitude, angle }.
+        static constexpr std::pair<base_t, typename angle_impl_t::base_t> value(typename Sq::base_t xv, typename SqY::base_t yv) noexcept {
+            // the limits and the magnitude are approximated; limit the magnitude to the range
+            constexpr auto magnitudeMin = static_cast<int64_t>( fpm::scaled<f, base_t>(realMin) );
+            constexpr auto magnitudeMax = static_cast<int64_t>( fpm::scaled<f, base_t>(realMax) );
+            constexpr auto angleMin = static_cast<int64_t>( fpm::scaled<f, typename angle_impl_t::base_t>(angle_impl_t::realMin) );
+            constexpr auto angleMax = static_cast<int64_t>( fpm::scaled<f, typename angle_impl_t::base_t>(angle_impl_t::realMax) );
+            auto const [magnitude, phase] = angle_impl_t::polar(yv, xv);
+            int64_t const angle = fpm::detail::fromPhase<unit, f, int64_t>(phase);
+            return { static_cast<base_t>( std::clamp(magnitude, magnitudeMin, magnitudeMax) ),
+                     static_cast<typename angle_impl_t::base_t>( std::clamp(angle, angleMin, angleMax) ) };
+        }
+    };
+
     /// Implements the clamp functions with Sq limits. This version is capable of runtime conversions
     /// between different Sq types.
     template< SqType SqLo, SqType SqHi >
@@ -519,13 +858,13 @@ private:
         static constexpr double realMax = SqHi::realMax;
         static constexpr bool innerConstraints = true;
         static constexpr base_t range(Sq const &v, SqLo const &lo, SqHi const &hi) noexcept {
-            return (v < lo) ? s2s<SqLo::f, f, base_t>(lo.value) : (hi < v) ? s2s<SqHi::f, f, base_t>(hi.value) : v.value;
+            return (v < lo) ? s2s<SqLo::f, f, base_t, rounding>(lo.value) : (hi < v) ? s2s<SqHi::f, f, base_t, rounding>(hi.value) : v.value;
         };
         static constexpr base_t lower(Sq const &v, SqLo const &lo) noexcept {
-            return (v < lo) ? s2s<SqLo::f, f, base_t>(lo.value) : v.value;  // clamp to lo
+            return (v < lo) ? s2s<SqLo::f, f, base_t, rounding>(lo.value) : v.value;  // clamp to lo
         };
         static constexpr base_t upper(Sq const &v, SqHi const &hi) noexcept {
-            return (hi < v) ? s2s<SqHi::f, f, base_t>(hi.value) : v.value;  // clamp to hi
+            return (hi < v) ? s2s<SqHi::f, f, base_t, rounding>(hi.value) : v.value;  // clamp to hi
         };
     };
 
@@ -650,6 +989,19 @@ public:
         return Sq< UNPACK(Mult<SqRhs>) >( Mult<SqRhs>::value(lhs.value, rhs.value) );
     }
 
+    /// Fused multiply-add: computes a * b + c.
+    /// The product is not rescaled; c is added to the product at double scaling in the calculation
+    /// type of the multiplication, and the sum is rescaled only once. Compared to a * b + c, this
+    /// saves one rescaling per operand and truncates only once.
+    /// \returns the result, wrapped into a new Sq type with the largest scaling of the inputs and the
+    /// value range of a * b + c.
+    template< /* deduced: */ SqType SqB, SqType SqC >
+    requires fpm::detail::ValidImplType< Fma<SqB, SqC> >
+    friend constexpr
+    auto fma(Sq const &a, SqB const &b, SqC const &c) noexcept {
+        return Sq< UNPACK(Fma<SqB, SqC>) >( Fma<SqB, SqC>::value(a.value, b.value, c.value) );
+    }
+
     /// Multiplies the lhs Sq value with the rhs integral constant.
     /// \returns the product, wrapped in a new Sq type with the common base type and a value range
     /// scaled by the same integral constant.
@@ -700,6 +1052,8 @@ public:
     /// \warning Arithmetic underflow can happen if the result is smaller than the target resolution.
     /// \warning To ensure that compile-time overflow checks are not required, the rhs constant must
     ///          not be 0.
+    /// \note The quotient is rounded with the rounding mode of the lhs type. The remainder for the
+    /// rounding correction is calculated with a multiplication, not with a runtime division.
     // Note: Passing lhs by value helps optimize chained a/b/c.
     template< /* deduced: */ std::integral T, T ic >
     requires fpm::detail::ValidImplType< DivIcR<T,ic> >
@@ -804,7 +1158,8 @@ public:
     /// of int32_t and the base type of the given number.
     /// \note The error propagation is similar to that of the multiplication operator: When a number
     /// x is multiplied with itself n times, the maximum real error is (n+1)*x^n * 2^(-f).
-    /// For the square function (n=1) this gives 2x * 2^(-f) at most.
+    /// For the square function (n=1) this gives 2x * 2^(-f) at most. The product is rounded with
+    /// the rounding mode of x, like the multiplication operator.
     friend constexpr
     auto sqr(Sq const &x) noexcept
     requires fpm::detail::ValidImplType< Square > {
@@ -838,13 +1193,47 @@ public:
     /// and the base type of the given number.
     /// \note The error propagation is similar to that of the multiplication operator: When a number
     /// x is multiplied with itself n times, the maximum real error is (n+1)*x^n * 2^(-f).
-    /// For the cube function (n=2) this gives 3x^2 * 2^(-f) at most.
+    /// For the cube function (n=2) this gives 3x^2 * 2^(-f) at most. Both products are rounded with
+    /// the rounding mode of x, and the result is clamped to the cubed limits.
     friend constexpr
     auto cube(Sq const &x) noexcept
     requires fpm::detail::ValidImplType< Cube > {
         return Sq< UNPACK(Cube) >( Cube::value(x.value) );
     }
 
+    /// \returns the n-th power of the given number x, wrapped into a new Sq type with at least 32
+    /// bits base type and the powers of the limits. The base type is widened if the resulting range
+    /// requires it. The exponent is given as integral constant, e.g. pow(x, 5_ic), and must be 1 or
+    /// larger.
+    /// \note The power is calculated by squaring in a single wide intermediate type, with
+    /// floor(log2(n)) + popcount(n) - 1 multiplications. Each product is rescaled with the rounding
+    /// mode of x. The error propagation is similar to that of the multiplication operator (see
+    /// sqr()); the result is clamped to the powers of the limits, which the accumulated rounding
+    /// errors could exceed by a few resolution steps otherwise.
+    template< /* deduced: */ std::integral T, T n >
+    requires fpm::detail::ValidImplType< Pow<T, n> >
+    friend constexpr
+    auto pow(Sq const &x, std::integral_constant<T, n>) noexcept {
+        using Impl = Pow<T, n>;
+        return Sq< UNPACK(Impl) >( Impl::value(x.value) );
+    }
+
+    /// \returns the value of the polynomial c0 + c1*x + ... + cn*x^n with the given real coefficients
+    /// at x, e.g. poly<0.5, -1.25, 0.75>(x), wrapped into a new Sq type with the scaling of x and the
+    /// exact range of the polynomial over the range of x.
+    /// \note The polynomial is evaluated with Horner's scheme in a single 64-bit or 128-bit integer
+    /// without intermediate rescaling; the coefficients are scaled such that no intermediate value
+    /// overflows, which is checked at compile-time with interval arithmetic. The result is rounded
+    /// once with the rounding mode of x and deviates from the exact value by less than one
+    /// resolution step (by about half a step with nearest and convergent).
+    template< double... coeffs >
+    friend constexpr
+    auto poly(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< Poly<coeffs...> > {
+        using Impl = Poly<coeffs...>;
+        return Sq< UNPACK(Impl) >( Impl::value(x.value) );
+    }
+
     /// \returns the computed cube root of the given number x, wrapped into a new Sq type with the
     /// cube roots of the limits.
     /// \note A hardware algorithm is used to calculate the cube root of the number, the cube root
@@ -855,6 +1244,146 @@ public:
         return Sq< UNPACK(Cbrt<base_t>) >( Cbrt<base_t>::value(x.value) );
     }
 
+    /// \returns the computed reciprocal cube root of the given number x, wrapped into a new Sq type
+    /// with the reciprocal cube root of the limits. The maximum limit of the resulting type does not
+    /// exceed the value range of its base type.
+    /// \warning This uses a division. May be expensive!
+    /// \note The cube root of x is rounded down before the division, thus the result can be larger
+    /// than the exact reciprocal cube root. The maximum real error evaluates to approximately
+    /// 2^(-f) * ( 1 + (1/x)^(2/3) ). The result is limited to the range of the resulting type.
+    friend constexpr
+    auto rcbrt(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< RCbrt<base_t> > {
+        return Sq< UNPACK(RCbrt<base_t>) >( RCbrt<base_t>::value(x.value) );
+    }
+
+    /// \returns the 2-based logarithm of the given number x, wrapped into a new signed Sq type with
+    /// the scaling of x and the logarithms of the limits, rounded outwards to integers.
+    /// \note The number is normalized with a count-leading-zeros operation; the logarithm of the
+    /// mantissa is interpolated from a table which is generated at compile-time. The result
+    /// deviates from the exact value by up to about 2^-18.5 (plus rounding to the resolution of the
+    /// result). The minimum of x must be positive and at least the resolution of x.
+    friend constexpr
+    auto log2(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< Log<false> > {
+        return Sq< UNPACK(Log<false>) >( Log<false>::value(x.value) );
+    }
+
+    /// \returns the natural logarithm of the given number x, wrapped into a new signed Sq type with
+    /// the scaling of x and the logarithms of the limits, rounded outwards to integers.
+    /// \note Calculated as log2(x) * ln(2); see log2().
+    friend constexpr
+    auto log(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< Log<true> > {
+        return Sq< UNPACK(Log<true>) >( Log<true>::value(x.value) );
+    }
+
+    /// \returns 2 to the power of the given number x, wrapped into a new Sq type with the scaling
+    /// of x and the exponentials of the limits, rounded outwards to integers. The base type is
+    /// widened if the range of the result requires it.
+    /// \note The integral part of x is applied as shift; 2 to the power of the fraction of x is
+    /// interpolated from a table which is generated at compile-time. The result deviates from the
+    /// exact value by up to about 2^-19.5 relative to the value (plus rounding to the resolution of
+    /// the result).
+    friend constexpr
+    auto exp2(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< Exp<false> > {
+        return Sq< UNPACK(Exp<false>) >( Exp<false>::value(x.value) );
+    }
+
+    /// \returns the natural exponential of the given number x, wrapped into a new Sq type with the
+    /// scaling of x and the exponentials of the limits, rounded outwards to integers. The base type
+    /// is widened if the range of the result requires it.
+    /// \note Calculated as exp2(x * log2(e)); see exp2().
+    friend constexpr
+    auto exp(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< Exp<true> > {
+        return Sq< UNPACK(Exp<true>) >( Exp<true>::value(x.value) );
+    }
+
+    /// \returns the sine of the given angle x, wrapped into a new Sq type with the scaling of x, a
+    /// signed base type of the same size, and the limits -1 and 1.
+    /// \note The angle is given in radians by default, or in turns (AngleUnit::turn). The engine
+    /// can be selected per call, e.g. sin<TrigEngine::lut>(x). Both engines use integer operations
+    /// only. The CORDIC result deviates from the exact value by up to about 2^-25, the interpolated
+    /// table value by up to about 2^-17.7 (plus rounding to the resolution of the result).
+    template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+    friend constexpr
+    auto sin(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< SinCos<engine, unit> > {
+        using Impl = SinCos<engine, unit>;
+        return Sq< UNPACK(Impl) >( Impl::value(x.value).first );
+    }
+
+    /// \returns the cosine of the given angle x, wrapped into a new Sq type with the scaling of x,
+    /// a signed base type of the same size, and the limits -1 and 1.
+    /// \note See sin() for the angle unit, the engine and the precision.
+    template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+    friend constexpr
+    auto cos(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< SinCos<engine, unit> > {
+        using Impl = SinCos<engine, unit>;
+        return Sq< UNPACK(Impl) >( Impl::value(x.value).second );
+    }
+
+    /// \returns the sine and the cosine of the given angle x as a pair of Sq values, calculated
+    /// together at the cost of one sin() call, e.g. for Park transforms.
+    /// \note See sin() for the angle unit, the engine and the precision.
+    template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+    friend constexpr
+    auto sincos(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< SinCos<engine, unit> > {
+        using Impl = SinCos<engine, unit>;
+        using result_t = Sq< UNPACK(Impl) >;
+        auto const [sinValue, cosValue] = Impl::value(x.value);
+        return std::pair<result_t, result_t>( result_t(sinValue), result_t(cosValue) );
+    }
+
+    /// \returns the tangent of the given angle x, wrapped into a new Sq type with the scaling of x,
+    /// a signed base type of the same size, and the tangents of the limits.
+    /// \note The angle must be within (-pi/2, pi/2), or (-1/4, 1/4) turns respectively.
+    /// \warning This uses a division. May be expensive!
+    template< TrigEngine engine = TrigEngine::cordic, AngleUnit unit = AngleUnit::rad >
+    friend constexpr
+    auto tan(Sq const &x) noexcept
+    requires fpm::detail::ValidImplType< Tan<engine, unit> > {
+        using Impl = Tan<engine, unit>;
+        return Sq< UNPACK(Impl) >( Impl::value(x.value) );
+    }
+
+    /// \returns the angle of the vector (x, y) with the positive x-axis in (-pi, pi], wrapped into a
+    /// new Sq type with the larger scaling of y and x. The range is narrowed to the half-planes or
+    /// quadrants which are covered by the ranges of y and x.
+    /// \note The angle is returned in radians by default, or in turns (AngleUnit::turn). It is
+    /// calculated with a CORDIC algorithm in vectoring mode, with shifts and additions only. The
+    /// result deviates from the exact value by up to about 2^-27 turns (plus rounding to the
+    /// resolution of the result). atan2(0, 0) is 0.
+    template< AngleUnit unit = AngleUnit::rad, /* deduced: */ SqType SqX >
+    friend constexpr
+    auto atan2(Sq const &y, SqX const &x) noexcept
+    requires fpm::detail::ValidImplType< Atan2<SqX, unit> > {
+        using Impl = Atan2<SqX, unit>;
+        return Sq< UNPACK(Impl) >( Impl::value(y.value, x.value) );
+    }
+
+    /// \returns the magnitude and the angle of the vector (x, y) as a pair of Sq values, calculated
+    /// together in one CORDIC pass. The magnitude has the larger scaling of x and y and the range
+    /// of the magnitudes of the corners of the input ranges; the angle is the same as for atan2(y, x).
+    /// \note The magnitude deviates from the exact value by up to about 2^-25 of the largest
+    /// component magnitude of the input ranges (plus rounding to the resolution of the result).
+    /// See atan2() for the angle.
+    template< AngleUnit unit = AngleUnit::rad, /* deduced: */ SqType SqY >
+    friend constexpr
+    auto polar(Sq const &x, SqY const &y) noexcept
+    requires fpm::detail::ValidImplType< Polar<SqY, unit> > {
+        using Impl = Polar<SqY, unit>;
+        using AngleImpl = typename Impl::angle_impl_t;
+        using magnitude_t = Sq< UNPACK(Impl) >;
+        using angle_t = Sq< UNPACK(AngleImpl) >;
+        auto const [magnitude, angle] = Impl::value(x.value, y.value);
+        return std::pair<magnitude_t, angle_t>( magnitude_t(magnitude), angle_t(angle) );
+    }
+
     /// If v compares less than lo, lo is returned; otherwise if hi compares less than v, hi is
     /// returned; otherwise v is returned.
     /// \returns clamped v, wrapped into a new Sq type with the lower limit of SqLo and the upper
@@ -945,15 +1474,39 @@ private:
     Sq(base_t value) noexcept : value(value) {}
 
     // friend all Sq types so that private members of similar types can be accessed for construction
-    template< std::integral BaseTSq, scaling_t fSq, double realMinSq, double realMaxSq >
+    template< std::integral BaseTSq, scaling_t fSq, double realMinSq, double realMaxSq, Rounding rndSq >
     requires fpm::detail::SqRequirements<BaseTSq, fSq, realMinSq, realMaxSq>
     friend class Sq;
 
     // friend Q type so that it can access the private members of a Sq type to construct it
-    template< std::integral BaseTQ, scaling_t fQ, double realMinQ, double realMaxQ, Overflow ovfQ >
+    template< std::integral BaseTQ, scaling_t fQ, double realMinQ, double realMaxQ, Overflow ovfQ, Rounding rndQ >
     requires fpm::detail::QRequirements<BaseTQ, fQ, realMinQ, realMaxQ, ovfQ>
     friend class q::Q;
 
+    // friend Reciprocal type so that it can access the private members of a Sq type
+    template< SqType SqDivisor >
+    requires fpm::detail::CanBeUsedAsDivisor<SqDivisor>
+    friend class Reciprocal;
+
+    // friend Accumulator type so that it can access the private members of a Sq type
+    template< SqType SqElem, std::size_t N >
+    requires ( N > 0u )
+    friend class Accumulator;
+
+    // friend Lut type so that it can access the private members of a Sq type
+    template< SqType SqIn, SqType SqOut, std::size_t N, auto fn >
+    requires fpm::detail::CanBeUsedInLut<SqIn, SqOut, N>
+    friend class Lut;
+
+    // friend Pwl type so that it can access the private members of a Sq type
+    template< SqType SqX, SqType SqY, Knot... knots >
+    requires fpm::detail::CanBeUsedInPwl<SqX, SqY, sizeof...(knots)>
+    friend class Pwl;
+
+    // friend Expr type so that it can construct the Sq value of an evaluated expression
+    template< class Node >
+    friend class Expr;
+
     //
     // memory
     //
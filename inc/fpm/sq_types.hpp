@@ -26,174 +26,349 @@ namespace fpm::sq::inline types {
 
 /* sq types */
 
-template< double lower = fpm::detail::realMin<  int8_t,  -4>(), double upper = fpm::detail::realMax<  int8_t,  -4>() > using   i8sqm4 = Sq<  int8_t,  -4, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,  -3>(), double upper = fpm::detail::realMax<  int8_t,  -3>() > using   i8sqm3 = Sq<  int8_t,  -3, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,  -2>(), double upper = fpm::detail::realMax<  int8_t,  -2>() > using   i8sqm2 = Sq<  int8_t,  -2, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,  -1>(), double upper = fpm::detail::realMax<  int8_t,  -1>() > using   i8sqm1 = Sq<  int8_t,  -1, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   0>(), double upper = fpm::detail::realMax<  int8_t,   0>() > using    i8sq0 = Sq<  int8_t,   0, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   1>(), double upper = fpm::detail::realMax<  int8_t,   1>() > using    i8sq1 = Sq<  int8_t,   1, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   2>(), double upper = fpm::detail::realMax<  int8_t,   2>() > using    i8sq2 = Sq<  int8_t,   2, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   3>(), double upper = fpm::detail::realMax<  int8_t,   3>() > using    i8sq3 = Sq<  int8_t,   3, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   4>(), double upper = fpm::detail::realMax<  int8_t,   4>() > using    i8sq4 = Sq<  int8_t,   4, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   5>(), double upper = fpm::detail::realMax<  int8_t,   5>() > using    i8sq5 = Sq<  int8_t,   5, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   6>(), double upper = fpm::detail::realMax<  int8_t,   6>() > using    i8sq6 = Sq<  int8_t,   6, lower, upper>;
-template< double lower = fpm::detail::realMin<  int8_t,   7>(), double upper = fpm::detail::realMax<  int8_t,   7>() > using    i8sq7 = Sq<  int8_t,   7, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,  -4>(), double upper = fpm::detail::realMax< uint8_t,  -4>() > using   u8sqm4 = Sq< uint8_t,  -4, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,  -3>(), double upper = fpm::detail::realMax< uint8_t,  -3>() > using   u8sqm3 = Sq< uint8_t,  -3, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,  -2>(), double upper = fpm::detail::realMax< uint8_t,  -2>() > using   u8sqm2 = Sq< uint8_t,  -2, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,  -1>(), double upper = fpm::detail::realMax< uint8_t,  -1>() > using   u8sqm1 = Sq< uint8_t,  -1, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   0>(), double upper = fpm::detail::realMax< uint8_t,   0>() > using    u8sq0 = Sq< uint8_t,   0, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   1>(), double upper = fpm::detail::realMax< uint8_t,   1>() > using    u8sq1 = Sq< uint8_t,   1, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   2>(), double upper = fpm::detail::realMax< uint8_t,   2>() > using    u8sq2 = Sq< uint8_t,   2, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   3>(), double upper = fpm::detail::realMax< uint8_t,   3>() > using    u8sq3 = Sq< uint8_t,   3, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   4>(), double upper = fpm::detail::realMax< uint8_t,   4>() > using    u8sq4 = Sq< uint8_t,   4, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   5>(), double upper = fpm::detail::realMax< uint8_t,   5>() > using    u8sq5 = Sq< uint8_t,   5, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   6>(), double upper = fpm::detail::realMax< uint8_t,   6>() > using    u8sq6 = Sq< uint8_t,   6, lower, upper>;
-template< double lower = fpm::detail::realMin< uint8_t,   7>(), double upper = fpm::detail::realMax< uint8_t,   7>() > using    u8sq7 = Sq< uint8_t,   7, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -8>(), double upper = fpm::detail::realMax< int16_t,  -8>() > using  i16sqm8 = Sq< int16_t,  -8, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -7>(), double upper = fpm::detail::realMax< int16_t,  -7>() > using  i16sqm7 = Sq< int16_t,  -7, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -6>(), double upper = fpm::detail::realMax< int16_t,  -6>() > using  i16sqm6 = Sq< int16_t,  -6, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -5>(), double upper = fpm::detail::realMax< int16_t,  -5>() > using  i16sqm5 = Sq< int16_t,  -5, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -4>(), double upper = fpm::detail::realMax< int16_t,  -4>() > using  i16sqm4 = Sq< int16_t,  -4, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -3>(), double upper = fpm::detail::realMax< int16_t,  -3>() > using  i16sqm3 = Sq< int16_t,  -3, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -2>(), double upper = fpm::detail::realMax< int16_t,  -2>() > using  i16sqm2 = Sq< int16_t,  -2, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  -1>(), double upper = fpm::detail::realMax< int16_t,  -1>() > using  i16sqm1 = Sq< int16_t,  -1, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   0>(), double upper = fpm::detail::realMax< int16_t,   0>() > using   i16sq0 = Sq< int16_t,   0, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   1>(), double upper = fpm::detail::realMax< int16_t,   1>() > using   i16sq1 = Sq< int16_t,   1, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   2>(), double upper = fpm::detail::realMax< int16_t,   2>() > using   i16sq2 = Sq< int16_t,   2, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   3>(), double upper = fpm::detail::realMax< int16_t,   3>() > using   i16sq3 = Sq< int16_t,   3, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   4>(), double upper = fpm::detail::realMax< int16_t,   4>() > using   i16sq4 = Sq< int16_t,   4, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   5>(), double upper = fpm::detail::realMax< int16_t,   5>() > using   i16sq5 = Sq< int16_t,   5, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   6>(), double upper = fpm::detail::realMax< int16_t,   6>() > using   i16sq6 = Sq< int16_t,   6, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   7>(), double upper = fpm::detail::realMax< int16_t,   7>() > using   i16sq7 = Sq< int16_t,   7, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   8>(), double upper = fpm::detail::realMax< int16_t,   8>() > using   i16sq8 = Sq< int16_t,   8, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,   9>(), double upper = fpm::detail::realMax< int16_t,   9>() > using   i16sq9 = Sq< int16_t,   9, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  10>(), double upper = fpm::detail::realMax< int16_t,  10>() > using  i16sq10 = Sq< int16_t,  10, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  11>(), double upper = fpm::detail::realMax< int16_t,  11>() > using  i16sq11 = Sq< int16_t,  11, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  12>(), double upper = fpm::detail::realMax< int16_t,  12>() > using  i16sq12 = Sq< int16_t,  12, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  13>(), double upper = fpm::detail::realMax< int16_t,  13>() > using  i16sq13 = Sq< int16_t,  13, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  14>(), double upper = fpm::detail::realMax< int16_t,  14>() > using  i16sq14 = Sq< int16_t,  14, lower, upper>;
-template< double lower = fpm::detail::realMin< int16_t,  15>(), double upper = fpm::detail::realMax< int16_t,  15>() > using  i16sq15 = Sq< int16_t,  15, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -8>(), double upper = fpm::detail::realMax<uint16_t,  -8>() > using  u16sqm8 = Sq<uint16_t,  -8, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -7>(), double upper = fpm::detail::realMax<uint16_t,  -7>() > using  u16sqm7 = Sq<uint16_t,  -7, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -6>(), double upper = fpm::detail::realMax<uint16_t,  -6>() > using  u16sqm6 = Sq<uint16_t,  -6, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -5>(), double upper = fpm::detail::realMax<uint16_t,  -5>() > using  u16sqm5 = Sq<uint16_t,  -5, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -4>(), double upper = fpm::detail::realMax<uint16_t,  -4>() > using  u16sqm4 = Sq<uint16_t,  -4, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -3>(), double upper = fpm::detail::realMax<uint16_t,  -3>() > using  u16sqm3 = Sq<uint16_t,  -3, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -2>(), double upper = fpm::detail::realMax<uint16_t,  -2>() > using  u16sqm2 = Sq<uint16_t,  -2, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  -1>(), double upper = fpm::detail::realMax<uint16_t,  -1>() > using  u16sqm1 = Sq<uint16_t,  -1, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   0>(), double upper = fpm::detail::realMax<uint16_t,   0>() > using   u16sq0 = Sq<uint16_t,   0, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   1>(), double upper = fpm::detail::realMax<uint16_t,   1>() > using   u16sq1 = Sq<uint16_t,   1, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   2>(), double upper = fpm::detail::realMax<uint16_t,   2>() > using   u16sq2 = Sq<uint16_t,   2, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   3>(), double upper = fpm::detail::realMax<uint16_t,   3>() > using   u16sq3 = Sq<uint16_t,   3, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   4>(), double upper = fpm::detail::realMax<uint16_t,   4>() > using   u16sq4 = Sq<uint16_t,   4, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   5>(), double upper = fpm::detail::realMax<uint16_t,   5>() > using   u16sq5 = Sq<uint16_t,   5, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   6>(), double upper = fpm::detail::realMax<uint16_t,   6>() > using   u16sq6 = Sq<uint16_t,   6, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   7>(), double upper = fpm::detail::realMax<uint16_t,   7>() > using   u16sq7 = Sq<uint16_t,   7, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   8>(), double upper = fpm::detail::realMax<uint16_t,   8>() > using   u16sq8 = Sq<uint16_t,   8, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,   9>(), double upper = fpm::detail::realMax<uint16_t,   9>() > using   u16sq9 = Sq<uint16_t,   9, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  10>(), double upper = fpm::detail::realMax<uint16_t,  10>() > using  u16sq10 = Sq<uint16_t,  10, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  11>(), double upper = fpm::detail::realMax<uint16_t,  11>() > using  u16sq11 = Sq<uint16_t,  11, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  12>(), double upper = fpm::detail::realMax<uint16_t,  12>() > using  u16sq12 = Sq<uint16_t,  12, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  13>(), double upper = fpm::detail::realMax<uint16_t,  13>() > using  u16sq13 = Sq<uint16_t,  13, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  14>(), double upper = fpm::detail::realMax<uint16_t,  14>() > using  u16sq14 = Sq<uint16_t,  14, lower, upper>;
-template< double lower = fpm::detail::realMin<uint16_t,  15>(), double upper = fpm::detail::realMax<uint16_t,  15>() > using  u16sq15 = Sq<uint16_t,  15, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t, -16>(), double upper = fpm::detail::realMax< int32_t, -16>() > using i32sqm16 = Sq< int32_t, -16, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t, -15>(), double upper = fpm::detail::realMax< int32_t, -15>() > using i32sqm15 = Sq< int32_t, -15, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t, -14>(), double upper = fpm::detail::realMax< int32_t, -14>() > using i32sqm14 = Sq< int32_t, -14, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t, -13>(), double upper = fpm::detail::realMax< int32_t, -13>() > using i32sqm13 = Sq< int32_t, -13, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t, -12>(), double upper = fpm::detail::realMax< int32_t, -12>() > using i32sqm12 = Sq< int32_t, -12, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t, -11>(), double upper = fpm::detail::realMax< int32_t, -11>() > using i32sqm11 = Sq< int32_t, -11, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t, -10>(), double upper = fpm::detail::realMax< int32_t, -10>() > using i32sqm10 = Sq< int32_t, -10, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -9>(), double upper = fpm::detail::realMax< int32_t,  -9>() > using  i32sqm9 = Sq< int32_t,  -9, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -8>(), double upper = fpm::detail::realMax< int32_t,  -8>() > using  i32sqm8 = Sq< int32_t,  -8, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -7>(), double upper = fpm::detail::realMax< int32_t,  -7>() > using  i32sqm7 = Sq< int32_t,  -7, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -6>(), double upper = fpm::detail::realMax< int32_t,  -6>() > using  i32sqm6 = Sq< int32_t,  -6, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -5>(), double upper = fpm::detail::realMax< int32_t,  -5>() > using  i32sqm5 = Sq< int32_t,  -5, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -4>(), double upper = fpm::detail::realMax< int32_t,  -4>() > using  i32sqm4 = Sq< int32_t,  -4, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -3>(), double upper = fpm::detail::realMax< int32_t,  -3>() > using  i32sqm3 = Sq< int32_t,  -3, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -2>(), double upper = fpm::detail::realMax< int32_t,  -2>() > using  i32sqm2 = Sq< int32_t,  -2, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  -1>(), double upper = fpm::detail::realMax< int32_t,  -1>() > using  i32sqm1 = Sq< int32_t,  -1, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   0>(), double upper = fpm::detail::realMax< int32_t,   0>() > using   i32sq0 = Sq< int32_t,   0, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   1>(), double upper = fpm::detail::realMax< int32_t,   1>() > using   i32sq1 = Sq< int32_t,   1, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   2>(), double upper = fpm::detail::realMax< int32_t,   2>() > using   i32sq2 = Sq< int32_t,   2, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   3>(), double upper = fpm::detail::realMax< int32_t,   3>() > using   i32sq3 = Sq< int32_t,   3, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   4>(), double upper = fpm::detail::realMax< int32_t,   4>() > using   i32sq4 = Sq< int32_t,   4, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   5>(), double upper = fpm::detail::realMax< int32_t,   5>() > using   i32sq5 = Sq< int32_t,   5, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   6>(), double upper = fpm::detail::realMax< int32_t,   6>() > using   i32sq6 = Sq< int32_t,   6, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   7>(), double upper = fpm::detail::realMax< int32_t,   7>() > using   i32sq7 = Sq< int32_t,   7, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   8>(), double upper = fpm::detail::realMax< int32_t,   8>() > using   i32sq8 = Sq< int32_t,   8, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,   9>(), double upper = fpm::detail::realMax< int32_t,   9>() > using   i32sq9 = Sq< int32_t,   9, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  10>(), double upper = fpm::detail::realMax< int32_t,  10>() > using  i32sq10 = Sq< int32_t,  10, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  11>(), double upper = fpm::detail::realMax< int32_t,  11>() > using  i32sq11 = Sq< int32_t,  11, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  12>(), double upper = fpm::detail::realMax< int32_t,  12>() > using  i32sq12 = Sq< int32_t,  12, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  13>(), double upper = fpm::detail::realMax< int32_t,  13>() > using  i32sq13 = Sq< int32_t,  13, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  14>(), double upper = fpm::detail::realMax< int32_t,  14>() > using  i32sq14 = Sq< int32_t,  14, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  15>(), double upper = fpm::detail::realMax< int32_t,  15>() > using  i32sq15 = Sq< int32_t,  15, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  16>(), double upper = fpm::detail::realMax< int32_t,  16>() > using  i32sq16 = Sq< int32_t,  16, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  17>(), double upper = fpm::detail::realMax< int32_t,  17>() > using  i32sq17 = Sq< int32_t,  17, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  18>(), double upper = fpm::detail::realMax< int32_t,  18>() > using  i32sq18 = Sq< int32_t,  18, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  19>(), double upper = fpm::detail::realMax< int32_t,  19>() > using  i32sq19 = Sq< int32_t,  19, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  20>(), double upper = fpm::detail::realMax< int32_t,  20>() > using  i32sq20 = Sq< int32_t,  20, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  21>(), double upper = fpm::detail::realMax< int32_t,  21>() > using  i32sq21 = Sq< int32_t,  21, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  22>(), double upper = fpm::detail::realMax< int32_t,  22>() > using  i32sq22 = Sq< int32_t,  22, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  23>(), double upper = fpm::detail::realMax< int32_t,  23>() > using  i32sq23 = Sq< int32_t,  23, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  24>(), double upper = fpm::detail::realMax< int32_t,  24>() > using  i32sq24 = Sq< int32_t,  24, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  25>(), double upper = fpm::detail::realMax< int32_t,  25>() > using  i32sq25 = Sq< int32_t,  25, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  26>(), double upper = fpm::detail::realMax< int32_t,  26>() > using  i32sq26 = Sq< int32_t,  26, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  27>(), double upper = fpm::detail::realMax< int32_t,  27>() > using  i32sq27 = Sq< int32_t,  27, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  28>(), double upper = fpm::detail::realMax< int32_t,  28>() > using  i32sq28 = Sq< int32_t,  28, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  29>(), double upper = fpm::detail::realMax< int32_t,  29>() > using  i32sq29 = Sq< int32_t,  29, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  30>(), double upper = fpm::detail::realMax< int32_t,  30>() > using  i32sq30 = Sq< int32_t,  30, lower, upper>;
-template< double lower = fpm::detail::realMin< int32_t,  31>(), double upper = fpm::detail::realMax< int32_t,  31>() > using  i32sq31 = Sq< int32_t,  31, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t, -16>(), double upper = fpm::detail::realMax<uint32_t, -16>() > using u32sqm16 = Sq<uint32_t, -16, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t, -15>(), double upper = fpm::detail::realMax<uint32_t, -15>() > using u32sqm15 = Sq<uint32_t, -15, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t, -14>(), double upper = fpm::detail::realMax<uint32_t, -14>() > using u32sqm14 = Sq<uint32_t, -14, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t, -13>(), double upper = fpm::detail::realMax<uint32_t, -13>() > using u32sqm13 = Sq<uint32_t, -13, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t, -12>(), double upper = fpm::detail::realMax<uint32_t, -12>() > using u32sqm12 = Sq<uint32_t, -12, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t, -11>(), double upper = fpm::detail::realMax<uint32_t, -11>() > using u32sqm11 = Sq<uint32_t, -11, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t, -10>(), double upper = fpm::detail::realMax<uint32_t, -10>() > using u32sqm10 = Sq<uint32_t, -10, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -9>(), double upper = fpm::detail::realMax<uint32_t,  -9>() > using  u32sqm9 = Sq<uint32_t,  -9, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -8>(), double upper = fpm::detail::realMax<uint32_t,  -8>() > using  u32sqm8 = Sq<uint32_t,  -8, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -7>(), double upper = fpm::detail::realMax<uint32_t,  -7>() > using  u32sqm7 = Sq<uint32_t,  -7, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -6>(), double upper = fpm::detail::realMax<uint32_t,  -6>() > using  u32sqm6 = Sq<uint32_t,  -6, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -5>(), double upper = fpm::detail::realMax<uint32_t,  -5>() > using  u32sqm5 = Sq<uint32_t,  -5, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -4>(), double upper = fpm::detail::realMax<uint32_t,  -4>() > using  u32sqm4 = Sq<uint32_t,  -4, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -3>(), double upper = fpm::detail::realMax<uint32_t,  -3>() > using  u32sqm3 = Sq<uint32_t,  -3, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -2>(), double upper = fpm::detail::realMax<uint32_t,  -2>() > using  u32sqm2 = Sq<uint32_t,  -2, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  -1>(), double upper = fpm::detail::realMax<uint32_t,  -1>() > using  u32sqm1 = Sq<uint32_t,  -1, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   0>(), double upper = fpm::detail::realMax<uint32_t,   0>() > using   u32sq0 = Sq<uint32_t,   0, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   1>(), double upper = fpm::detail::realMax<uint32_t,   1>() > using   u32sq1 = Sq<uint32_t,   1, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   2>(), double upper = fpm::detail::realMax<uint32_t,   2>() > using   u32sq2 = Sq<uint32_t,   2, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   3>(), double upper = fpm::detail::realMax<uint32_t,   3>() > using   u32sq3 = Sq<uint32_t,   3, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   4>(), double upper = fpm::detail::realMax<uint32_t,   4>() > using   u32sq4 = Sq<uint32_t,   4, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   5>(), double upper = fpm::detail::realMax<uint32_t,   5>() > using   u32sq5 = Sq<uint32_t,   5, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   6>(), double upper = fpm::detail::realMax<uint32_t,   6>() > using   u32sq6 = Sq<uint32_t,   6, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   7>(), double upper = fpm::detail::realMax<uint32_t,   7>() > using   u32sq7 = Sq<uint32_t,   7, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   8>(), double upper = fpm::detail::realMax<uint32_t,   8>() > using   u32sq8 = Sq<uint32_t,   8, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,   9>(), double upper = fpm::detail::realMax<uint32_t,   9>() > using   u32sq9 = Sq<uint32_t,   9, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  10>(), double upper = fpm::detail::realMax<uint32_t,  10>() > using  u32sq10 = Sq<uint32_t,  10, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  11>(), double upper = fpm::detail::realMax<uint32_t,  11>() > using  u32sq11 = Sq<uint32_t,  11, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  12>(), double upper = fpm::detail::realMax<uint32_t,  12>() > using  u32sq12 = Sq<uint32_t,  12, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  13>(), double upper = fpm::detail::realMax<uint32_t,  13>() > using  u32sq13 = Sq<uint32_t,  13, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  14>(), double upper = fpm::detail::realMax<uint32_t,  14>() > using  u32sq14 = Sq<uint32_t,  14, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  15>(), double upper = fpm::detail::realMax<uint32_t,  15>() > using  u32sq15 = Sq<uint32_t,  15, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  16>(), double upper = fpm::detail::realMax<uint32_t,  16>() > using  u32sq16 = Sq<uint32_t,  16, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  17>(), double upper = fpm::detail::realMax<uint32_t,  17>() > using  u32sq17 = Sq<uint32_t,  17, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  18>(), double upper = fpm::detail::realMax<uint32_t,  18>() > using  u32sq18 = Sq<uint32_t,  18, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  19>(), double upper = fpm::detail::realMax<uint32_t,  19>() > using  u32sq19 = Sq<uint32_t,  19, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  20>(), double upper = fpm::detail::realMax<uint32_t,  20>() > using  u32sq20 = Sq<uint32_t,  20, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  21>(), double upper = fpm::detail::realMax<uint32_t,  21>() > using  u32sq21 = Sq<uint32_t,  21, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  22>(), double upper = fpm::detail::realMax<uint32_t,  22>() > using  u32sq22 = Sq<uint32_t,  22, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  23>(), double upper = fpm::detail::realMax<uint32_t,  23>() > using  u32sq23 = Sq<uint32_t,  23, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  24>(), double upper = fpm::detail::realMax<uint32_t,  24>() > using  u32sq24 = Sq<uint32_t,  24, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  25>(), double upper = fpm::detail::realMax<uint32_t,  25>() > using  u32sq25 = Sq<uint32_t,  25, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  26>(), double upper = fpm::detail::realMax<uint32_t,  26>() > using  u32sq26 = Sq<uint32_t,  26, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  27>(), double upper = fpm::detail::realMax<uint32_t,  27>() > using  u32sq27 = Sq<uint32_t,  27, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  28>(), double upper = fpm::detail::realMax<uint32_t,  28>() > using  u32sq28 = Sq<uint32_t,  28, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  29>(), double upper = fpm::detail::realMax<uint32_t,  29>() > using  u32sq29 = Sq<uint32_t,  29, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  30>(), double upper = fpm::detail::realMax<uint32_t,  30>() > using  u32sq30 = Sq<uint32_t,  30, lower, upper>;
-template< double lower = fpm::detail::realMin<uint32_t,  31>(), double upper = fpm::detail::realMax<uint32_t,  31>() > using  u32sq31 = Sq<uint32_t,  31, lower, upper>;
+template< double lower = fpm::detail::realMin<  int8_t,  -4>(), double upper = fpm::detail::realMax<  int8_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8sqm4 = Sq<  int8_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,  -3>(), double upper = fpm::detail::realMax<  int8_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8sqm3 = Sq<  int8_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,  -2>(), double upper = fpm::detail::realMax<  int8_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8sqm2 = Sq<  int8_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,  -1>(), double upper = fpm::detail::realMax<  int8_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i8sqm1 = Sq<  int8_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   0>(), double upper = fpm::detail::realMax<  int8_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq0 = Sq<  int8_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   1>(), double upper = fpm::detail::realMax<  int8_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq1 = Sq<  int8_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   2>(), double upper = fpm::detail::realMax<  int8_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq2 = Sq<  int8_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   3>(), double upper = fpm::detail::realMax<  int8_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq3 = Sq<  int8_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   4>(), double upper = fpm::detail::realMax<  int8_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq4 = Sq<  int8_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   5>(), double upper = fpm::detail::realMax<  int8_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq5 = Sq<  int8_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   6>(), double upper = fpm::detail::realMax<  int8_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq6 = Sq<  int8_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<  int8_t,   7>(), double upper = fpm::detail::realMax<  int8_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    i8sq7 = Sq<  int8_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -4>(), double upper = fpm::detail::realMax< uint8_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8sqm4 = Sq< uint8_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -3>(), double upper = fpm::detail::realMax< uint8_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8sqm3 = Sq< uint8_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -2>(), double upper = fpm::detail::realMax< uint8_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8sqm2 = Sq< uint8_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,  -1>(), double upper = fpm::detail::realMax< uint8_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u8sqm1 = Sq< uint8_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   0>(), double upper = fpm::detail::realMax< uint8_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq0 = Sq< uint8_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   1>(), double upper = fpm::detail::realMax< uint8_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq1 = Sq< uint8_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   2>(), double upper = fpm::detail::realMax< uint8_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq2 = Sq< uint8_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   3>(), double upper = fpm::detail::realMax< uint8_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq3 = Sq< uint8_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   4>(), double upper = fpm::detail::realMax< uint8_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq4 = Sq< uint8_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   5>(), double upper = fpm::detail::realMax< uint8_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq5 = Sq< uint8_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   6>(), double upper = fpm::detail::realMax< uint8_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq6 = Sq< uint8_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< uint8_t,   7>(), double upper = fpm::detail::realMax< uint8_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using    u8sq7 = Sq< uint8_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -8>(), double upper = fpm::detail::realMax< int16_t,  -8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm8 = Sq< int16_t,  -8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -7>(), double upper = fpm::detail::realMax< int16_t,  -7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm7 = Sq< int16_t,  -7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -6>(), double upper = fpm::detail::realMax< int16_t,  -6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm6 = Sq< int16_t,  -6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -5>(), double upper = fpm::detail::realMax< int16_t,  -5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm5 = Sq< int16_t,  -5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -4>(), double upper = fpm::detail::realMax< int16_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm4 = Sq< int16_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -3>(), double upper = fpm::detail::realMax< int16_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm3 = Sq< int16_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -2>(), double upper = fpm::detail::realMax< int16_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm2 = Sq< int16_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  -1>(), double upper = fpm::detail::realMax< int16_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sqm1 = Sq< int16_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   0>(), double upper = fpm::detail::realMax< int16_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq0 = Sq< int16_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   1>(), double upper = fpm::detail::realMax< int16_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq1 = Sq< int16_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   2>(), double upper = fpm::detail::realMax< int16_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq2 = Sq< int16_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   3>(), double upper = fpm::detail::realMax< int16_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq3 = Sq< int16_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   4>(), double upper = fpm::detail::realMax< int16_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq4 = Sq< int16_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   5>(), double upper = fpm::detail::realMax< int16_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq5 = Sq< int16_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   6>(), double upper = fpm::detail::realMax< int16_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq6 = Sq< int16_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   7>(), double upper = fpm::detail::realMax< int16_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq7 = Sq< int16_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   8>(), double upper = fpm::detail::realMax< int16_t,   8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq8 = Sq< int16_t,   8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,   9>(), double upper = fpm::detail::realMax< int16_t,   9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i16sq9 = Sq< int16_t,   9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  10>(), double upper = fpm::detail::realMax< int16_t,  10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sq10 = Sq< int16_t,  10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  11>(), double upper = fpm::detail::realMax< int16_t,  11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sq11 = Sq< int16_t,  11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  12>(), double upper = fpm::detail::realMax< int16_t,  12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sq12 = Sq< int16_t,  12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  13>(), double upper = fpm::detail::realMax< int16_t,  13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sq13 = Sq< int16_t,  13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  14>(), double upper = fpm::detail::realMax< int16_t,  14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sq14 = Sq< int16_t,  14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int16_t,  15>(), double upper = fpm::detail::realMax< int16_t,  15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i16sq15 = Sq< int16_t,  15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -8>(), double upper = fpm::detail::realMax<uint16_t,  -8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm8 = Sq<uint16_t,  -8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -7>(), double upper = fpm::detail::realMax<uint16_t,  -7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm7 = Sq<uint16_t,  -7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -6>(), double upper = fpm::detail::realMax<uint16_t,  -6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm6 = Sq<uint16_t,  -6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -5>(), double upper = fpm::detail::realMax<uint16_t,  -5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm5 = Sq<uint16_t,  -5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -4>(), double upper = fpm::detail::realMax<uint16_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm4 = Sq<uint16_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -3>(), double upper = fpm::detail::realMax<uint16_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm3 = Sq<uint16_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -2>(), double upper = fpm::detail::realMax<uint16_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm2 = Sq<uint16_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  -1>(), double upper = fpm::detail::realMax<uint16_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sqm1 = Sq<uint16_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   0>(), double upper = fpm::detail::realMax<uint16_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq0 = Sq<uint16_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   1>(), double upper = fpm::detail::realMax<uint16_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq1 = Sq<uint16_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   2>(), double upper = fpm::detail::realMax<uint16_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq2 = Sq<uint16_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   3>(), double upper = fpm::detail::realMax<uint16_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq3 = Sq<uint16_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   4>(), double upper = fpm::detail::realMax<uint16_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq4 = Sq<uint16_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   5>(), double upper = fpm::detail::realMax<uint16_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq5 = Sq<uint16_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   6>(), double upper = fpm::detail::realMax<uint16_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq6 = Sq<uint16_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   7>(), double upper = fpm::detail::realMax<uint16_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq7 = Sq<uint16_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   8>(), double upper = fpm::detail::realMax<uint16_t,   8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq8 = Sq<uint16_t,   8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,   9>(), double upper = fpm::detail::realMax<uint16_t,   9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u16sq9 = Sq<uint16_t,   9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  10>(), double upper = fpm::detail::realMax<uint16_t,  10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sq10 = Sq<uint16_t,  10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  11>(), double upper = fpm::detail::realMax<uint16_t,  11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sq11 = Sq<uint16_t,  11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  12>(), double upper = fpm::detail::realMax<uint16_t,  12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sq12 = Sq<uint16_t,  12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  13>(), double upper = fpm::detail::realMax<uint16_t,  13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sq13 = Sq<uint16_t,  13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  14>(), double upper = fpm::detail::realMax<uint16_t,  14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sq14 = Sq<uint16_t,  14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint16_t,  15>(), double upper = fpm::detail::realMax<uint16_t,  15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u16sq15 = Sq<uint16_t,  15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -16>(), double upper = fpm::detail::realMax< int32_t, -16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32sqm16 = Sq< int32_t, -16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -15>(), double upper = fpm::detail::realMax< int32_t, -15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32sqm15 = Sq< int32_t, -15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -14>(), double upper = fpm::detail::realMax< int32_t, -14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32sqm14 = Sq< int32_t, -14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -13>(), double upper = fpm::detail::realMax< int32_t, -13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32sqm13 = Sq< int32_t, -13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -12>(), double upper = fpm::detail::realMax< int32_t, -12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32sqm12 = Sq< int32_t, -12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -11>(), double upper = fpm::detail::realMax< int32_t, -11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32sqm11 = Sq< int32_t, -11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t, -10>(), double upper = fpm::detail::realMax< int32_t, -10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i32sqm10 = Sq< int32_t, -10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -9>(), double upper = fpm::detail::realMax< int32_t,  -9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm9 = Sq< int32_t,  -9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -8>(), double upper = fpm::detail::realMax< int32_t,  -8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm8 = Sq< int32_t,  -8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -7>(), double upper = fpm::detail::realMax< int32_t,  -7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm7 = Sq< int32_t,  -7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -6>(), double upper = fpm::detail::realMax< int32_t,  -6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm6 = Sq< int32_t,  -6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -5>(), double upper = fpm::detail::realMax< int32_t,  -5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm5 = Sq< int32_t,  -5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -4>(), double upper = fpm::detail::realMax< int32_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm4 = Sq< int32_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -3>(), double upper = fpm::detail::realMax< int32_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm3 = Sq< int32_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -2>(), double upper = fpm::detail::realMax< int32_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm2 = Sq< int32_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  -1>(), double upper = fpm::detail::realMax< int32_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sqm1 = Sq< int32_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   0>(), double upper = fpm::detail::realMax< int32_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq0 = Sq< int32_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   1>(), double upper = fpm::detail::realMax< int32_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq1 = Sq< int32_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   2>(), double upper = fpm::detail::realMax< int32_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq2 = Sq< int32_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   3>(), double upper = fpm::detail::realMax< int32_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq3 = Sq< int32_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   4>(), double upper = fpm::detail::realMax< int32_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq4 = Sq< int32_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   5>(), double upper = fpm::detail::realMax< int32_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq5 = Sq< int32_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   6>(), double upper = fpm::detail::realMax< int32_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq6 = Sq< int32_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   7>(), double upper = fpm::detail::realMax< int32_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq7 = Sq< int32_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   8>(), double upper = fpm::detail::realMax< int32_t,   8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq8 = Sq< int32_t,   8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,   9>(), double upper = fpm::detail::realMax< int32_t,   9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i32sq9 = Sq< int32_t,   9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  10>(), double upper = fpm::detail::realMax< int32_t,  10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq10 = Sq< int32_t,  10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  11>(), double upper = fpm::detail::realMax< int32_t,  11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq11 = Sq< int32_t,  11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  12>(), double upper = fpm::detail::realMax< int32_t,  12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq12 = Sq< int32_t,  12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  13>(), double upper = fpm::detail::realMax< int32_t,  13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq13 = Sq< int32_t,  13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  14>(), double upper = fpm::detail::realMax< int32_t,  14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq14 = Sq< int32_t,  14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  15>(), double upper = fpm::detail::realMax< int32_t,  15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq15 = Sq< int32_t,  15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  16>(), double upper = fpm::detail::realMax< int32_t,  16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq16 = Sq< int32_t,  16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  17>(), double upper = fpm::detail::realMax< int32_t,  17>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq17 = Sq< int32_t,  17, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  18>(), double upper = fpm::detail::realMax< int32_t,  18>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq18 = Sq< int32_t,  18, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  19>(), double upper = fpm::detail::realMax< int32_t,  19>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq19 = Sq< int32_t,  19, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  20>(), double upper = fpm::detail::realMax< int32_t,  20>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq20 = Sq< int32_t,  20, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  21>(), double upper = fpm::detail::realMax< int32_t,  21>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq21 = Sq< int32_t,  21, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  22>(), double upper = fpm::detail::realMax< int32_t,  22>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq22 = Sq< int32_t,  22, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  23>(), double upper = fpm::detail::realMax< int32_t,  23>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq23 = Sq< int32_t,  23, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  24>(), double upper = fpm::detail::realMax< int32_t,  24>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq24 = Sq< int32_t,  24, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  25>(), double upper = fpm::detail::realMax< int32_t,  25>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq25 = Sq< int32_t,  25, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  26>(), double upper = fpm::detail::realMax< int32_t,  26>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq26 = Sq< int32_t,  26, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  27>(), double upper = fpm::detail::realMax< int32_t,  27>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq27 = Sq< int32_t,  27, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  28>(), double upper = fpm::detail::realMax< int32_t,  28>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq28 = Sq< int32_t,  28, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  29>(), double upper = fpm::detail::realMax< int32_t,  29>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq29 = Sq< int32_t,  29, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  30>(), double upper = fpm::detail::realMax< int32_t,  30>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq30 = Sq< int32_t,  30, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int32_t,  31>(), double upper = fpm::detail::realMax< int32_t,  31>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i32sq31 = Sq< int32_t,  31, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -16>(), double upper = fpm::detail::realMax<uint32_t, -16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32sqm16 = Sq<uint32_t, -16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -15>(), double upper = fpm::detail::realMax<uint32_t, -15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32sqm15 = Sq<uint32_t, -15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -14>(), double upper = fpm::detail::realMax<uint32_t, -14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32sqm14 = Sq<uint32_t, -14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -13>(), double upper = fpm::detail::realMax<uint32_t, -13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32sqm13 = Sq<uint32_t, -13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -12>(), double upper = fpm::detail::realMax<uint32_t, -12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32sqm12 = Sq<uint32_t, -12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -11>(), double upper = fpm::detail::realMax<uint32_t, -11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32sqm11 = Sq<uint32_t, -11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t, -10>(), double upper = fpm::detail::realMax<uint32_t, -10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u32sqm10 = Sq<uint32_t, -10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -9>(), double upper = fpm::detail::realMax<uint32_t,  -9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm9 = Sq<uint32_t,  -9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -8>(), double upper = fpm::detail::realMax<uint32_t,  -8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm8 = Sq<uint32_t,  -8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -7>(), double upper = fpm::detail::realMax<uint32_t,  -7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm7 = Sq<uint32_t,  -7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -6>(), double upper = fpm::detail::realMax<uint32_t,  -6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm6 = Sq<uint32_t,  -6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -5>(), double upper = fpm::detail::realMax<uint32_t,  -5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm5 = Sq<uint32_t,  -5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -4>(), double upper = fpm::detail::realMax<uint32_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm4 = Sq<uint32_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -3>(), double upper = fpm::detail::realMax<uint32_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm3 = Sq<uint32_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -2>(), double upper = fpm::detail::realMax<uint32_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm2 = Sq<uint32_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  -1>(), double upper = fpm::detail::realMax<uint32_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sqm1 = Sq<uint32_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   0>(), double upper = fpm::detail::realMax<uint32_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq0 = Sq<uint32_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   1>(), double upper = fpm::detail::realMax<uint32_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq1 = Sq<uint32_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   2>(), double upper = fpm::detail::realMax<uint32_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq2 = Sq<uint32_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   3>(), double upper = fpm::detail::realMax<uint32_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq3 = Sq<uint32_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   4>(), double upper = fpm::detail::realMax<uint32_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq4 = Sq<uint32_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   5>(), double upper = fpm::detail::realMax<uint32_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq5 = Sq<uint32_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   6>(), double upper = fpm::detail::realMax<uint32_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq6 = Sq<uint32_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   7>(), double upper = fpm::detail::realMax<uint32_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq7 = Sq<uint32_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   8>(), double upper = fpm::detail::realMax<uint32_t,   8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq8 = Sq<uint32_t,   8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,   9>(), double upper = fpm::detail::realMax<uint32_t,   9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u32sq9 = Sq<uint32_t,   9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  10>(), double upper = fpm::detail::realMax<uint32_t,  10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq10 = Sq<uint32_t,  10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  11>(), double upper = fpm::detail::realMax<uint32_t,  11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq11 = Sq<uint32_t,  11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  12>(), double upper = fpm::detail::realMax<uint32_t,  12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq12 = Sq<uint32_t,  12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  13>(), double upper = fpm::detail::realMax<uint32_t,  13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq13 = Sq<uint32_t,  13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  14>(), double upper = fpm::detail::realMax<uint32_t,  14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq14 = Sq<uint32_t,  14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  15>(), double upper = fpm::detail::realMax<uint32_t,  15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq15 = Sq<uint32_t,  15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  16>(), double upper = fpm::detail::realMax<uint32_t,  16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq16 = Sq<uint32_t,  16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  17>(), double upper = fpm::detail::realMax<uint32_t,  17>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq17 = Sq<uint32_t,  17, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  18>(), double upper = fpm::detail::realMax<uint32_t,  18>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq18 = Sq<uint32_t,  18, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  19>(), double upper = fpm::detail::realMax<uint32_t,  19>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq19 = Sq<uint32_t,  19, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  20>(), double upper = fpm::detail::realMax<uint32_t,  20>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq20 = Sq<uint32_t,  20, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  21>(), double upper = fpm::detail::realMax<uint32_t,  21>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq21 = Sq<uint32_t,  21, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  22>(), double upper = fpm::detail::realMax<uint32_t,  22>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq22 = Sq<uint32_t,  22, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  23>(), double upper = fpm::detail::realMax<uint32_t,  23>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq23 = Sq<uint32_t,  23, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  24>(), double upper = fpm::detail::realMax<uint32_t,  24>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq24 = Sq<uint32_t,  24, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  25>(), double upper = fpm::detail::realMax<uint32_t,  25>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq25 = Sq<uint32_t,  25, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  26>(), double upper = fpm::detail::realMax<uint32_t,  26>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq26 = Sq<uint32_t,  26, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  27>(), double upper = fpm::detail::realMax<uint32_t,  27>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq27 = Sq<uint32_t,  27, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  28>(), double upper = fpm::detail::realMax<uint32_t,  28>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq28 = Sq<uint32_t,  28, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  29>(), double upper = fpm::detail::realMax<uint32_t,  29>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq29 = Sq<uint32_t,  29, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  30>(), double upper = fpm::detail::realMax<uint32_t,  30>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq30 = Sq<uint32_t,  30, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint32_t,  31>(), double upper = fpm::detail::realMax<uint32_t,  31>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u32sq31 = Sq<uint32_t,  31, lower, upper, rnd>;
+
+#if defined __SIZEOF_INT128__  // 64-bit types need 128-bit intermediate types
+template< double lower = fpm::detail::realMin< int64_t, -32>(), double upper = fpm::detail::realMax< int64_t, -32>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm32 = Sq< int64_t, -32, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -31>(), double upper = fpm::detail::realMax< int64_t, -31>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm31 = Sq< int64_t, -31, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -30>(), double upper = fpm::detail::realMax< int64_t, -30>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm30 = Sq< int64_t, -30, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -29>(), double upper = fpm::detail::realMax< int64_t, -29>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm29 = Sq< int64_t, -29, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -28>(), double upper = fpm::detail::realMax< int64_t, -28>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm28 = Sq< int64_t, -28, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -27>(), double upper = fpm::detail::realMax< int64_t, -27>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm27 = Sq< int64_t, -27, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -26>(), double upper = fpm::detail::realMax< int64_t, -26>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm26 = Sq< int64_t, -26, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -25>(), double upper = fpm::detail::realMax< int64_t, -25>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm25 = Sq< int64_t, -25, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -24>(), double upper = fpm::detail::realMax< int64_t, -24>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm24 = Sq< int64_t, -24, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -23>(), double upper = fpm::detail::realMax< int64_t, -23>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm23 = Sq< int64_t, -23, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -22>(), double upper = fpm::detail::realMax< int64_t, -22>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm22 = Sq< int64_t, -22, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -21>(), double upper = fpm::detail::realMax< int64_t, -21>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm21 = Sq< int64_t, -21, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -20>(), double upper = fpm::detail::realMax< int64_t, -20>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm20 = Sq< int64_t, -20, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -19>(), double upper = fpm::detail::realMax< int64_t, -19>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm19 = Sq< int64_t, -19, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -18>(), double upper = fpm::detail::realMax< int64_t, -18>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm18 = Sq< int64_t, -18, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -17>(), double upper = fpm::detail::realMax< int64_t, -17>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm17 = Sq< int64_t, -17, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -16>(), double upper = fpm::detail::realMax< int64_t, -16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm16 = Sq< int64_t, -16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -15>(), double upper = fpm::detail::realMax< int64_t, -15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm15 = Sq< int64_t, -15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -14>(), double upper = fpm::detail::realMax< int64_t, -14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm14 = Sq< int64_t, -14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -13>(), double upper = fpm::detail::realMax< int64_t, -13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm13 = Sq< int64_t, -13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -12>(), double upper = fpm::detail::realMax< int64_t, -12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm12 = Sq< int64_t, -12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -11>(), double upper = fpm::detail::realMax< int64_t, -11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm11 = Sq< int64_t, -11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t, -10>(), double upper = fpm::detail::realMax< int64_t, -10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using i64sqm10 = Sq< int64_t, -10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -9>(), double upper = fpm::detail::realMax< int64_t,  -9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm9 = Sq< int64_t,  -9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -8>(), double upper = fpm::detail::realMax< int64_t,  -8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm8 = Sq< int64_t,  -8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -7>(), double upper = fpm::detail::realMax< int64_t,  -7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm7 = Sq< int64_t,  -7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -6>(), double upper = fpm::detail::realMax< int64_t,  -6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm6 = Sq< int64_t,  -6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -5>(), double upper = fpm::detail::realMax< int64_t,  -5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm5 = Sq< int64_t,  -5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -4>(), double upper = fpm::detail::realMax< int64_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm4 = Sq< int64_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -3>(), double upper = fpm::detail::realMax< int64_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm3 = Sq< int64_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -2>(), double upper = fpm::detail::realMax< int64_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm2 = Sq< int64_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  -1>(), double upper = fpm::detail::realMax< int64_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sqm1 = Sq< int64_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   0>(), double upper = fpm::detail::realMax< int64_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq0 = Sq< int64_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   1>(), double upper = fpm::detail::realMax< int64_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq1 = Sq< int64_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   2>(), double upper = fpm::detail::realMax< int64_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq2 = Sq< int64_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   3>(), double upper = fpm::detail::realMax< int64_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq3 = Sq< int64_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   4>(), double upper = fpm::detail::realMax< int64_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq4 = Sq< int64_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   5>(), double upper = fpm::detail::realMax< int64_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq5 = Sq< int64_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   6>(), double upper = fpm::detail::realMax< int64_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq6 = Sq< int64_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   7>(), double upper = fpm::detail::realMax< int64_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq7 = Sq< int64_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   8>(), double upper = fpm::detail::realMax< int64_t,   8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq8 = Sq< int64_t,   8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,   9>(), double upper = fpm::detail::realMax< int64_t,   9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   i64sq9 = Sq< int64_t,   9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  10>(), double upper = fpm::detail::realMax< int64_t,  10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq10 = Sq< int64_t,  10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  11>(), double upper = fpm::detail::realMax< int64_t,  11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq11 = Sq< int64_t,  11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  12>(), double upper = fpm::detail::realMax< int64_t,  12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq12 = Sq< int64_t,  12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  13>(), double upper = fpm::detail::realMax< int64_t,  13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq13 = Sq< int64_t,  13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  14>(), double upper = fpm::detail::realMax< int64_t,  14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq14 = Sq< int64_t,  14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  15>(), double upper = fpm::detail::realMax< int64_t,  15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq15 = Sq< int64_t,  15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  16>(), double upper = fpm::detail::realMax< int64_t,  16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq16 = Sq< int64_t,  16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  17>(), double upper = fpm::detail::realMax< int64_t,  17>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq17 = Sq< int64_t,  17, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  18>(), double upper = fpm::detail::realMax< int64_t,  18>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq18 = Sq< int64_t,  18, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  19>(), double upper = fpm::detail::realMax< int64_t,  19>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq19 = Sq< int64_t,  19, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  20>(), double upper = fpm::detail::realMax< int64_t,  20>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq20 = Sq< int64_t,  20, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  21>(), double upper = fpm::detail::realMax< int64_t,  21>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq21 = Sq< int64_t,  21, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  22>(), double upper = fpm::detail::realMax< int64_t,  22>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq22 = Sq< int64_t,  22, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  23>(), double upper = fpm::detail::realMax< int64_t,  23>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq23 = Sq< int64_t,  23, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  24>(), double upper = fpm::detail::realMax< int64_t,  24>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq24 = Sq< int64_t,  24, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  25>(), double upper = fpm::detail::realMax< int64_t,  25>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq25 = Sq< int64_t,  25, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  26>(), double upper = fpm::detail::realMax< int64_t,  26>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq26 = Sq< int64_t,  26, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  27>(), double upper = fpm::detail::realMax< int64_t,  27>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq27 = Sq< int64_t,  27, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  28>(), double upper = fpm::detail::realMax< int64_t,  28>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq28 = Sq< int64_t,  28, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  29>(), double upper = fpm::detail::realMax< int64_t,  29>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq29 = Sq< int64_t,  29, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  30>(), double upper = fpm::detail::realMax< int64_t,  30>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq30 = Sq< int64_t,  30, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  31>(), double upper = fpm::detail::realMax< int64_t,  31>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq31 = Sq< int64_t,  31, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  32>(), double upper = fpm::detail::realMax< int64_t,  32>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq32 = Sq< int64_t,  32, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  33>(), double upper = fpm::detail::realMax< int64_t,  33>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq33 = Sq< int64_t,  33, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  34>(), double upper = fpm::detail::realMax< int64_t,  34>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq34 = Sq< int64_t,  34, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  35>(), double upper = fpm::detail::realMax< int64_t,  35>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq35 = Sq< int64_t,  35, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  36>(), double upper = fpm::detail::realMax< int64_t,  36>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq36 = Sq< int64_t,  36, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  37>(), double upper = fpm::detail::realMax< int64_t,  37>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq37 = Sq< int64_t,  37, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  38>(), double upper = fpm::detail::realMax< int64_t,  38>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq38 = Sq< int64_t,  38, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  39>(), double upper = fpm::detail::realMax< int64_t,  39>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq39 = Sq< int64_t,  39, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  40>(), double upper = fpm::detail::realMax< int64_t,  40>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq40 = Sq< int64_t,  40, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  41>(), double upper = fpm::detail::realMax< int64_t,  41>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq41 = Sq< int64_t,  41, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  42>(), double upper = fpm::detail::realMax< int64_t,  42>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq42 = Sq< int64_t,  42, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  43>(), double upper = fpm::detail::realMax< int64_t,  43>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq43 = Sq< int64_t,  43, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  44>(), double upper = fpm::detail::realMax< int64_t,  44>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq44 = Sq< int64_t,  44, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  45>(), double upper = fpm::detail::realMax< int64_t,  45>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq45 = Sq< int64_t,  45, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  46>(), double upper = fpm::detail::realMax< int64_t,  46>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq46 = Sq< int64_t,  46, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  47>(), double upper = fpm::detail::realMax< int64_t,  47>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq47 = Sq< int64_t,  47, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  48>(), double upper = fpm::detail::realMax< int64_t,  48>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq48 = Sq< int64_t,  48, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  49>(), double upper = fpm::detail::realMax< int64_t,  49>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq49 = Sq< int64_t,  49, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  50>(), double upper = fpm::detail::realMax< int64_t,  50>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq50 = Sq< int64_t,  50, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  51>(), double upper = fpm::detail::realMax< int64_t,  51>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq51 = Sq< int64_t,  51, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  52>(), double upper = fpm::detail::realMax< int64_t,  52>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq52 = Sq< int64_t,  52, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin< int64_t,  53>(), double upper = fpm::detail::realMax< int64_t,  53>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  i64sq53 = Sq< int64_t,  53, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -32>(), double upper = fpm::detail::realMax<uint64_t, -32>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm32 = Sq<uint64_t, -32, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -31>(), double upper = fpm::detail::realMax<uint64_t, -31>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm31 = Sq<uint64_t, -31, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -30>(), double upper = fpm::detail::realMax<uint64_t, -30>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm30 = Sq<uint64_t, -30, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -29>(), double upper = fpm::detail::realMax<uint64_t, -29>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm29 = Sq<uint64_t, -29, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -28>(), double upper = fpm::detail::realMax<uint64_t, -28>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm28 = Sq<uint64_t, -28, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -27>(), double upper = fpm::detail::realMax<uint64_t, -27>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm27 = Sq<uint64_t, -27, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -26>(), double upper = fpm::detail::realMax<uint64_t, -26>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm26 = Sq<uint64_t, -26, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -25>(), double upper = fpm::detail::realMax<uint64_t, -25>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm25 = Sq<uint64_t, -25, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -24>(), double upper = fpm::detail::realMax<uint64_t, -24>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm24 = Sq<uint64_t, -24, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -23>(), double upper = fpm::detail::realMax<uint64_t, -23>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm23 = Sq<uint64_t, -23, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -22>(), double upper = fpm::detail::realMax<uint64_t, -22>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm22 = Sq<uint64_t, -22, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -21>(), double upper = fpm::detail::realMax<uint64_t, -21>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm21 = Sq<uint64_t, -21, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -20>(), double upper = fpm::detail::realMax<uint64_t, -20>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm20 = Sq<uint64_t, -20, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -19>(), double upper = fpm::detail::realMax<uint64_t, -19>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm19 = Sq<uint64_t, -19, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -18>(), double upper = fpm::detail::realMax<uint64_t, -18>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm18 = Sq<uint64_t, -18, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -17>(), double upper = fpm::detail::realMax<uint64_t, -17>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm17 = Sq<uint64_t, -17, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -16>(), double upper = fpm::detail::realMax<uint64_t, -16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm16 = Sq<uint64_t, -16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -15>(), double upper = fpm::detail::realMax<uint64_t, -15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm15 = Sq<uint64_t, -15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -14>(), double upper = fpm::detail::realMax<uint64_t, -14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm14 = Sq<uint64_t, -14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -13>(), double upper = fpm::detail::realMax<uint64_t, -13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm13 = Sq<uint64_t, -13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -12>(), double upper = fpm::detail::realMax<uint64_t, -12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm12 = Sq<uint64_t, -12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -11>(), double upper = fpm::detail::realMax<uint64_t, -11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm11 = Sq<uint64_t, -11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t, -10>(), double upper = fpm::detail::realMax<uint64_t, -10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using u64sqm10 = Sq<uint64_t, -10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -9>(), double upper = fpm::detail::realMax<uint64_t,  -9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm9 = Sq<uint64_t,  -9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -8>(), double upper = fpm::detail::realMax<uint64_t,  -8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm8 = Sq<uint64_t,  -8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -7>(), double upper = fpm::detail::realMax<uint64_t,  -7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm7 = Sq<uint64_t,  -7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -6>(), double upper = fpm::detail::realMax<uint64_t,  -6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm6 = Sq<uint64_t,  -6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -5>(), double upper = fpm::detail::realMax<uint64_t,  -5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm5 = Sq<uint64_t,  -5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -4>(), double upper = fpm::detail::realMax<uint64_t,  -4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm4 = Sq<uint64_t,  -4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -3>(), double upper = fpm::detail::realMax<uint64_t,  -3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm3 = Sq<uint64_t,  -3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -2>(), double upper = fpm::detail::realMax<uint64_t,  -2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm2 = Sq<uint64_t,  -2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  -1>(), double upper = fpm::detail::realMax<uint64_t,  -1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sqm1 = Sq<uint64_t,  -1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   0>(), double upper = fpm::detail::realMax<uint64_t,   0>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq0 = Sq<uint64_t,   0, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   1>(), double upper = fpm::detail::realMax<uint64_t,   1>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq1 = Sq<uint64_t,   1, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   2>(), double upper = fpm::detail::realMax<uint64_t,   2>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq2 = Sq<uint64_t,   2, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   3>(), double upper = fpm::detail::realMax<uint64_t,   3>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq3 = Sq<uint64_t,   3, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   4>(), double upper = fpm::detail::realMax<uint64_t,   4>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq4 = Sq<uint64_t,   4, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   5>(), double upper = fpm::detail::realMax<uint64_t,   5>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq5 = Sq<uint64_t,   5, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   6>(), double upper = fpm::detail::realMax<uint64_t,   6>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq6 = Sq<uint64_t,   6, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   7>(), double upper = fpm::detail::realMax<uint64_t,   7>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq7 = Sq<uint64_t,   7, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   8>(), double upper = fpm::detail::realMax<uint64_t,   8>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq8 = Sq<uint64_t,   8, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,   9>(), double upper = fpm::detail::realMax<uint64_t,   9>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using   u64sq9 = Sq<uint64_t,   9, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  10>(), double upper = fpm::detail::realMax<uint64_t,  10>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq10 = Sq<uint64_t,  10, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  11>(), double upper = fpm::detail::realMax<uint64_t,  11>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq11 = Sq<uint64_t,  11, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  12>(), double upper = fpm::detail::realMax<uint64_t,  12>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq12 = Sq<uint64_t,  12, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  13>(), double upper = fpm::detail::realMax<uint64_t,  13>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq13 = Sq<uint64_t,  13, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  14>(), double upper = fpm::detail::realMax<uint64_t,  14>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq14 = Sq<uint64_t,  14, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  15>(), double upper = fpm::detail::realMax<uint64_t,  15>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq15 = Sq<uint64_t,  15, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  16>(), double upper = fpm::detail::realMax<uint64_t,  16>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq16 = Sq<uint64_t,  16, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  17>(), double upper = fpm::detail::realMax<uint64_t,  17>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq17 = Sq<uint64_t,  17, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  18>(), double upper = fpm::detail::realMax<uint64_t,  18>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq18 = Sq<uint64_t,  18, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  19>(), double upper = fpm::detail::realMax<uint64_t,  19>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq19 = Sq<uint64_t,  19, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  20>(), double upper = fpm::detail::realMax<uint64_t,  20>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq20 = Sq<uint64_t,  20, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  21>(), double upper = fpm::detail::realMax<uint64_t,  21>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq21 = Sq<uint64_t,  21, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  22>(), double upper = fpm::detail::realMax<uint64_t,  22>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq22 = Sq<uint64_t,  22, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  23>(), double upper = fpm::detail::realMax<uint64_t,  23>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq23 = Sq<uint64_t,  23, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  24>(), double upper = fpm::detail::realMax<uint64_t,  24>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq24 = Sq<uint64_t,  24, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  25>(), double upper = fpm::detail::realMax<uint64_t,  25>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq25 = Sq<uint64_t,  25, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  26>(), double upper = fpm::detail::realMax<uint64_t,  26>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq26 = Sq<uint64_t,  26, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  27>(), double upper = fpm::detail::realMax<uint64_t,  27>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq27 = Sq<uint64_t,  27, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  28>(), double upper = fpm::detail::realMax<uint64_t,  28>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq28 = Sq<uint64_t,  28, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  29>(), double upper = fpm::detail::realMax<uint64_t,  29>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq29 = Sq<uint64_t,  29, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  30>(), double upper = fpm::detail::realMax<uint64_t,  30>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq30 = Sq<uint64_t,  30, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  31>(), double upper = fpm::detail::realMax<uint64_t,  31>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq31 = Sq<uint64_t,  31, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  32>(), double upper = fpm::detail::realMax<uint64_t,  32>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq32 = Sq<uint64_t,  32, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  33>(), double upper = fpm::detail::realMax<uint64_t,  33>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq33 = Sq<uint64_t,  33, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  34>(), double upper = fpm::detail::realMax<uint64_t,  34>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq34 = Sq<uint64_t,  34, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  35>(), double upper = fpm::detail::realMax<uint64_t,  35>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq35 = Sq<uint64_t,  35, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  36>(), double upper = fpm::detail::realMax<uint64_t,  36>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq36 = Sq<uint64_t,  36, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  37>(), double upper = fpm::detail::realMax<uint64_t,  37>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq37 = Sq<uint64_t,  37, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  38>(), double upper = fpm::detail::realMax<uint64_t,  38>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq38 = Sq<uint64_t,  38, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  39>(), double upper = fpm::detail::realMax<uint64_t,  39>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq39 = Sq<uint64_t,  39, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  40>(), double upper = fpm::detail::realMax<uint64_t,  40>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq40 = Sq<uint64_t,  40, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  41>(), double upper = fpm::detail::realMax<uint64_t,  41>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq41 = Sq<uint64_t,  41, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  42>(), double upper = fpm::detail::realMax<uint64_t,  42>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq42 = Sq<uint64_t,  42, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  43>(), double upper = fpm::detail::realMax<uint64_t,  43>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq43 = Sq<uint64_t,  43, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  44>(), double upper = fpm::detail::realMax<uint64_t,  44>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq44 = Sq<uint64_t,  44, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  45>(), double upper = fpm::detail::realMax<uint64_t,  45>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq45 = Sq<uint64_t,  45, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  46>(), double upper = fpm::detail::realMax<uint64_t,  46>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq46 = Sq<uint64_t,  46, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  47>(), double upper = fpm::detail::realMax<uint64_t,  47>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq47 = Sq<uint64_t,  47, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  48>(), double upper = fpm::detail::realMax<uint64_t,  48>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq48 = Sq<uint64_t,  48, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  49>(), double upper = fpm::detail::realMax<uint64_t,  49>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq49 = Sq<uint64_t,  49, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  50>(), double upper = fpm::detail::realMax<uint64_t,  50>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq50 = Sq<uint64_t,  50, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  51>(), double upper = fpm::detail::realMax<uint64_t,  51>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq51 = Sq<uint64_t,  51, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  52>(), double upper = fpm::detail::realMax<uint64_t,  52>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq52 = Sq<uint64_t,  52, lower, upper, rnd>;
+template< double lower = fpm::detail::realMin<uint64_t,  53>(), double upper = fpm::detail::realMax<uint64_t,  53>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using  u64sq53 = Sq<uint64_t,  53, lower, upper, rnd>;
+#endif
 
 /* literal operators */
 
@@ -366,6 +541,181 @@ FPM_SQ_BIND_LITERAL( u32sq29<>, u32sq29 )
 FPM_SQ_BIND_LITERAL( u32sq30<>, u32sq30 )
 FPM_SQ_BIND_LITERAL( u32sq31<>, u32sq31 )
 
+#if defined __SIZEOF_INT128__
+FPM_SQ_BIND_LITERAL(i64sqm32<>, i64sqm32)
+FPM_SQ_BIND_LITERAL(i64sqm31<>, i64sqm31)
+FPM_SQ_BIND_LITERAL(i64sqm30<>, i64sqm30)
+FPM_SQ_BIND_LITERAL(i64sqm29<>, i64sqm29)
+FPM_SQ_BIND_LITERAL(i64sqm28<>, i64sqm28)
+FPM_SQ_BIND_LITERAL(i64sqm27<>, i64sqm27)
+FPM_SQ_BIND_LITERAL(i64sqm26<>, i64sqm26)
+FPM_SQ_BIND_LITERAL(i64sqm25<>, i64sqm25)
+FPM_SQ_BIND_LITERAL(i64sqm24<>, i64sqm24)
+FPM_SQ_BIND_LITERAL(i64sqm23<>, i64sqm23)
+FPM_SQ_BIND_LITERAL(i64sqm22<>, i64sqm22)
+FPM_SQ_BIND_LITERAL(i64sqm21<>, i64sqm21)
+FPM_SQ_BIND_LITERAL(i64sqm20<>, i64sqm20)
+FPM_SQ_BIND_LITERAL(i64sqm19<>, i64sqm19)
+FPM_SQ_BIND_LITERAL(i64sqm18<>, i64sqm18)
+FPM_SQ_BIND_LITERAL(i64sqm17<>, i64sqm17)
+FPM_SQ_BIND_LITERAL(i64sqm16<>, i64sqm16)
+FPM_SQ_BIND_LITERAL(i64sqm15<>, i64sqm15)
+FPM_SQ_BIND_LITERAL(i64sqm14<>, i64sqm14)
+FPM_SQ_BIND_LITERAL(i64sqm13<>, i64sqm13)
+FPM_SQ_BIND_LITERAL(i64sqm12<>, i64sqm12)
+FPM_SQ_BIND_LITERAL(i64sqm11<>, i64sqm11)
+FPM_SQ_BIND_LITERAL(i64sqm10<>, i64sqm10)
+FPM_SQ_BIND_LITERAL( i64sqm9<>, i64sqm9 )
+FPM_SQ_BIND_LITERAL( i64sqm8<>, i64sqm8 )
+FPM_SQ_BIND_LITERAL( i64sqm7<>, i64sqm7 )
+FPM_SQ_BIND_LITERAL( i64sqm6<>, i64sqm6 )
+FPM_SQ_BIND_LITERAL( i64sqm5<>, i64sqm5 )
+FPM_SQ_BIND_LITERAL( i64sqm4<>, i64sqm4 )
+FPM_SQ_BIND_LITERAL( i64sqm3<>, i64sqm3 )
+FPM_SQ_BIND_LITERAL( i64sqm2<>, i64sqm2 )
+FPM_SQ_BIND_LITERAL( i64sqm1<>, i64sqm1 )
+FPM_SQ_BIND_LITERAL(  i64sq0<>, i64sq0  )
+FPM_SQ_BIND_LITERAL(  i64sq1<>, i64sq1  )
+FPM_SQ_BIND_LITERAL(  i64sq2<>, i64sq2  )
+FPM_SQ_BIND_LITERAL(  i64sq3<>, i64sq3  )
+FPM_SQ_BIND_LITERAL(  i64sq4<>, i64sq4  )
+FPM_SQ_BIND_LITERAL(  i64sq5<>, i64sq5  )
+FPM_SQ_BIND_LITERAL(  i64sq6<>, i64sq6  )
+FPM_SQ_BIND_LITERAL(  i64sq7<>, i64sq7  )
+FPM_SQ_BIND_LITERAL(  i64sq8<>, i64sq8  )
+FPM_SQ_BIND_LITERAL(  i64sq9<>, i64sq9  )
+FPM_SQ_BIND_LITERAL( i64sq10<>, i64sq10 )
+FPM_SQ_BIND_LITERAL( i64sq11<>, i64sq11 )
+FPM_SQ_BIND_LITERAL( i64sq12<>, i64sq12 )
+FPM_SQ_BIND_LITERAL( i64sq13<>, i64sq13 )
+FPM_SQ_BIND_LITERAL( i64sq14<>, i64sq14 )
+FPM_SQ_BIND_LITERAL( i64sq15<>, i64sq15 )
+FPM_SQ_BIND_LITERAL( i64sq16<>, i64sq16 )
+FPM_SQ_BIND_LITERAL( i64sq17<>, i64sq17 )
+FPM_SQ_BIND_LITERAL( i64sq18<>, i64sq18 )
+FPM_SQ_BIND_LITERAL( i64sq19<>, i64sq19 )
+FPM_SQ_BIND_LITERAL( i64sq20<>, i64sq20 )
+FPM_SQ_BIND_LITERAL( i64sq21<>, i64sq21 )
+FPM_SQ_BIND_LITERAL( i64sq22<>, i64sq22 )
+FPM_SQ_BIND_LITERAL( i64sq23<>, i64sq23 )
+FPM_SQ_BIND_LITERAL( i64sq24<>, i64sq24 )
+FPM_SQ_BIND_LITERAL( i64sq25<>, i64sq25 )
+FPM_SQ_BIND_LITERAL( i64sq26<>, i64sq26 )
+FPM_SQ_BIND_LITERAL( i64sq27<>, i64sq27 )
+FPM_SQ_BIND_LITERAL( i64sq28<>, i64sq28 )
+FPM_SQ_BIND_LITERAL( i64sq29<>, i64sq29 )
+FPM_SQ_BIND_LITERAL( i64sq30<>, i64sq30 )
+FPM_SQ_BIND_LITERAL( i64sq31<>, i64sq31 )
+FPM_SQ_BIND_LITERAL( i64sq32<>, i64sq32 )
+FPM_SQ_BIND_LITERAL( i64sq33<>, i64sq33 )
+FPM_SQ_BIND_LITERAL( i64sq34<>, i64sq34 )
+FPM_SQ_BIND_LITERAL( i64sq35<>, i64sq35 )
+FPM_SQ_BIND_LITERAL( i64sq36<>, i64sq36 )
+FPM_SQ_BIND_LITERAL( i64sq37<>, i64sq37 )
+FPM_SQ_BIND_LITERAL( i64sq38<>, i64sq38 )
+FPM_SQ_BIND_LITERAL( i64sq39<>, i64sq39 )
+FPM_SQ_BIND_LITERAL( i64sq40<>, i64sq40 )
+FPM_SQ_BIND_LITERAL( i64sq41<>, i64sq41 )
+FPM_SQ_BIND_LITERAL( i64sq42<>, i64sq42 )
+FPM_SQ_BIND_LITERAL( i64sq43<>, i64sq43 )
+FPM_SQ_BIND_LITERAL( i64sq44<>, i64sq44 )
+FPM_SQ_BIND_LITERAL( i64sq45<>, i64sq45 )
+FPM_SQ_BIND_LITERAL( i64sq46<>, i64sq46 )
+FPM_SQ_BIND_LITERAL( i64sq47<>, i64sq47 )
+FPM_SQ_BIND_LITERAL( i64sq48<>, i64sq48 )
+FPM_SQ_BIND_LITERAL( i64sq49<>, i64sq49 )
+FPM_SQ_BIND_LITERAL( i64sq50<>, i64sq50 )
+FPM_SQ_BIND_LITERAL( i64sq51<>, i64sq51 )
+FPM_SQ_BIND_LITERAL( i64sq52<>, i64sq52 )
+FPM_SQ_BIND_LITERAL( i64sq53<>, i64sq53 )
+FPM_SQ_BIND_LITERAL(u64sqm32<>, u64sqm32)
+FPM_SQ_BIND_LITERAL(u64sqm31<>, u64sqm31)
+FPM_SQ_BIND_LITERAL(u64sqm30<>, u64sqm30)
+FPM_SQ_BIND_LITERAL(u64sqm29<>, u64sqm29)
+FPM_SQ_BIND_LITERAL(u64sqm28<>, u64sqm28)
+FPM_SQ_BIND_LITERAL(u64sqm27<>, u64sqm27)
+FPM_SQ_BIND_LITERAL(u64sqm26<>, u64sqm26)
+FPM_SQ_BIND_LITERAL(u64sqm25<>, u64sqm25)
+FPM_SQ_BIND_LITERAL(u64sqm24<>, u64sqm24)
+FPM_SQ_BIND_LITERAL(u64sqm23<>, u64sqm23)
+FPM_SQ_BIND_LITERAL(u64sqm22<>, u64sqm22)
+FPM_SQ_BIND_LITERAL(u64sqm21<>, u64sqm21)
+FPM_SQ_BIND_LITERAL(u64sqm20<>, u64sqm20)
+FPM_SQ_BIND_LITERAL(u64sqm19<>, u64sqm19)
+FPM_SQ_BIND_LITERAL(u64sqm18<>, u64sqm18)
+FPM_SQ_BIND_LITERAL(u64sqm17<>, u64sqm17)
+FPM_SQ_BIND_LITERAL(u64sqm16<>, u64sqm16)
+FPM_SQ_BIND_LITERAL(u64sqm15<>, u64sqm15)
+FPM_SQ_BIND_LITERAL(u64sqm14<>, u64sqm14)
+FPM_SQ_BIND_LITERAL(u64sqm13<>, u64sqm13)
+FPM_SQ_BIND_LITERAL(u64sqm12<>, u64sqm12)
+FPM_SQ_BIND_LITERAL(u64sqm11<>, u64sqm11)
+FPM_SQ_BIND_LITERAL(u64sqm10<>, u64sqm10)
+FPM_SQ_BIND_LITERAL( u64sqm9<>, u64sqm9 )
+FPM_SQ_BIND_LITERAL( u64sqm8<>, u64sqm8 )
+FPM_SQ_BIND_LITERAL( u64sqm7<>, u64sqm7 )
+FPM_SQ_BIND_LITERAL( u64sqm6<>, u64sqm6 )
+FPM_SQ_BIND_LITERAL( u64sqm5<>, u64sqm5 )
+FPM_SQ_BIND_LITERAL( u64sqm4<>, u64sqm4 )
+FPM_SQ_BIND_LITERAL( u64sqm3<>, u64sqm3 )
+FPM_SQ_BIND_LITERAL( u64sqm2<>, u64sqm2 )
+FPM_SQ_BIND_LITERAL( u64sqm1<>, u64sqm1 )
+FPM_SQ_BIND_LITERAL(  u64sq0<>, u64sq0  )
+FPM_SQ_BIND_LITERAL(  u64sq1<>, u64sq1  )
+FPM_SQ_BIND_LITERAL(  u64sq2<>, u64sq2  )
+FPM_SQ_BIND_LITERAL(  u64sq3<>, u64sq3  )
+FPM_SQ_BIND_LITERAL(  u64sq4<>, u64sq4  )
+FPM_SQ_BIND_LITERAL(  u64sq5<>, u64sq5  )
+FPM_SQ_BIND_LITERAL(  u64sq6<>, u64sq6  )
+FPM_SQ_BIND_LITERAL(  u64sq7<>, u64sq7  )
+FPM_SQ_BIND_LITERAL(  u64sq8<>, u64sq8  )
+FPM_SQ_BIND_LITERAL(  u64sq9<>, u64sq9  )
+FPM_SQ_BIND_LITERAL( u64sq10<>, u64sq10 )
+FPM_SQ_BIND_LITERAL( u64sq11<>, u64sq11 )
+FPM_SQ_BIND_LITERAL( u64sq12<>, u64sq12 )
+FPM_SQ_BIND_LITERAL( u64sq13<>, u64sq13 )
+FPM_SQ_BIND_LITERAL( u64sq14<>, u64sq14 )
+FPM_SQ_BIND_LITERAL( u64sq15<>, u64sq15 )
+FPM_SQ_BIND_LITERAL( u64sq16<>, u64sq16 )
+FPM_SQ_BIND_LITERAL( u64sq17<>, u64sq17 )
+FPM_SQ_BIND_LITERAL( u64sq18<>, u64sq18 )
+FPM_SQ_BIND_LITERAL( u64sq19<>, u64sq19 )
+FPM_SQ_BIND_LITERAL( u64sq20<>, u64sq20 )
+FPM_SQ_BIND_LITERAL( u64sq21<>, u64sq21 )
+FPM_SQ_BIND_LITERAL( u64sq22<>, u64sq22 )
+FPM_SQ_BIND_LITERAL( u64sq23<>, u64sq23 )
+FPM_SQ_BIND_LITERAL( u64sq24<>, u64sq24 )
+FPM_SQ_BIND_LITERAL( u64sq25<>, u64sq25 )
+FPM_SQ_BIND_LITERAL( u64sq26<>, u64sq26 )
+FPM_SQ_BIND_LITERAL( u64sq27<>, u64sq27 )
+FPM_SQ_BIND_LITERAL( u64sq28<>, u64sq28 )
+FPM_SQ_BIND_LITERAL( u64sq29<>, u64sq29 )
+FPM_SQ_BIND_LITERAL( u64sq30<>, u64sq30 )
+FPM_SQ_BIND_LITERAL( u64sq31<>, u64sq31 )
+FPM_SQ_BIND_LITERAL( u64sq32<>, u64sq32 )
+FPM_SQ_BIND_LITERAL( u64sq33<>, u64sq33 )
+FPM_SQ_BIND_LITERAL( u64sq34<>, u64sq34 )
+FPM_SQ_BIND_LITERAL( u64sq35<>, u64sq35 )
+FPM_SQ_BIND_LITERAL( u64sq36<>, u64sq36 )
+FPM_SQ_BIND_LITERAL( u64sq37<>, u64sq37 )
+FPM_SQ_BIND_LITERAL( u64sq38<>, u64sq38 )
+FPM_SQ_BIND_LITERAL( u64sq39<>, u64sq39 )
+FPM_SQ_BIND_LITERAL( u64sq40<>, u64sq40 )
+FPM_SQ_BIND_LITERAL( u64sq41<>, u64sq41 )
+FPM_SQ_BIND_LITERAL( u64sq42<>, u64sq42 )
+FPM_SQ_BIND_LITERAL( u64sq43<>, u64sq43 )
+FPM_SQ_BIND_LITERAL( u64sq44<>, u64sq44 )
+FPM_SQ_BIND_LITERAL( u64sq45<>, u64sq45 )
+FPM_SQ_BIND_LITERAL( u64sq46<>, u64sq46 )
+FPM_SQ_BIND_LITERAL( u64sq47<>, u64sq47 )
+FPM_SQ_BIND_LITERAL( u64sq48<>, u64sq48 )
+FPM_SQ_BIND_LITERAL( u64sq49<>, u64sq49 )
+FPM_SQ_BIND_LITERAL( u64sq50<>, u64sq50 )
+FPM_SQ_BIND_LITERAL( u64sq51<>, u64sq51 )
+FPM_SQ_BIND_LITERAL( u64sq52<>, u64sq52 )
+FPM_SQ_BIND_LITERAL( u64sq53<>, u64sq53 )
+#endif
+
 /**\}*/
 }  // namespace fpm::sq::types
 
@@ -0,0 +1,328 @@
+/** \file
+ * Integer kernels of the trigonometric functions of the Sq type.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FPM_FPM_TRIG_HPP_4D2A9C61_E7B3_4F08_A5C2_8B1E6F3D7A90
+#define FPM_FPM_TRIG_HPP_4D2A9C61_E7B3_4F08_A5C2_8B1E6F3D7A90
+
+#include "fpm.hpp"
+#include <array>
+
+
+namespace fpm {
+/** \ingroup grp_fpm
+ * \{ */
+
+/** Engine of the trigonometric functions. Both engines use integer operations only and have a
+ * fixed number of operations per call, independent of the value. */
+enum class TrigEngine : uint8_t {
+    /// Default. Iterative CORDIC algorithm with shifts and additions only. More precise, but with
+    /// a longer, fixed number of iterations.
+    cordic = 0u,
+
+    /// Quarter-wave lookup table with linear interpolation, generated at compile-time. Faster,
+    /// but less precise than CORDIC.
+    lut
+};
+
+/** Unit of the angle passed to the trigonometric functions. */
+enum class AngleUnit : uint8_t {
+    /// Default. Angle in radians; one full circle is 2*pi.
+    rad = 0u,
+
+    /// Angle in turns; one full circle is 1. The angle can be wrapped with a single mask, thus
+    /// this is the more efficient unit.
+    turn
+};
+
+/**\}*/
+}  // namespace fpm
+
+
+namespace fpm::detail {
+
+/// Phase of an angle: one full circle corresponds to 2^32, thus the phase wraps around naturally.
+using phase_t = uint32_t;
+
+/// Scaling of the results of the trigonometric kernels (sine and cosine).
+static constexpr scaling_t TRIG_F = 30;
+
+/// Number of CORDIC iterations. The rotation angle of the last iteration is 1 in phase units.
+static constexpr std::size_t CORDIC_ITERATIONS = 30u;
+
+/// Number of bits of the index of the quarter-wave lookup table; the table has 2^bits segments.
+static constexpr int TRIG_LUT_BITS = 8;
+
+/// Pi with the precision of double.
+static constexpr double PI = 3.14159265358979323846;
+
+inline namespace lib {
+
+    /** \returns the approximated sine of the given angle (rad), calculated with a Taylor series. */
+    consteval
+    double sin(double x) noexcept {
+        // reduce to [-pi, pi] for fast convergence
+        while (x > PI) { x -= 2.*PI; }
+        while (x < -PI) { x += 2.*PI; }
+        double term = x, sum = x;
+        for (int n = 1; n < 30; ++n) {
+            term *= -x*x / ((2.*n) * (2.*n + 1.));
+            sum += term;
+        }
+        return sum;
+    }
+
+    /** \returns the approximated cosine of the given angle (rad). */
+    consteval
+    double cos(double x) noexcept { return detail::sin(x + PI/2.); }
+
+    /** \returns the approximated tangent of the given angle (rad). */
+    consteval
+    double tan(double x) noexcept { return detail::sin(x) / detail::cos(x); }
+
+    /** \returns the approximated length of the vector (a, b). The approximated square root is
+     * refined with Newton steps to the precision of double. */
+    consteval
+    double hypot(double a, double b) noexcept {
+        double const square = a*a + b*b;
+        double root = detail::sqrt(square);
+        for (int i = 0; i < 3 && root > 0.; ++i) {
+            root = (root + square / root) / 2.;
+        }
+        return root;
+    }
+
+    /** \returns the approximated arc tangent of the given number in [0, 1], calculated with a
+     * Taylor series. Values larger than 1/2 are reduced via atan(x) = 2*atan(x / (1 + sqrt(1+x^2))). */
+    consteval
+    double atan(double x) noexcept {
+        if (x > 0.5) { return 2. * detail::atan( x / (1. + detail::hypot(1., x)) ); }
+        double term = x, sum = x;
+        for (int n = 1; n < 40; ++n) {
+            term *= -x*x;
+            sum += term / (2.*n + 1.);
+        }
+        return sum;
+    }
+}
+
+/** Converts the given scaled angle to its phase (one full circle is 2^32).
+ * \note For radians, the angle is multiplied by 2^34/(2*pi) and shifted, which keeps the product
+ * within 64 bits for all base types of up to 32 bits. */
+template< AngleUnit unit, scaling_t f, /* deduced: */ std::integral BaseT >
+requires ( sizeof(BaseT) <= sizeof(uint32_t) && 0 <= f && f <= TRIG_F )
+constexpr
+phase_t phaseOf(BaseT const angle) noexcept {
+    if constexpr (unit == AngleUnit::turn) {
+        // wraps around the full circle
+        return static_cast<phase_t>( static_cast<uint64_t>(angle) << (32 - f) );
+    }
+    else {
+        using calc_t = std::conditional_t< std::is_signed_v<BaseT>, int64_t, uint64_t >;
+        constexpr calc_t RAD_TO_PHASE = static_cast<calc_t>( 17179869184. / (2.*PI) + 0.5 );  // 2^34 / (2*pi)
+        return static_cast<phase_t>( static_cast<uint64_t>( static_cast<calc_t>(angle) * RAD_TO_PHASE >> (f + 2) ) );
+    }
+}
+
+/// Rotation angles of the CORDIC iterations in phase units: atan(2^-i) * 2^32 / (2*pi).
+inline constexpr auto cordicAngles = []() consteval {
+    std::array<int32_t, CORDIC_ITERATIONS> angles{};
+    for (std::size_t i = 0u; i < angles.size(); ++i) {
+        angles[i] = static_cast<int32_t>( detail::atan( 1. / static_cast<double>(uint64_t(1) << i) )
+                                          * 4294967296. / (2.*PI) + 0.5 );
+    }
+    return angles;
+}();
+
+/// Reciprocal of the CORDIC gain, scaled by 2^TRIG_F: prod( cos(atan(2^-i)) ) * 2^30.
+inline constexpr int32_t cordicGain = []() consteval {
+    double gain = 1.;
+    for (std::size_t i = 0u; i < CORDIC_ITERATIONS; ++i) {
+        gain *= detail::cos( detail::atan( 1. / static_cast<double>(uint64_t(1) << i) ) );
+    }
+    return static_cast<int32_t>( gain * static_cast<double>(int32_t(1) << TRIG_F) + 0.5 );
+}();
+
+/// Quarter-wave table with sin(i * pi/2 / 2^TRIG_LUT_BITS) * 2^TRIG_F. The last entry is repeated
+/// to allow the interpolation at the end of the quarter wave without a branch.
+inline constexpr auto trigLut = []() consteval {
+    constexpr std::size_t SEGMENTS = std::size_t(1) << TRIG_LUT_BITS;
+    std::array<int32_t, SEGMENTS + 2u> table{};
+    for (std::size_t i = 0u; i <= SEGMENTS; ++i) {
+        double const s = detail::sin( static_cast<double>(i) * (PI/2.) / static_cast<double>(SEGMENTS) );
+        table[i] = static_cast<int32_t>( s * static_cast<double>(int32_t(1) << TRIG_F) + 0.5 );
+    }
+    table[SEGMENTS + 1u] = table[SEGMENTS];
+    return table;
+}();
+
+/** Calculates the sine and cosine of the given phase with the CORDIC algorithm in rotation mode.
+ * \returns { sin, cos }, scaled by 2^TRIG_F.
+ * \note The angle is reduced to [-pi/4, pi/4) and rotated in a fixed number of iterations with
+ * shifts and additions only. Due to the truncated shifts and the rounded rotation angles, the
+ * result deviates from the exact value by up to about 2^-25. */
+constexpr
+std::pair<int32_t, int32_t> sincosCordic(phase_t const phase) noexcept {
+    // nearest quadrant and the remaining angle within [-pi/4, pi/4)
+    phase_t const quadrant = (phase + (phase_t(1) << 29u)) >> 30u;
+    auto z = static_cast<int32_t>( phase - (quadrant << 30u) );
+
+    int32_t x = cordicGain, y = 0;
+    for (std::size_t i = 0u; i < CORDIC_ITERATIONS; ++i) {
+        int32_t const dx = y >> i, dy = x >> i;
+        if (z >= 0) { x -= dx; y += dy; z -= cordicAngles[i]; }
+        else        { x += dx; y -= dy; z += cordicAngles[i]; }
+    }
+
+    // rotate the result back to the quadrant
+    switch (quadrant & 3u) {
+    case 0u:  return { y, x };
+    case 1u:  return { x, -y };
+    case 2u:  return { -y, -x };
+    default:  return { -x, y };
+    }
+}
+
+/** \returns the sine of the given phase in the first quarter wave [0, 2^30], scaled by 2^TRIG_F,
+ * linearly interpolated between two entries of the quarter-wave table. */
+constexpr
+int32_t sinQuarterLut(phase_t const phase) noexcept {
+    constexpr int FRAC_BITS = 30 - TRIG_LUT_BITS;
+    phase_t const index = phase >> FRAC_BITS;
+    auto const frac = static_cast<int64_t>( phase & ((phase_t(1) << FRAC_BITS) - 1u) );
+    int32_t const lo = trigLut[index], hi = trigLut[index + 1u];
+    return lo + static_cast<int32_t>( (static_cast<int64_t>(hi - lo) * frac) >> FRAC_BITS );
+}
+
+/** Calculates the sine and cosine of the given phase with the quarter-wave lookup table.
+ * \returns { sin, cos }, scaled by 2^TRIG_F.
+ * \note The error of the linear interpolation is at most (pi/2 / 2^TRIG_LUT_BITS)^2 / 8, which
+ * is approximately 2^-17.7 for 256 segments. */
+constexpr
+std::pair<int32_t, int32_t> sincosLut(phase_t const phase) noexcept {
+    constexpr phase_t QUARTER = phase_t(1) << 30u;
+    auto sinOf = [](phase_t const p) constexpr noexcept {
+        phase_t const quadrant = p >> 30u, inQuarter = p & (QUARTER - 1u);
+        int32_t const magnitude = sinQuarterLut( (quadrant & 1u) ? QUARTER - inQuarter : inQuarter );
+        return (quadrant & 2u) ? -magnitude : magnitude;
+    };
+    return { sinOf(phase), sinOf(phase + QUARTER) };  // cos(x) = sin(x + pi/2)
+}
+
+/** Calculates the sine and cosine of the given phase with the given engine.
+ * \returns { sin, cos }, scaled by 2^TRIG_F. */
+template< TrigEngine engine >
+constexpr
+std::pair<int32_t, int32_t> sincos(phase_t const phase) noexcept {
+    if constexpr (engine == TrigEngine::lut) { return sincosLut(phase); }
+    else { return sincosCordic(phase); }
+}
+
+/** Calculates the magnitude and the angle of the vector (x, y) with the CORDIC algorithm in
+ * vectoring mode. Before the iterations, the components are shifted by the given number of bits
+ * (to the right if negative), such that their magnitude is at most 2^32.
+ * \returns { magnitude, phase }; the magnitude has the scaling of the components (rounded to
+ * nearest), the phase is in (-2^31, 2^31], i.e. (-pi, pi].
+ * \note The vector is rotated into the right half-plane first, and then onto the x-axis in a
+ * fixed number of iterations with shifts and additions only. */
+template< int shift >
+requires ( -64 < shift && shift < 32 )
+constexpr
+std::pair<int64_t, int64_t> polarCordic(int64_t x, int64_t y) noexcept {
+    if (x == 0 && y == 0) { return { 0, 0 }; }  // no direction
+
+    // rotate into the right half-plane: atan2(y, x) = atan2(-y, -x) +/- pi
+    int64_t offset = 0;
+    if (x < 0) {
+        offset = (y >= 0) ? (int64_t(1) << 31u) : -(int64_t(1) << 31u);
+        x = -x; y = -y;
+    }
+    if constexpr (shift > 0) { x <<= shift; y <<= shift; }
+    else if constexpr (shift < 0) { x >>= -shift; y >>= -shift; }
+
+    int64_t z = 0;
+    for (std::size_t i = 0u; i < CORDIC_ITERATIONS; ++i) {
+        int64_t const dx = y >> i, dy = x >> i;
+        if (y > 0) { x += dx; y -= dy; z += cordicAngles[i]; }
+        else       { x -= dx; y += dy; z -= cordicAngles[i]; }
+    }
+
+    // compensate the CORDIC gain and undo the normalization shift, rounded to nearest
+    constexpr int s = TRIG_F + shift;
+    int64_t const magnitude = (x * cordicGain + (int64_t(1) << (s - 1))) >> s;
+    return { magnitude, z + offset };
+}
+
+/** Converts the given phase (one full circle is 2^32) to an angle with the given unit and scaling,
+ * rounded to nearest. */
+template< AngleUnit unit, scaling_t f, std::integral TargetT >
+requires ( 0 <= f && f <= TRIG_F )
+constexpr
+TargetT fromPhase(int64_t const phase) noexcept {
+    if constexpr (unit == AngleUnit::turn) {
+        constexpr int s = 32 - f;
+        return static_cast<TargetT>( (phase + (int64_t(1) << (s - 1))) >> s );
+    }
+    else {
+        constexpr int64_t PHASE_TO_RAD = static_cast<int64_t>( 2.*PI * 536870912. + 0.5 );  // 2*pi * 2^29
+        constexpr int s = 61 - f;
+        return static_cast<TargetT>( (phase * PHASE_TO_RAD + (int64_t(1) << (s - 1))) >> s );
+    }
+}
+
+/** Rescales the given kernel result from TRIG_F to f, rounded to nearest, and limits it to the
+ * scaled range [-1, 1]. */
+template< scaling_t f, std::integral TargetT >
+requires ( 0 <= f && f <= TRIG_F )
+constexpr
+TargetT fromTrigScaling(int32_t const value) noexcept {
+    constexpr int32_t ONE = int32_t(1) << f;
+    int32_t rounded = value;
+    if constexpr (f < TRIG_F) {
+        rounded = static_cast<int32_t>( (static_cast<int64_t>(value) + (int64_t(1) << (TRIG_F - f - 1))) >> (TRIG_F - f) );
+    }
+    return static_cast<TargetT>( std::clamp(rounded, -ONE, ONE) );
+}
+
+/** Concept: Checks whether the given (S)Q type can be passed to the trigonometric functions.
+ * This is possible as long as the size of the base type does not exceed 4 bytes and the scaling
+ * is not negative and not larger than the scaling of the kernels. */
+template< typename T >
+concept CanBePassedToTrig = (
+    sizeof(typename T::base_t) <= sizeof(int32_t)
+    && 0 <= T::f && T::f <= TRIG_F
+);
+
+/** Concept: Checks whether the given (S)Q types can be passed to the atan2 and polar functions.
+ * This is possible as long as the size of both base types does not exceed 4 bytes and both
+ * scalings are not negative and not larger than the scaling of the kernels. */
+template< typename TY, typename TX >
+concept CanBePassedToAtan2 = CanBePassedToTrig<TY> && CanBePassedToTrig<TX>;
+
+/** Concept: Checks whether the given (S)Q type can be passed to the tan function. In addition to
+ * the requirements of the other trigonometric functions, the angle must be within the open
+ * interval (-pi/2, pi/2), or (-1/4, 1/4) turns respectively, so that the tangent is bounded. */
+template< typename T, AngleUnit unit >
+concept CanBePassedToTan = (
+    CanBePassedToTrig<T>
+    && ( (unit == AngleUnit::rad && -PI/2. < T::realMin && T::realMax < PI/2.)
+         || (unit == AngleUnit::turn && -0.25 < T::realMin && T::realMax < 0.25) )
+);
+
+}  // namespace fpm::detail
+
+
+#endif
+// EOF
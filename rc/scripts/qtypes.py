@@ -19,6 +19,8 @@ sqTypeList = [
     SqType('uint16_t', 'u16', 16, -8, 15),
     SqType('int32_t', 'i32', 32, -16, 31),
     SqType('uint32_t', 'u32', 32, -16, 31),
+    SqType('int64_t', 'i64', 64, -32, 53),
+    SqType('uint64_t', 'u64', 64, -32, 53),
 ]
 
 
@@ -37,6 +39,8 @@ qTypeList = [
     QType('uint16_t', 'u16', 16, -8, 15, 'error'),
     QType('int32_t', 'i32', 32, -16, 31, 'error'),
     QType('uint32_t', 'u32', 32, -16, 31, 'error'),
+    QType('int64_t', 'i64', 64, -32, 53, 'error'),
+    QType('uint64_t', 'u64', 64, -32, 53, 'error'),
 ]
 
 
@@ -49,7 +53,7 @@ def print_sq_types():
     for sq in sqTypeList:
         f_range = get_f_from_range(sq.fFrom, sq.fTo)
         for f, fStr in f_range:
-            print("template< double lower = fpm::detail::realMin<%8s, %3s>(), double upper = fpm::detail::realMax<%8s, %3s>() > using %8s = sq<%8s, %3s, lower, upper>;" % (sq.type, f, sq.type, f, sq.short + "sq" + fStr, sq.type, f))
+            print("template< double lower = fpm::detail::realMin<%8s, %3s>(), double upper = fpm::detail::realMax<%8s, %3s>(), Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using %8s = Sq<%8s, %3s, lower, upper, rnd>;" % (sq.type, f, sq.type, f, sq.short + "sq" + fStr, sq.type, f))
 
 def print_sq_literals():
     for sq in sqTypeList:
@@ -62,7 +66,7 @@ def print_q_types():
     for q in qTypeList:
         f_range = get_f_from_range(q.fFrom, q.fTo)
         for f, fStr in f_range:
-            print("template< double lower = fpm::detail::realMin<%8s, %3s>(), double upper = fpm::detail::realMax<%8s, %3s>(), Overflow ovfBx = Ovf::%s > using %7s = q<%8s, %3s, lower, upper, ovfBx>;" % (q.type, f, q.type, f, q.defOvf, q.short + "q" + fStr, q.type, f))
+            print("template< double lower = fpm::detail::realMin<%8s, %3s>(), double upper = fpm::detail::realMax<%8s, %3s>(), Overflow ovfBx = Ovf::%s, Rounding rnd = fpm::detail::DEFAULT_ROUNDING > using %7s = Q<%8s, %3s, lower, upper, ovfBx, rnd>;" % (q.type, f, q.type, f, q.defOvf, q.short + "q" + fStr, q.type, f))
 
 def print_q_literals():
     for q in qTypeList:
@@ -0,0 +1,119 @@
+# Script of the size suite: measures the .text bytes of the objects listed in the manifest, writes
+# them as a table and compares them with the baseline.
+#
+# Variables: SIZE_TOOL, MANIFEST, BASELINE, TABLE, THRESHOLD_PERCENT, THRESHOLD_BYTES, COMPILER
+# (recorded in the baseline), and UPDATE to write the measured sizes to the baseline instead of
+# comparing them. Without UPDATE, the check fails if there is no baseline, or if the baseline was
+# recorded with another compiler version or other flags.
+
+cmake_minimum_required(VERSION 3.25)
+
+if (NOT SIZE_TOOL)
+    message(FATAL_ERROR "No size tool found (llvm-size or size)")
+endif()
+
+# pads the given string with spaces to the given width
+function(pad out str width)
+    string(LENGTH "${str}" len)
+    if (len LESS width)
+        math(EXPR n "${width} - ${len}")
+        string(REPEAT " " ${n} spaces)
+        set(str "${str}${spaces}")
+    endif()
+    set(${out} "${str}" PARENT_SCOPE)
+endfunction()
+
+# sum of all .text sections of the given object, including the .text.* sections of
+# -ffunction-sections and the cold .text.unlikely sections
+function(text_size out object)
+    execute_process(COMMAND ${SIZE_TOOL} -A ${object} OUTPUT_VARIABLE sections RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${SIZE_TOOL} failed on ${object}")
+    endif()
+    string(REPLACE "\n" ";" sections "${sections}")
+    set(sum 0)
+    foreach(line IN LISTS sections)
+        if (line MATCHES "^\\.text[^ \t]*[ \t]+([0-9]+)")
+            math(EXPR sum "${sum} + ${CMAKE_MATCH_1}")
+        endif()
+    endforeach()
+    set(${out} ${sum} PARENT_SCOPE)
+endfunction()
+
+# baseline entries "<operation>/<type>/<opt> <bytes>"
+if (NOT UPDATE)
+    if (NOT EXISTS ${BASELINE})
+        message(FATAL_ERROR "No baseline ${BASELINE} for this compiler; build FpmSizeSuiteUpdate to record one")
+    endif()
+    file(STRINGS ${BASELINE} compilerLine REGEX "^# compiler: ")
+    string(REGEX REPLACE "^# compiler: " "" baselineCompiler "${compilerLine}")
+    if (NOT baselineCompiler STREQUAL COMPILER)
+        message(FATAL_ERROR "Baseline ${BASELINE} was recorded with \"${baselineCompiler}\", but the "
+                            "objects are compiled with \"${COMPILER}\"; the sizes are not comparable")
+    endif()
+    file(STRINGS ${BASELINE} baselineLines REGEX "^[^#]")
+    foreach(line IN LISTS baselineLines)
+        if (line MATCHES "^([^ ]+)[ ]+([0-9]+)$")
+            set("base_${CMAKE_MATCH_1}" ${CMAKE_MATCH_2})
+        endif()
+    endforeach()
+endif()
+
+file(STRINGS ${MANIFEST} entries)
+set(table "")
+set(exceeded "")
+set(update "# .text bytes per operation/type/optimization, written by FpmSizeSuiteUpdate\n# compiler: ${COMPILER}\n")
+pad(header "operation" 32)
+string(APPEND table "${header}    text  baseline    delta\n")
+foreach(entry IN LISTS entries)
+    string(REGEX MATCH "^([^ ]+) (.+)$" _ "${entry}")
+    set(name ${CMAKE_MATCH_1})
+    text_size(bytes ${CMAKE_MATCH_2})
+    string(APPEND update "${name} ${bytes}\n")
+
+    pad(row "${name}" 32)
+    string(LENGTH "${bytes}" len)
+    math(EXPR n "8 - ${len}")
+    string(REPEAT " " ${n} spaces)
+    string(APPEND row "${spaces}${bytes}")
+    if (DEFINED "base_${name}")
+        set(base ${base_${name}})
+        math(EXPR delta "${bytes} - ${base}")
+        math(EXPR allowed "${base} * ${THRESHOLD_PERCENT} / 100")
+        if (allowed LESS THRESHOLD_BYTES)
+            set(allowed ${THRESHOLD_BYTES})
+        endif()
+        if (delta GREATER allowed)
+            list(APPEND exceeded ${name})
+        endif()
+        if (delta GREATER 0)
+            set(delta "+${delta}")
+        endif()
+        string(LENGTH "${base}" len)
+        math(EXPR n "10 - ${len}")
+        string(REPEAT " " ${n} spaces)
+        string(APPEND row "${spaces}${base}")
+        string(LENGTH "${delta}" len)
+        math(EXPR n "9 - ${len}")
+        string(REPEAT " " ${n} spaces)
+        string(APPEND row "${spaces}${delta}")
+        if (name IN_LIST exceeded)
+            string(APPEND row "  EXCEEDED")
+        endif()
+    else()
+        string(APPEND row "         -        -  (new)")
+    endif()
+    string(APPEND table "${row}\n")
+endforeach()
+
+file(WRITE ${TABLE} "${table}")
+message("${table}")
+
+if (UPDATE)
+    file(WRITE ${BASELINE} "${update}")
+    message("Baseline written to ${BASELINE}")
+elseif (exceeded)
+    list(JOIN exceeded ", " exceeded)
+    message(FATAL_ERROR "Code size exceeds the baseline by more than ${THRESHOLD_PERCENT}% (at least "
+                        "${THRESHOLD_BYTES} bytes): ${exceeded}")
+endif()
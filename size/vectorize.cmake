@@ -0,0 +1,56 @@
+# Script of the vectorization check: compiles vectorize.cpp with the vectorizer remarks of the
+# compiler and counts the remarks on the block loop of the batch kernels in simd.hpp.
+#
+# Variables: COMPILER, COMPILER_ID, FLAGS, INCLUDE, SOURCE, SIMD_HEADER, KERNELS (number of kernels
+# instantiated by the source), REQUIRED (optimization levels at which all kernels must be
+# vectorized) and REPORTED (optimization levels at which the remarks are only listed).
+
+cmake_minimum_required(VERSION 3.25)
+
+if (COMPILER_ID STREQUAL "GNU")
+    set(remarkFlags -fopt-info-vec-optimized)
+elseif (COMPILER_ID MATCHES "Clang")
+    set(remarkFlags "-Rpass=loop-vectorize|slp-vectorizer")
+else()
+    message(FATAL_ERROR "No vectorizer remarks known for compiler ${COMPILER_ID}")
+endif()
+
+# lines of the block loop, which is the loop annotated with FPM_SIMD_LOOP, and of its body
+file(STRINGS ${SIMD_HEADER} lines)
+set(lineNo 0)
+set(loopLines "")
+foreach(line IN LISTS lines)
+    math(EXPR lineNo "${lineNo} + 1")
+    if (line MATCHES "^[ \t]+FPM_SIMD_LOOP[ \t]*$")
+        math(EXPR loopLine "${lineNo} + 1")
+        math(EXPR bodyLine "${lineNo} + 2")
+        list(APPEND loopLines ${loopLine} ${bodyLine})
+    endif()
+endforeach()
+if (NOT loopLines)
+    message(FATAL_ERROR "No loop annotated with FPM_SIMD_LOOP found in ${SIMD_HEADER}")
+endif()
+list(JOIN loopLines "|" loopLines)
+
+separate_arguments(FLAGS)
+set(failed "")
+foreach(opt IN LISTS REQUIRED REPORTED)
+    execute_process(
+        COMMAND ${COMPILER} ${FLAGS} -std=c++20 -${opt} -I${INCLUDE} ${remarkFlags}
+                -c ${SOURCE} -o vectorize.${opt}.o
+        ERROR_VARIABLE remarks RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Compiling ${SOURCE} with -${opt} failed:\n${remarks}")
+    endif()
+    string(REGEX MATCHALL "simd\\.hpp:(${loopLines}):[0-9]+:[^\n]*[Vv]ectorized" vectorized "${remarks}")
+    list(LENGTH vectorized count)
+    message("-${opt}: ${count} of ${KERNELS} kernels vectorized")
+    if (opt IN_LIST REQUIRED AND count LESS KERNELS)
+        list(APPEND failed -${opt})
+    endif()
+endforeach()
+
+if (failed)
+    list(JOIN failed ", " failed)
+    message(FATAL_ERROR "The block loops of the batch kernels are not vectorized with ${failed}")
+endif()
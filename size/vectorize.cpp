@@ -0,0 +1,24 @@
+/* \file
+ * Translation unit of the vectorization check: instantiates the batch kernels of simd.hpp, whose
+ * block loops must be reported as vectorized by the compiler when optimizing for speed.
+ */
+
+#include <fpm.hpp>
+
+using namespace fpm::types;
+
+using in_t = i16q8<-10., 10.>;
+using sum_t = i16q8<-20., 20.>;
+using product_t = i16q8<-100., 100.>;
+
+std::size_t fpmVecAdd(std::span<in_t const> a, std::span<in_t const> b, std::span<sum_t> out) noexcept {
+    return fpm::simd::add(a, b, out);
+}
+std::size_t fpmVecSub(std::span<in_t const> a, std::span<in_t const> b, std::span<sum_t> out) noexcept {
+    return fpm::simd::sub(a, b, out);
+}
+std::size_t fpmVecMul(std::span<in_t const> a, std::span<in_t const> b, std::span<product_t> out) noexcept {
+    return fpm::simd::mul(a, b, out);
+}
+
+// EOF
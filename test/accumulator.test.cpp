@@ -0,0 +1,134 @@
+/* \file
+ * Tests for accumulator.hpp.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+
+
+/// Concept which checks whether the product of the given Sq types can be added to the given
+/// accumulator type.
+template< class Acc, class SqA, class SqB >
+concept MacAccumulatable = requires(Acc &acc, SqA const &a, SqB const &b) {
+    { acc.mac(a, b) } -> std::same_as<Acc&>;
+};
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ---------------------------------- Accumulator Test: Sum ------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class AccumulatorTest_Sum : public ::testing::Test {
+protected:
+    using c_t = i32q16<-1., 1.>;
+    using x_t = i32q16<-1., 1.>;
+    using product_t = decltype( std::declval<c_t::Sq<>>() * std::declval<x_t::Sq<>>() );
+    static constexpr std::size_t N = 256u;
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0u; i < N; ++i) {
+            c.push_back( c_t::construct( static_cast<int32_t>((i * 2711u) % 65536u) - 32768 ) );
+            x.push_back( x_t::construct( static_cast<int32_t>((i * 911u) % 65536u) - 30000 ) );
+        }
+    }
+    void TearDown() override
+    {
+    }
+
+    std::vector<c_t> c;
+    std::vector<x_t> x;
+};
+
+TEST_F(AccumulatorTest_Sum, accumulator_result__256_products__range_and_scaling_derived_from_n) {
+    fpm::Accumulator<product_t, N> acc;
+
+    auto result = acc.result();
+
+    ASSERT_TRUE(( std::is_same_v< i32sq16<-256., 256.>, decltype(result) > ));
+    ASSERT_EQ(0, result.scaled());
+}
+
+TEST_F(AccumulatorTest_Sum, accumulator_mac__256_products__truncated_once) {
+    fpm::Accumulator<product_t, N> acc;
+    int64_t expected = 0;  // scaled by 2^32
+
+    for (std::size_t i = 0u; i < N; ++i) {
+        acc.mac(+c[i], +x[i]);
+        expected += static_cast<int64_t>(c[i].scaled()) * x[i].scaled();
+    }
+    auto result = acc.result();
+
+    ASSERT_EQ(expected / (int64_t(1) << 16), result.scaled());  // truncated towards zero
+}
+
+TEST_F(AccumulatorTest_Sum, accumulator_mac__256_products__at_least_as_accurate_as_sum_of_rescaled_products) {
+    fpm::Accumulator<product_t, N> acc;
+    double exact = 0.;
+    double rescaledSum = 0.;
+
+    for (std::size_t i = 0u; i < N; ++i) {
+        acc.mac(+c[i], +x[i]);
+        exact += c[i].real() * x[i].real();
+        rescaledSum += (+c[i] * +x[i]).real();  // each product truncated
+    }
+    double const error = std::abs( acc.result().real() - exact );
+
+    ASSERT_GE(std::abs(rescaledSum - exact), error);
+    ASSERT_GT(1. / 65536., error);  // less than 1 LSB
+}
+
+TEST_F(AccumulatorTest_Sum, accumulator_mac__lower_scaling__scaled_to_accumulator) {
+    fpm::Accumulator<i32sq16<-2., 2.>, 2u> acc;
+
+    acc.mac(1.5_i32sq8, -1.25_i32sq8).mac(0.5_i32sq8, 0.5_i32sq8);
+    auto result = acc.result();
+
+    ASSERT_TRUE(( std::is_same_v< i32sq16<-4., 4.>, decltype(result) > ));
+    ASSERT_DOUBLE_EQ(-1.625, result.real());
+}
+
+TEST_F(AccumulatorTest_Sum, accumulator_add__sq_values__summed_up) {
+    fpm::Accumulator<i16sq8<-10., 10.>, 3u> acc;
+
+    acc += 2.5_i16sq8;
+    acc += -7.25_i16sq8;
+    acc += 4.0_i16sq4;
+    auto result = acc.result();
+
+    ASSERT_TRUE(( std::is_same_v< i16sq8<-30., 30.>, decltype(result) > ));
+    ASSERT_DOUBLE_EQ(-0.75, result.real());
+}
+
+TEST_F(AccumulatorTest_Sum, accumulator_reset__after_sum__result_is_zero) {
+    fpm::Accumulator<i16sq8<-10., 10.>, 3u> acc;
+    acc += 2.5_i16sq8;
+
+    acc.reset();
+
+    ASSERT_EQ(0, acc.result().scaled());
+}
+
+TEST_F(AccumulatorTest_Sum, accumulator_result__rounding_of_element_type__applied_to_result) {
+    using elem_t = i16sq8<-10., 10., fpm::Rounding::nearest>;
+    fpm::Accumulator<elem_t, 2u> acc;
+    acc.mac( i16sq8<-2., 2.>::fromScaled<1>(), i16sq8<-2., 2.>::fromReal<0.5>() );  // 0.5 resolution steps
+
+    auto result = acc.result();
+
+    ASSERT_EQ(fpm::Rounding::nearest, decltype(result)::rounding);
+    ASSERT_EQ(1, result.scaled());
+}
+
+TEST_F(AccumulatorTest_Sum, accumulator_mac__product_range_or_scaling_too_large__does_not_compile) {
+    using acc_t = fpm::Accumulator<product_t, N>;
+    ASSERT_TRUE(( MacAccumulatable< acc_t, c_t::Sq<>, x_t::Sq<> > ));
+    ASSERT_FALSE(( MacAccumulatable< acc_t, c_t::Sq<>, i32sq16<-2., 2.> > ));  // product range too large
+    ASSERT_FALSE(( MacAccumulatable< acc_t, c_t::Sq<>, i32sq20<-1., 1.> > ));  // product scaling too large
+}
+
+// EOF
@@ -0,0 +1,171 @@
+/* \file
+ * Tests for expr.hpp.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ Expr Test: Lazy ----------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class ExprTest_Lazy : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    using speed_t = i32q16<-100., 100.>;
+    using accel_t = i32q16<-10., 10.>;
+    using time_t = u16sq8<0., 10.>;
+    using s0_t = i32sq16<-5e3, 5e3>;
+    using pos_t = i32sq16<-6500., 6500.>;
+
+    /// s = 1/2*a*t^2 + v0*t + s0, evaluated with Sq operators
+    static pos_t eager(accel_t a, time_t t, speed_t v0, s0_t s0) {
+        return a*t*t / 2_ic + v0*t + s0;
+    }
+    /// s = 1/2*a*t^2 + v0*t + s0, evaluated lazily
+    static pos_t lazy(accel_t a, time_t t, speed_t v0, s0_t s0) {
+        return fpm::lazy(a)*t*t / 2_ic + fpm::lazy(v0)*t + s0;
+    }
+};
+
+TEST_F(ExprTest_Lazy, expr_kinematics__interval_analysis__range_and_intermediate_type) {
+    auto s = fpm::lazy( accel_t::fromReal<5.>() ) * time_t::fromReal<4.>() * time_t::fromReal<4.>() / 2_ic
+        + fpm::lazy( speed_t::fromReal<50.>() ) * time_t::fromReal<4.>() + s0_t::fromReal<1000.>();
+    using expr_t = decltype(s);
+
+    ASSERT_EQ(-6500., expr_t::realMin);
+    ASSERT_EQ(+6500., expr_t::realMax);
+    ASSERT_EQ(16 + 8 + 8 + 1, expr_t::f);  // exact scaling of a*t*t/2
+    ASSERT_TRUE(( std::is_same_v<int64_t, expr_t::calc_t> ));
+    ASSERT_EQ(1240., pos_t(s).real());
+}
+
+TEST_F(ExprTest_Lazy, expr_kinematics__random_values__error_below_resolution) {
+    std::mt19937 gen(42u);
+    double maxErrorEager = 0., maxErrorLazy = 0.;
+    for (int i = 0; i < 10000; ++i) {
+        auto a = accel_t::construct( static_cast<int32_t>(gen() % (20u << 16u)) - (10 << 16) );
+        auto t = u16q8<0., 10.>::construct( static_cast<uint16_t>(gen() % 2561u) ).toSq();
+        auto v0 = speed_t::construct( static_cast<int32_t>(gen() % (200u << 16u)) - (100 << 16) );
+        auto s0 = i32q16<-5e3, 5e3>::construct( static_cast<int32_t>(gen() % (10000u << 16u)) - (5000 << 16) ).toSq();
+        double const exact = 0.5 * a.real() * t.real() * t.real() + v0.real() * t.real() + s0.real();
+
+        maxErrorEager = std::max(maxErrorEager, std::fabs(eager(a, t, v0, s0).real() - exact));
+        maxErrorLazy = std::max(maxErrorLazy, std::fabs(lazy(a, t, v0, s0).real() - exact));
+    }
+    // the lazy expression is exact up to the final rescaling
+    ASSERT_LT(maxErrorLazy, pos_t::resolution);
+    ASSERT_LT(maxErrorLazy, maxErrorEager);
+}
+
+TEST_F(ExprTest_Lazy, expr_eval__natural_type) {
+    auto e = fpm::lazy( i16sq8<-2., 2.>::fromReal<1.5>() ) * i16sq4<-2., 2.>::fromReal<-1.5>()
+        - u16sq8<0., 1.>::fromReal<0.25>();
+
+    auto r = e.eval();
+
+    ASSERT_TRUE(( std::is_same_v<int32_t, decltype(e)::calc_t> ));
+    ASSERT_TRUE(( std::is_same_v<i16sq8<-5., 4.>, decltype(r)> ));
+    ASSERT_EQ(-2.5, r.real());
+}
+
+TEST_F(ExprTest_Lazy, expr_ic__multiplication_and_division) {
+    auto x = i32sq16<-100., 100.>::fromReal<10.>();
+
+    i32sq16<-300., 300.> m1 = fpm::lazy(x) * 3_ic;
+    i32sq16<-300., 300.> m2 = 3_ic * fpm::lazy(x);
+    i32sq16<-34., 34.> d3 = fpm::lazy(x) / 3_ic;
+    i32sq16<-25., 25.> d4 = -fpm::lazy(x) / 4_ic;
+
+    ASSERT_EQ(30., m1.real());
+    ASSERT_EQ(30., m2.real());
+    ASSERT_NEAR(10. / 3., d3.real(), i32sq16<>::resolution);
+    ASSERT_EQ(-2.5, d4.real());
+    ASSERT_EQ(decltype(fpm::lazy(x) / 4_ic)::f, 18);  // division by a power of 2 is exact
+}
+
+TEST_F(ExprTest_Lazy, expr_ic__division_by_non_power_of_2__rounded_with_expression_rounding) {
+    auto xNative = i32sq16<-100., 100., fpm::Rounding::native>::fromScaled<2>();
+    auto xNearest = i32sq16<-100., 100., fpm::Rounding::nearest>::fromScaled<2>();
+
+    // 2/3 LSB = 2.67 at the scaling of the quotient (f + 2), then rescaled to f
+    i32sq16<-34., 34., fpm::Rounding::native> dNative = fpm::lazy(xNative) / 3_ic;
+    i32sq16<-34., 34., fpm::Rounding::nearest> dNearest = fpm::lazy(xNearest) / 3_ic;
+
+    ASSERT_EQ(0, dNative.scaled());  // 2 / 4
+    ASSERT_EQ(1, dNearest.scaled());  // 3 / 4
+}
+
+TEST_F(ExprTest_Lazy, expr_conversion__target_range_too_small__not_convertible) {
+    using expr_t = decltype( fpm::lazy( i32sq16<-10., 10.>::fromReal<1.>() ) * i32sq16<-10., 10.>::fromReal<1.>() );
+
+    ASSERT_TRUE(( std::is_convertible_v<expr_t, i32sq16<-100., 100.>> ));
+    ASSERT_TRUE(( std::is_convertible_v<expr_t, i32sq8<-100., 100.>> ));
+    ASSERT_FALSE(( std::is_convertible_v<expr_t, i32sq16<-99., 100.>> ));
+    ASSERT_FALSE(( std::is_convertible_v<expr_t, i32sq16<-100., 99.>> ));
+}
+
+TEST_F(ExprTest_Lazy, expr_conversion__nearest_rounding__limits_rounded_outward) {
+    using fpm::Rnd;
+    auto a = i16sq8<0., 0.99, Rnd::nearest>::fromReal<0.5>();
+    auto b = i16sq8<0., 1.>::fromReal<0.5>();
+    using expr_t = decltype( fpm::lazy(a) * b );  // 0.99 = 64880.64 scaled by 2^16
+
+    ASSERT_EQ(254. / 256., decltype( (fpm::lazy(a) * b).eval() )::realMax);  // 253.44 rounded up
+    ASSERT_TRUE(( std::is_convertible_v<expr_t, i16sq8<0., 0.99, Rnd::native>> ));
+    ASSERT_FALSE(( std::is_convertible_v<expr_t, i16sq8<0., 0.99, Rnd::nearest>> ));
+    ASSERT_TRUE(( std::is_convertible_v<expr_t, i16sq8<0., 1., Rnd::nearest>> ));
+}
+
+TEST_F(ExprTest_Lazy, expr_conversion__q_target__overflow_behavior_applied) {
+    auto x = i32sq16<-10., 10.>::fromReal<5.>();
+
+    i32q16<-100., 100.> inRange = fpm::lazy(x) * x;  // no check needed
+    i32q16<-20., 20., fpm::Ovf::clamp> clamped = fpm::lazy(x) * x;
+    i32q8<-30., 30., fpm::Ovf::clamp> rescaled = fpm::lazy(x) * x - 1_ic * fpm::lazy(x);
+
+    ASSERT_EQ(25., inRange.real());
+    ASSERT_EQ(20., clamped.real());
+    ASSERT_EQ(20., rescaled.real());
+}
+
+TEST_F(ExprTest_Lazy, expr_conversion__q_target__not_convertible_without_check) {
+    using expr_t = decltype( fpm::lazy( i32sq16<-10., 10.>::fromReal<1.>() ) * i32sq16<-10., 10.>::fromReal<1.>() );
+
+    ASSERT_TRUE(( std::is_convertible_v<expr_t, i32q16<-100., 100.>> ));
+    ASSERT_TRUE(( std::is_convertible_v<expr_t, i32q16<-50., 50., fpm::Ovf::clamp>> ));
+    ASSERT_FALSE(( std::is_convertible_v<expr_t, i32q16<-50., 50., fpm::Ovf::error>> ));  // check needed
+    ASSERT_FALSE(( std::is_convertible_v<expr_t, i8q4<-7., 7., fpm::Ovf::clamp>> ));  // range not representable
+}
+
+TEST_F(ExprTest_Lazy, expr_constexpr__evaluated_at_compile_time) {
+    constexpr i16sq8<-10., 10.> y = fpm::lazy( i16sq8<-2., 2.>::fromReal<1.5>() ) * i16sq8<-2., 2.>::fromReal<1.5>()
+        - i16sq8<0., 1.>::fromReal<0.25>();
+
+    static_assert(y.scaled() == 2 * 256);
+}
+
+TEST_F(ExprTest_Lazy, expr_conversion__target_rounding__applied_to_final_rescaling) {
+    auto a = i16sq8<-2., 2.>::fromScaled<1>();
+    auto b = i16sq8<-2., 2.>::fromReal<0.5>();
+
+    i16sq8<-10., 10., fpm::Rounding::native> yNative = fpm::lazy(a) * b;  // 0.5 resolution steps
+    i16sq8<-10., 10., fpm::Rounding::nearest> yNearest = fpm::lazy(a) * b;
+
+    ASSERT_EQ(0, yNative.scaled());
+    ASSERT_EQ(1, yNearest.scaled());
+    ASSERT_EQ(fpm::Rounding::nearest, decltype( fpm::lazy(yNearest) + a )::node_t::rounding);
+    ASSERT_EQ(fpm::Rounding::nearest, decltype( (fpm::lazy(yNearest) + a).eval() )::rounding);
+}
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <iostream>
 
 #include <fpm.hpp>
@@ -81,6 +82,166 @@ TEST_F(InternalTest, doubleFromLiteral__smallest_and_largest_double_with_exponen
     ASSERT_NEAR(1.79769e308, resultL, 4e292L);
 }
 
+TEST_F(InternalTest, divic__int8_all_values__same_result_as_division) {
+    auto check = [](auto ic) {
+        using T = typename decltype(ic)::value_type;
+        for (int v = std::numeric_limits<T>::min(); v <= std::numeric_limits<T>::max(); ++v) {
+            ASSERT_EQ(static_cast<T>(v / ic.value), (detail::divic<T, ic.value>(static_cast<T>(v)))) << "v=" << v << " ic=" << +ic.value;
+        }
+    };
+    check(std::integral_constant<int8_t, 3>{});
+    check(std::integral_constant<int8_t, -7>{});
+    check(std::integral_constant<int8_t, 64>{});
+    check(std::integral_constant<int8_t, -128>{});
+    check(std::integral_constant<uint8_t, 7>{});
+    check(std::integral_constant<uint8_t, 255>{});
+}
+
+TEST_F(InternalTest, divic__int32_limits__same_result_as_division) {
+    constexpr int32_t values[] = { INT32_MIN, INT32_MIN + 1, -1000001, -7, -6, -1, 0, 1, 6, 7, 1000001, INT32_MAX };
+    for (int32_t v : values) {
+        ASSERT_EQ(v / 7, (detail::divic<int32_t, 7>(v))) << v;
+        ASSERT_EQ(v / -10, (detail::divic<int32_t, -10>(v))) << v;
+        ASSERT_EQ(v / 1024, (detail::divic<int32_t, 1024>(v))) << v;
+        ASSERT_EQ(v / INT32_MAX, (detail::divic<int32_t, INT32_MAX>(v))) << v;
+        ASSERT_EQ(static_cast<uint32_t>(v) / 7u, (detail::divic<uint32_t, 7u>(static_cast<uint32_t>(v)))) << v;
+        ASSERT_EQ(static_cast<uint32_t>(v) / 641u, (detail::divic<uint32_t, 641u>(static_cast<uint32_t>(v)))) << v;
+    }
+}
+
+TEST_F(InternalTest, divic__constexpr__same_result_as_division) {
+    static_assert(detail::divic<int32_t, 3>(-10) == -3);
+    static_assert(detail::divic<int16_t, -1>(int16_t(-5)) == 5);
+    static_assert(detail::divic<uint16_t, 10u>(uint16_t(65535)) == 6553);
+    static_assert(detail::divic<int32_t, 1>(INT32_MIN) == INT32_MIN);
+}
+
+TEST_F(InternalTest, checkOverflow_clamp__int16_uint16_all_values__same_as_clamped_source_value) {
+    for (int v = std::numeric_limits<int16_t>::min(); v <= std::numeric_limits<int16_t>::max(); ++v) {
+        int16_t same = static_cast<int16_t>(v);
+        fpm::detail::checkOverflow<fpm::Ovf::clamp, int16_t>(same, -1000, 2000);
+        ASSERT_EQ(std::clamp(v, -1000, 2000), same) << v;
+
+        uint16_t signedToUnsigned = static_cast<uint16_t>(v);
+        fpm::detail::checkOverflow<fpm::Ovf::clamp, uint16_t, int16_t>(signedToUnsigned, 10u, 2000u);
+        ASSERT_EQ(std::clamp(v, 10, 2000), signedToUnsigned) << v;
+    }
+    for (int v = 0; v <= std::numeric_limits<uint16_t>::max(); ++v) {
+        int16_t unsignedToSigned = static_cast<int16_t>(v);
+        fpm::detail::checkOverflow<fpm::Ovf::clamp, int16_t, uint16_t>(unsignedToSigned, -1000, 2000);
+        ASSERT_EQ(std::clamp(v, -1000, 2000), unsignedToSigned) << v;
+    }
+}
+
+TEST_F(InternalTest, saturatingAdd__int8_uint8_all_values__same_as_clamped_wide_result) {
+    for (int a = -128; a <= 127; ++a) {
+        for (int b = -128; b <= 127; ++b) {
+            ASSERT_EQ(std::clamp(a + b, -128, 127), fpm::detail::saturatingAdd<int8_t>(a, b)) << a << " + " << b;
+            ASSERT_EQ(std::clamp(a - b, -128, 127), fpm::detail::saturatingSub<int8_t>(a, b)) << a << " - " << b;
+        }
+    }
+    for (int a = 0; a <= 255; ++a) {
+        for (int b = 0; b <= 255; ++b) {
+            ASSERT_EQ(std::clamp(a + b, 0, 255), fpm::detail::saturatingAdd<uint8_t>(a, b)) << a << " + " << b;
+            ASSERT_EQ(std::clamp(a - b, 0, 255), fpm::detail::saturatingSub<uint8_t>(a, b)) << a << " - " << b;
+        }
+    }
+}
+
+TEST_F(InternalTest, divr__int8_all_values__rounded_like_real_division) {
+    for (int v = INT8_MIN; v <= INT8_MAX; ++v) {
+        for (int d : { -128, -7, -4, -3, -1, 1, 2, 3, 5, 127 }) {
+            if (v == INT8_MIN && d == -1) { continue; }  // quotient does not fit
+            double const exact = v / static_cast<double>(d);
+            auto const i8 = static_cast<int8_t>(v), d8 = static_cast<int8_t>(d);
+            ASSERT_EQ(std::trunc(exact), detail::divr<Rounding::native>(i8, d8)) << v << "/" << d;  // truncated
+            ASSERT_EQ(std::trunc(exact), detail::divr<Rounding::towardZero>(i8, d8)) << v << "/" << d;
+            ASSERT_EQ(std::floor(exact + 0.5), detail::divr<Rounding::nearest>(i8, d8)) << v << "/" << d;
+            ASSERT_EQ(std::nearbyint(exact), detail::divr<Rounding::convergent>(i8, d8)) << v << "/" << d;
+        }
+    }
+    ASSERT_EQ(3u, detail::divr<Rounding::nearest>(5u, 2u));
+    ASSERT_EQ(2u, detail::divr<Rounding::convergent>(5u, 2u));
+}
+
+TEST_F(InternalTest, divicr__int8_all_values__same_result_as_divr) {
+    auto check = [](auto ic) {
+        using T = typename decltype(ic)::value_type;
+        for (int v = std::numeric_limits<T>::min(); v <= std::numeric_limits<T>::max(); ++v) {
+            auto const t = static_cast<T>(v);
+            ASSERT_EQ(detail::divr<Rounding::native>(t, ic.value), (detail::divicr<Rounding::native, T, ic.value>(t))) << "v=" << v << " ic=" << +ic.value;
+            ASSERT_EQ(detail::divr<Rounding::towardZero>(t, ic.value), (detail::divicr<Rounding::towardZero, T, ic.value>(t))) << "v=" << v << " ic=" << +ic.value;
+            ASSERT_EQ(detail::divr<Rounding::nearest>(t, ic.value), (detail::divicr<Rounding::nearest, T, ic.value>(t))) << "v=" << v << " ic=" << +ic.value;
+            ASSERT_EQ(detail::divr<Rounding::convergent>(t, ic.value), (detail::divicr<Rounding::convergent, T, ic.value>(t))) << "v=" << v << " ic=" << +ic.value;
+        }
+    };
+    check(std::integral_constant<int8_t, 3>{});
+    check(std::integral_constant<int8_t, -7>{});
+    check(std::integral_constant<int8_t, 2>{});
+    check(std::integral_constant<int8_t, -128>{});
+    check(std::integral_constant<uint8_t, 6>{});
+    check(std::integral_constant<uint8_t, 255>{});
+}
+
+TEST_F(InternalTest, roundedMinMax__rounding_modes__limits_rounded_outward_if_exceedable) {
+    static_assert(1. == detail::roundedMax(0.9375, 2, Rounding::nearest));
+    static_assert(1. == detail::roundedMax(0.9375, 2, Rounding::convergent));
+    static_assert(0.9375 == detail::roundedMax(0.9375, 2, Rounding::native));
+    static_assert(0.9375 == detail::roundedMax(0.9375, 2, Rounding::towardZero));
+    static_assert(0.75 == detail::roundedMax(0.75, 2, Rounding::nearest));  // multiple of the resolution
+    static_assert(-0.9375 == detail::roundedMax(-0.9375, 2, Rounding::nearest));  // truncated towards zero
+    static_assert(-1. == detail::roundedMin(-0.9375, 2, Rounding::nearest));
+    static_assert(0.9375 == detail::roundedMin(0.9375, 2, Rounding::nearest));
+    static_assert(-0.9375 == detail::roundedMin(-0.9375, 2, Rounding::towardZero));
+    SUCCEED();
+}
+
+TEST_F(InternalTest, isqrt__all_values_below_2_pow_20__same_result_for_both_implementations) {
+    for (uint64_t v = 0u; v < (uint64_t(1) << 20u); ++v) {
+        ASSERT_EQ(detail::isqrtbs(v), detail::isqrtnr(v)) << v;
+    }
+}
+
+TEST_F(InternalTest, isqrt__around_squares_and_large_values__rounded_down) {
+    auto isFloorRoot = [](uint64_t v, uint64_t r) {
+        return r*r <= v && (r == UINT32_MAX || (r + 1u)*(r + 1u) > v);
+    };
+    for (uint64_t r = 2u; r <= UINT32_MAX; r += 65521u) {
+        for (uint64_t v : { r*r - 1u, r*r, r*r + 1u }) {
+            ASSERT_TRUE(isFloorRoot(v, detail::isqrtnr(v))) << v;
+            ASSERT_TRUE(isFloorRoot(v, detail::isqrtbs(v))) << v;
+        }
+    }
+    for (uint64_t v = UINT64_MAX; v > UINT64_MAX - 1000u; --v) {
+        ASSERT_TRUE(isFloorRoot(v, detail::isqrtnr(v))) << v;
+        ASSERT_TRUE(isFloorRoot(v, detail::isqrtbs(v))) << v;
+    }
+}
+
+TEST_F(InternalTest, isqrt__constexpr__rounded_down) {
+    static_assert(detail::isqrtnr(0u) == 0u);
+    static_assert(detail::isqrtnr(99u) == 9u);
+    static_assert(detail::isqrtnr(uint64_t(1) << 62u) == (uint32_t(1) << 31u));
+    static_assert(detail::isqrtnr(UINT64_MAX) == UINT32_MAX);
+    static_assert(detail::isqrtbs(UINT64_MAX) == UINT32_MAX);
+}
+
+TEST_F(InternalTest, icbrt__around_cubes_and_limits__rounded_down) {
+    auto isFloorRoot = [](uint64_t v, uint64_t r) {
+        return r*r*r <= v && (r + 1u)*(r + 1u)*(r + 1u) > v;
+    };
+    for (uint64_t v = 0u; v < 100000u; ++v) {
+        ASSERT_TRUE(isFloorRoot(v, detail::icbrt(v))) << v;
+    }
+    for (uint64_t r = 2u; r < 2642245u; r += 997u) {  // 2642245^3 > 2^64
+        for (uint64_t v : { r*r*r - 1u, r*r*r, r*r*r + 1u }) {
+            ASSERT_TRUE(isFloorRoot(v, detail::icbrt(v))) << v;
+        }
+    }
+    ASSERT_EQ(2642245u, detail::icbrt(UINT64_MAX));
+    static_assert(detail::icbrt(0u) == 0u && detail::icbrt(7u) == 1u && detail::icbrt(8u) == 2u);
+}
+
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ------------------------------------ S2S Test ------------------------------------------------ //
@@ -342,6 +503,39 @@ TEST_F(S2STest, s2sh__constexpr_signed__int_asymmetric_output) {
     ASSERT_EQ(expectedResultN, resultN);
 }
 
+TEST_F(S2STest, s2shr__int8_all_values__rounded_like_real_division) {
+    auto check = [](auto n) {
+        constexpr scaling_t from = n.value, to = 0;
+        for (int v = INT8_MIN; v <= INT8_MAX; ++v) {
+            auto const i8 = static_cast<int8_t>(v);
+            double const exact = v / static_cast<double>(1 << n.value);
+            ASSERT_EQ(std::floor(exact), (s2shr<Rounding::native, from, to, int8_t>(i8))) << "v=" << v;
+            ASSERT_EQ(std::trunc(exact), (s2shr<Rounding::towardZero, from, to, int8_t>(i8))) << "v=" << v;
+            ASSERT_EQ(std::floor(exact + 0.5), (s2shr<Rounding::nearest, from, to, int8_t>(i8))) << "v=" << v;
+            ASSERT_EQ(std::nearbyint(exact), (s2shr<Rounding::convergent, from, to, int8_t>(i8))) << "v=" << v;  // ties to even
+        }
+    };
+    check(std::integral_constant<int, 1>{});
+    check(std::integral_constant<int, 3>{});
+    check(std::integral_constant<int, 7>{});
+}
+
+TEST_F(S2STest, s2shr__int32_limits__no_overflow_in_same_type) {
+    ASSERT_EQ(INT32_MAX / 16 + 1, (s2shr<Rounding::nearest, 4, 0, int32_t>(INT32_MAX)));
+    ASSERT_EQ(INT32_MAX / 16 + 1, (s2shr<Rounding::convergent, 4, 0, int32_t>(INT32_MAX)));
+    ASSERT_EQ(INT32_MIN / 16, (s2shr<Rounding::towardZero, 4, 0, int32_t>(INT32_MIN)));
+    ASSERT_EQ(UINT32_MAX / 16u + 1u, (s2shr<Rounding::nearest, 4, 0, uint32_t>(UINT32_MAX)));
+}
+
+TEST_F(S2STest, s2s__constexpr_rounding__selected_mode_applied) {
+    constexpr int16_t value = -514;  // -32.125 at scaling 4
+    static_assert(s2s<8, 4, int>(value) == -33);  // default: floor
+    static_assert(s2s<8, 4, int, Rounding::towardZero>(value) == -32);
+    static_assert(s2s<8, 4, int, Rounding::nearest>(value) == -32);
+    static_assert(s2s<8, 4, int, Rounding::convergent>(int16_t(-520)) == -32);  // -32.5 -> even
+    static_assert(s2s<4, 8, int, Rounding::nearest>(value) == -514 * 16);  // up-scaling is exact
+}
+
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ------------------------------------ V2S Test ------------------------------------------------ //
@@ -0,0 +1,86 @@
+/* \file
+ * Tests for lut.hpp.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ Lut Test: Lookup ---------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class LutTest_Lookup : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    /// Gamma correction curve x^(1/2.2).
+    using gamma_t = fpm::Lut< u16sq12<0., 1.>, u16sq12<0., 1.>, 64u,
+        [](double x) consteval { return (0. < x) ? fpm::detail::exp2(fpm::detail::log2(x) / 2.2) : 0.; } >;
+    /// Cubic curve on a signed range whose span is not a power of 2.
+    using cubic_t = fpm::Lut< i32sq16<-3., 5.>, i32sq16<-30., 130.>, 256u,
+        [](double x) consteval { return x*x*x; } >;
+    /// Linear function, which is interpolated exactly.
+    using linear_t = fpm::Lut< i16sq8<-4., 4.>, i16sq8<-10., 10.>, 16u,
+        [](double x) consteval { return 2.*x + 1.; } >;
+};
+
+TEST_F(LutTest_Lookup, lut_table__gamma__size_and_borders) {
+    ASSERT_EQ(64u, gamma_t::segments);
+    ASSERT_EQ((64u + 2u) * sizeof(uint16_t), gamma_t::size);
+    ASSERT_EQ(0, gamma_t::table[0]);
+    ASSERT_EQ(4096, gamma_t::table[64]);
+    ASSERT_EQ(4096, gamma_t::table[65]);  // repeated last border
+}
+
+TEST_F(LutTest_Lookup, lut_lookup__gamma__deviation_within_max_error) {
+    constexpr gamma_t gamma{};
+    double maxError = 0.;
+    for (uint16_t scaled = 0u; scaled <= 4096u; ++scaled) {
+        auto x = u16q12<0., 1.>::construct(scaled);
+
+        auto y = gamma(x);  // Q is converted to Sq
+
+        ASSERT_TRUE(( std::is_same_v<u16sq12<0., 1.>, decltype(y)> ));
+        maxError = std::max(maxError, std::fabs(std::pow(x.real(), 1. / 2.2) - y.real()));
+    }
+    // the error is estimated at compile-time from 8 points per segment
+    ASSERT_NEAR(gamma_t::maxError, maxError, 0.1 * gamma_t::maxError);
+}
+
+TEST_F(LutTest_Lookup, lut_lookup__cubic__close_to_function) {
+    constexpr cubic_t cubic{};
+    for (int32_t scaled = cubic_t::in_t::scaledMin; scaled <= cubic_t::in_t::scaledMax; scaled += 97) {
+        auto x = i32q16<-3., 5.>::construct(scaled);
+
+        auto y = cubic(x);
+
+        ASSERT_NEAR(x.real() * x.real() * x.real(), y.real(), 1.01 * cubic_t::maxError) << x.real();
+    }
+    ASSERT_LT(cubic_t::maxError, 0.004);
+}
+
+TEST_F(LutTest_Lookup, lut_lookup__linear__exact) {
+    constexpr linear_t linear{};
+    for (int16_t scaled = linear_t::in_t::scaledMin; scaled <= linear_t::in_t::scaledMax; ++scaled) {
+        auto x = i16q8<-4., 4.>::construct(scaled);
+
+        ASSERT_EQ(2 * scaled + 256, linear(x).scaled()) << x.real();
+    }
+    ASSERT_EQ(0., linear_t::maxError);
+}
+
+TEST_F(LutTest_Lookup, lut_lookup__constexpr__evaluated_at_compile_time) {
+    constexpr auto y = linear_t{}( i16sq8<-4., 4.>::fromReal<1.5>() );
+
+    static_assert(y.scaled() == 4 * 256);
+}
@@ -0,0 +1,99 @@
+/* \file
+ * Tests for the range profiler. Built as a separate executable with FPM_RANGE_PROFILER.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// --------------------------------- Profiler Test: Range --------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class ProfilerTest_Range : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    /// \returns the report written by rangeProfileReport.
+    static std::string report() {
+        char buffer[4096] = {};
+        std::FILE *out = fmemopen(buffer, sizeof(buffer) - 1u, "w");
+        fpm::rangeProfileReport(out);
+        std::fclose(out);
+        return std::string(buffer);
+    }
+};
+
+TEST_F(ProfilerTest_Range, profiler__enabled__compiled_in) {
+    ASSERT_TRUE(fpm::rangeProfilerEnabled);
+}
+
+TEST_F(ProfilerTest_Range, profiler_construct__runtime_values__range_and_resolution_recorded) {
+    using q_t = i32q16<-1000., 1000.>;
+    std::vector<int32_t> const scaled{ -20 * 65536, 3 * 65536 + 16384, 19 * 65536 + 49152 };  // resolution 2^-2
+    for (auto s : scaled) { (void)q_t::construct(s); }
+
+    auto entry = fpm::rangeProfileOf<q_t>();
+    ASSERT_EQ(3u, entry.count);
+    ASSERT_EQ(-20 * 65536, entry.min);
+    ASSERT_EQ(19 * 65536 + 49152, entry.max);
+    ASSERT_EQ(2, entry.fUsed);
+
+    auto rec = fpm::rangeProfileRecommendation(entry);
+    ASSERT_EQ(sizeof(int8_t), rec.baseSize);  // 20 * 2^2 = 80 fits into 7 bits
+    ASSERT_EQ(2, rec.f);
+    ASSERT_EQ(-20., rec.realMin);
+    ASSERT_EQ(19.75, rec.realMax);
+}
+
+TEST_F(ProfilerTest_Range, profiler_fromSq_and_mac__values_recorded_for_target_type) {
+    using q_t = i32q20<-100., 100., fpm::Ovf::clamp>;
+    auto a = i32sq20<-5., 5.>::fromReal<2.5>();
+    auto b = i32sq20<-5., 5.>::fromReal<-4.5>();
+
+    auto acc = q_t::fromSq(a);
+    acc.mac(a, b);
+
+    auto entry = fpm::rangeProfileOf<q_t>();
+    ASSERT_EQ(2u, entry.count);
+    ASSERT_DOUBLE_EQ(-8.75, std::ldexp(static_cast<double>(entry.min), -entry.f));
+    ASSERT_DOUBLE_EQ(2.5, std::ldexp(static_cast<double>(entry.max), -entry.f));
+
+    auto rec = fpm::rangeProfileRecommendation(entry);
+    ASSERT_EQ(sizeof(int8_t), rec.baseSize);  // -8.75 needs 6 bits at resolution 2^-2
+    ASSERT_EQ(3, rec.f);  // one spare bit
+}
+
+TEST_F(ProfilerTest_Range, profiler_recommendation__range_needs_full_width__no_narrower_type) {
+    using q_t = i16q8<-128., 127.>;
+    (void)q_t::construct(-127 * 256 + 1);
+    (void)q_t::construct(1);
+
+    auto rec = fpm::rangeProfileRecommendation( fpm::rangeProfileOf<q_t>() );
+    ASSERT_EQ(sizeof(int16_t), rec.baseSize);
+    ASSERT_EQ(8, rec.f);
+}
+
+TEST_F(ProfilerTest_Range, profiler_report__recorded_type__narrower_type_suggested) {
+    using q_t = u32q16<0., 1000.>;
+    (void)q_t::construct(20 * 65536);
+    (void)q_t::construct(65536 / 4);
+
+    auto const text = report();
+
+    ASSERT_NE(std::string::npos, text.find("u32q16<0., 1000.>: 2 values in [0.25, 20], resolution 2^-2 -> u8q3<0.25, 20.>"))
+        << text;
+}
+
+// EOF
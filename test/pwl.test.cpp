@@ -0,0 +1,106 @@
+/* \file
+ * Tests for pwl.hpp.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+using fpm::Knot;
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ Pwl Test: Evaluation ------------------------------------ //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class PwlTest_Evaluation : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    /// Sensor curve with 4 knots, which is evaluated by counting the knots below x.
+    using curve_t = fpm::Pwl< i16sq8<-10., 10.>, i16sq8<-50., 50.>,
+        Knot{-4., -20.}, Knot{0., 0.}, Knot{1., 10.}, Knot{5., 12.} >;
+    /// Calibration curve with 17 knots clustered near zero, which is evaluated with a binary search.
+    using calib_t = fpm::Pwl< i32sq16<-1., 1.>, i32sq16<-2., 2.>,
+        Knot{-1., -1.5}, Knot{-0.5, -1.1}, Knot{-0.25, -0.8}, Knot{-0.125, -0.5}, Knot{-0.0625, -0.3},
+        Knot{-0.03125, -0.17}, Knot{-0.015625, -0.09}, Knot{-0.0078125, -0.045}, Knot{0., 0.},
+        Knot{0.0078125, 0.045}, Knot{0.015625, 0.09}, Knot{0.03125, 0.17}, Knot{0.0625, 0.3},
+        Knot{0.125, 0.5}, Knot{0.25, 0.8}, Knot{0.5, 1.1}, Knot{1., 1.5} >;
+
+    /// \returns the exact linear interpolation between the knots of the given Pwl type.
+    template< class Pwl >
+    static double interpolate(double x) {
+        for (std::size_t i = 0u; i + 1u < Pwl::nKnots; ++i) {
+            double const x0 = fpm::real<Pwl::x_t::f>(Pwl::xs[i]), x1 = fpm::real<Pwl::x_t::f>(Pwl::xs[i + 1u]);
+            double const y0 = fpm::real<Pwl::y_t::f>(Pwl::ys[i]), y1 = fpm::real<Pwl::y_t::f>(Pwl::ys[i + 1u]);
+            if (x <= x1 || i + 2u == Pwl::nKnots) {
+                double const xc = std::clamp(x, fpm::real<Pwl::x_t::f>(Pwl::xs.front()), fpm::real<Pwl::x_t::f>(Pwl::xs.back()));
+                return y0 + (xc - x0) * (y1 - y0) / (x1 - x0);
+            }
+        }
+        return 0.;
+    }
+};
+
+TEST_F(PwlTest_Evaluation, pwl_knots__scaled_values_and_slopes) {
+    ASSERT_EQ(4u, curve_t::nKnots);
+    ASSERT_EQ((std::array<int16_t, 4>{ -1024, 0, 256, 1280 }), curve_t::xs);
+    ASSERT_EQ((std::array<int16_t, 4>{ -5120, 0, 2560, 3072 }), curve_t::ys);
+    ASSERT_EQ(5 * (int64_t(1) << curve_t::SLOPE_F), curve_t::slopes[0]);
+    ASSERT_EQ(0, curve_t::slopes[3]);  // last knot
+}
+
+TEST_F(PwlTest_Evaluation, pwl_eval__at_knots__exact) {
+    constexpr curve_t curve{};
+
+    ASSERT_EQ(-5120, curve( i16sq8<-10., 10.>::fromReal<-4.>() ).scaled());
+    ASSERT_EQ(0, curve( i16sq8<-10., 10.>::fromReal<0.>() ).scaled());
+    ASSERT_EQ(2560, curve( i16sq8<-10., 10.>::fromReal<1.>() ).scaled());
+    ASSERT_EQ(3072, curve( i16sq8<-10., 10.>::fromReal<5.>() ).scaled());
+}
+
+TEST_F(PwlTest_Evaluation, pwl_eval__outside_of_knots__limited_to_first_and_last_knot) {
+    constexpr curve_t curve{};
+
+    ASSERT_EQ(-5120, curve( i16sq8<-10., 10.>::fromReal<-10.>() ).scaled());
+    ASSERT_EQ(3072, curve( i16sq8<-10., 10.>::fromReal<9.5>() ).scaled());
+}
+
+TEST_F(PwlTest_Evaluation, pwl_eval__few_knots__close_to_interpolation) {
+    constexpr curve_t curve{};
+    for (int16_t scaled = curve_t::x_t::scaledMin; scaled < curve_t::x_t::scaledMax; ++scaled) {
+        auto x = i16q8<-10., 10.>::construct(scaled);
+
+        auto y = curve(x);  // Q is converted to Sq
+
+        ASSERT_TRUE(( std::is_same_v<i16sq8<-50., 50.>, decltype(y)> ));
+        ASSERT_NEAR(interpolate<curve_t>(x.real()), y.real(), curve_t::y_t::resolution) << x.real();
+    }
+}
+
+TEST_F(PwlTest_Evaluation, pwl_eval__17_knots__close_to_interpolation_and_monotonic) {
+    constexpr calib_t calib{};
+    int32_t previous = calib_t::ys.front();
+    for (int32_t scaled = calib_t::x_t::scaledMin; scaled <= calib_t::x_t::scaledMax; scaled += 7) {
+        auto x = i32q16<-1., 1.>::construct(scaled);
+
+        auto y = calib(x);
+
+        ASSERT_NEAR(interpolate<calib_t>(x.real()), y.real(), calib_t::y_t::resolution) << x.real();
+        ASSERT_LE(previous, y.scaled()) << x.real();
+        previous = y.scaled();
+    }
+}
+
+TEST_F(PwlTest_Evaluation, pwl_eval__constexpr__evaluated_at_compile_time) {
+    constexpr auto y = curve_t{}( i16sq8<-10., 10.>::fromReal<-2.>() );
+
+    static_assert(y.scaled() == -2560);
+}
@@ -4,8 +4,12 @@
 
 #include <gtest/gtest.h>
 
-#include <iostream>
+#include <array>
 #include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <vector>
 
 #include <fpm.hpp>
 using namespace fpm::types;
@@ -61,11 +65,29 @@ concept SafeCastable = requires (QSrc qSrc) {
     { safe_q_cast<QTarget, ovfBx>(qSrc) } -> std::same_as<QTarget>;
 };
 
+/// Concept which checks whether the product of the given Sq types can be accumulated into the given
+/// Q type.
+template< class Q, class SqA, class SqB, fpm::Overflow ovfBxOvrd = Q::ovfBx >
+concept MultiplyAccumulatable = requires (Q acc, SqA a, SqB b) {
+    { acc.template mac<ovfBxOvrd>(a, b) } -> std::same_as<Q&>;
+};
+
+
+/// Concept which checks whether the given Sq type can be added to the given Q type with saturation.
+template< class Q, class SqRhs >
+concept SaturatingAddable = requires (Q acc, SqRhs rhs) {
+    { acc.saturatingAdd(rhs) } -> std::same_as<Q&>;
+};
+
 
 // Implement assert trap function for manual tests.
 void fpm::ovfAssertTrap() {
     assert(false);
 }
+void fpm::ovfAssertTrap(std::size_t index) {
+    std::cerr << "overflow at index " << index << std::endl;
+    std::abort();
+}
 
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
@@ -339,6 +361,86 @@ TEST_F(QTest_Construct, q_construct__variable_positive_int16_positiveF_overflow_
     ASSERT_NEAR(real, qValueOvf.real(), i16q6_ovf_t::resolution);
 }
 
+TEST_F(QTest_Construct, q_construct_range__values_within_range__same_values_as_construct) {
+    std::array<int16_t, 19u> values;
+    for (std::size_t i = 0u; i < values.size(); ++i) { values[i] = static_cast<int16_t>(3333 * static_cast<int>(i) - 31000); }
+    std::vector<i16q6_t> qValues(values.size(), i16q6_t::fromReal<0.>());
+
+    auto first = i16q6_t::constructRange<fpm::Ovf::assert>(std::span<int16_t const>(values), std::span<i16q6_t>(qValues));
+
+    ASSERT_EQ(values.size(), first);
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        ASSERT_EQ(i16q6_t::construct<fpm::Ovf::assert>(values[i]).scaled(), qValues[i].scaled());
+    }
+}
+
+TEST_F(QTest_Construct, q_construct_range__values_out_of_range_clamp__clamped_values_and_first_index) {
+    std::array<int16_t, 37u> values;
+    for (std::size_t i = 0u; i < values.size(); ++i) { values[i] = static_cast<int16_t>(900 * static_cast<int>(i)); }
+    values[21] = -32001;  // below limit; values from index 36 are above limit
+    std::vector<i16q6_t> qValues(values.size(), i16q6_t::fromReal<0.>());
+    std::vector<i16q6_clamp_t> qValuesClamp(values.size(), i16q6_clamp_t::fromReal<0.>());
+
+    auto first = i16q6_t::constructRange<fpm::Ovf::clamp>(std::span<int16_t const>(values), std::span<i16q6_t>(qValues));
+    auto firstClamp = i16q6_clamp_t::constructRange(std::span<int16_t const>(values), std::span<i16q6_clamp_t>(qValuesClamp));
+
+    ASSERT_EQ(21u, first);
+    ASSERT_EQ(21u, firstClamp);
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        ASSERT_EQ(i16q6_t::construct<fpm::Ovf::clamp>(values[i]).scaled(), qValues[i].scaled());
+        ASSERT_EQ(i16q6_clamp_t::construct(values[i]).scaled(), qValuesClamp[i].scaled());
+    }
+    ASSERT_EQ(i16q6_t::scaledMin, qValues[21].scaled());
+    ASSERT_EQ(i16q6_t::scaledMax, qValues[36].scaled());
+}
+
+TEST_F(QTest_Construct, q_construct_range__output_range_smaller__only_output_range_constructed) {
+    std::array<int16_t, 5u> values = { 100, 200, 300, 32500, 400 };
+    std::vector<i16q6_clamp_t> qValues(3u, i16q6_clamp_t::fromReal<0.>());
+
+    auto first = i16q6_clamp_t::constructRange(std::span<int16_t const>(values), std::span<i16q6_clamp_t>(qValues));
+
+    ASSERT_EQ(3u, first);  // value at index 3 is not processed
+    ASSERT_EQ(300, qValues[2].scaled());
+}
+
+TEST_F(QTest_Construct, q_construct_range__in_place_clamp__clamped_values_and_first_index) {
+    std::vector<i16q6_ovf_t> raw;
+    for (int i = 0; i < 23; ++i) { raw.push_back( i16q6_ovf_t::construct( static_cast<int16_t>(-3000 * i) ) ); }
+    std::vector<i16q6_clamp_t> qValues;
+    for (auto const &r : raw) { qValues.push_back( i16q6_clamp_t::construct<fpm::Ovf::unchecked>(r.scaled()) ); }
+
+    auto first = i16q6_clamp_t::constructRange(std::span<i16q6_clamp_t>(qValues));
+
+    ASSERT_EQ(11u, first);  // -33000 < -32000
+    for (std::size_t i = 0u; i < raw.size(); ++i) {
+        ASSERT_EQ(i16q6_clamp_t::construct(raw[i].scaled()).scaled(), qValues[i].scaled());
+    }
+}
+
+TEST_F(QTest_Construct, q_construct_range__value_out_of_range_unchecked__values_copied) {
+    std::array<int16_t, 3u> values = { -32768, 0, 32767 };
+    std::vector<i16q6_t> qValues(values.size(), i16q6_t::fromReal<0.>());
+
+    auto n = i16q6_t::constructRange<fpm::Ovf::unchecked>(std::span<int16_t const>(values), std::span<i16q6_t>(qValues));
+
+    ASSERT_EQ(values.size(), n);
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], qValues[i].scaled());
+    }
+}
+
+TEST_F(QTest_Construct, q_construct_range__value_out_of_range_assert__trap_called_with_first_index) {
+    std::array<int16_t, 40u> values{};
+    values[29] = 32001;
+    values[35] = -32001;
+    std::vector<i16q6_t> qValues(values.size(), i16q6_t::fromReal<0.>());
+
+    ASSERT_DEATH(
+        i16q6_t::constructRange<fpm::Ovf::assert>(std::span<int16_t const>(values), std::span<i16q6_t>(qValues)),
+        "overflow at index 29");
+}
+
 TEST_F(QTest_Construct, q_construct_via_literal__int_value_positive__expected_value) {
     i16q6_t qValue = 481_i16q6;
 
@@ -347,6 +449,25 @@ TEST_F(QTest_Construct, q_construct_via_literal__int_value_positive__expected_va
     ASSERT_NEAR(481., qValue.real(), i16q6_t::resolution);
 }
 
+TEST_F(QTest_Construct, q_from_real__constexpr_int64_largeF__expected_value) {
+    using i64q48_t = i64q48<-20000., 20000.>;
+    auto qValue = i64q48_t::fromReal<-12345.6789>();
+
+    constexpr int64_t resultMemValue = -3474999680854737408;  // -12345.6789 * 2^48
+    ASSERT_EQ(resultMemValue, qValue.scaled());
+    ASSERT_NEAR(-12345.6789, qValue.real(), i64q48_t::resolution);
+}
+
+TEST_F(QTest_Construct, q_from_real__int64_limits__exactly_representable_by_double) {
+    // 64-bit limits are rounded towards zero to a value that double can represent exactly
+    constexpr int64_t expectedMax = 0x7FFFFFFFFFFFFC00;
+    constexpr uint64_t expectedUMax = 0xFFFFFFFFFFFFF800u;
+    ASSERT_EQ(-expectedMax, i64q0<>::scaledMin);
+    ASSERT_EQ(+expectedMax, i64q0<>::scaledMax);
+    ASSERT_EQ(expectedUMax, u64q0<>::scaledMax);
+    ASSERT_EQ(+expectedMax, i64q0<>::fromReal<i64q0<>::realMax>().scaled());
+}
+
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ------------------------------------ Q Test: Related Sq -------------------------------------- //
@@ -516,6 +637,98 @@ TEST_F(QTest_Sq, q_from_sq__different_value_range_overflow_allowed__q_value_can_
     ASSERT_NEAR(+real, qValuePOvf2.real(), i32q20_ovf_t::resolution);
 }
 
+TEST_F(QTest_Sq, q_mac__sum_of_products_within_range__same_result_as_fma) {
+    auto acc = i32q20_t::fromReal<0.>();
+    auto a = i32q20<-10., 10.>::Sq<>::fromReal<-3.3>();
+    auto b = i32q20<-10., 10.>::Sq<>::fromReal<2.7>();
+
+    acc.mac<fpm::Ovf::clamp>(a, b);
+    auto expected = fma(a, b, i32q20_t::fromReal<0.>().toSq());
+    ASSERT_EQ(expected.scaled(), acc.scaled());
+
+    acc.mac<fpm::Ovf::clamp>(a, b).mac<fpm::Ovf::clamp>(a, a);
+
+    ASSERT_NEAR(2*-3.3*2.7 + 3.3*3.3, acc.real(), 20*i32q20_t::resolution);
+}
+
+TEST_F(QTest_Sq, q_mac__sum_of_products_exceeds_range__clamped) {
+    auto acc = i32q20_clamp_t::fromReal<480.>();
+    auto a = i32q20<-10., 10.>::Sq<>::fromReal<9.5>();
+
+    acc.mac(a, a);
+
+    ASSERT_EQ(i32q20_clamp_t::scaledMax, acc.scaled());
+}
+
+TEST_F(QTest_Sq, q_mac__overflow_forbidden__does_not_compile) {
+    using sq_t = i32q20<-1., 1.>::Sq<>;
+
+    ASSERT_FALSE(( MultiplyAccumulatable<i32q20_t, sq_t, sq_t> ));  // accumulation can always overflow
+    ASSERT_TRUE(( MultiplyAccumulatable<i32q20_clamp_t, sq_t, sq_t> ));
+    ASSERT_TRUE(( MultiplyAccumulatable<i32q20_t, sq_t, sq_t, fpm::Ovf::assert> ));
+}
+
+TEST_F(QTest_Sq, q_saturatingAdd__within_range__same_result_as_addition) {
+    auto acc = i16q8<-100., 100.>::fromReal<-12.5>();
+    auto a = i16q8<-100., 100.>::Sq<>::fromReal<30.25>();
+    auto b = i16q4<-50., 50.>::fromReal<-7.5>();
+
+    acc.saturatingAdd(a).saturatingSub(b);
+
+    ASSERT_DOUBLE_EQ(-12.5 + 30.25 + 7.5, acc.real());
+}
+
+TEST_F(QTest_Sq, q_from_sq__down_scaling_rounds_beyond_range__overflow_checked) {
+    using fpm::Rnd;
+    auto sqValue = i16sq4<-0.99, 0.99>::fromReal<-0.9375>();  // -3.75 scaled by 2^2
+
+    auto qNative = i16q2<-0.99, 0.99, fpm::Ovf::clamp, Rnd::native>::fromSq(sqValue);
+    auto qTowardZero = i16q2<-0.99, 0.99, fpm::Ovf::clamp, Rnd::towardZero>::fromSq(sqValue);
+    auto qNearest = i16q2<-0.99, 0.99, fpm::Ovf::clamp, Rnd::nearest>::fromSq(sqValue);
+    auto qNearestMax = i16q2<-0.99, 0.99, fpm::Ovf::clamp, Rnd::nearest>::fromSq(-sqValue);
+
+    EXPECT_EQ(-4, qNative.scaled());
+    EXPECT_EQ(-3, qTowardZero.scaled());
+    EXPECT_EQ(-3, qNearest.scaled());  // rounded to -4, clamped
+    EXPECT_EQ(3, qNearestMax.scaled());  // rounded to 4, clamped
+    EXPECT_FALSE(( std::is_convertible_v<decltype(sqValue), i16q2<-0.99, 0.99, fpm::Ovf::error, Rnd::nearest>> ));
+    EXPECT_TRUE(( std::is_convertible_v<decltype(sqValue), i16q2<-0.99, 0.99, fpm::Ovf::error, Rnd::native>> ));
+}
+
+TEST_F(QTest_Sq, q_saturatingAdd__range_of_q_exceeded__clamped_to_q_limits) {
+    auto acc = i16q8<-100., 100.>::fromReal<90.>();
+    auto a = i16q8<-100., 100.>::Sq<>::fromReal<20.>();
+
+    acc.saturatingAdd(a);
+    ASSERT_EQ((i16q8<-100., 100.>::scaledMax), acc.scaled());
+
+    acc.saturatingSub(a).saturatingSub(a).saturatingSub(a).saturatingSub(a).saturatingSub(a)
+        .saturatingSub(a).saturatingSub(a).saturatingSub(a).saturatingSub(a).saturatingSub(a);
+    ASSERT_EQ((i16q8<-100., 100.>::scaledMin), acc.scaled());
+}
+
+TEST_F(QTest_Sq, q_saturatingAdd__base_type_overflows__clamped_to_limits) {
+    auto acc = i16q8<>::fromReal<120.>();
+    auto a = i16q8<>::Sq<>::fromReal<100.>();
+
+    acc.saturatingAdd(a);
+    ASSERT_EQ(i16q8<>::scaledMax, acc.scaled());
+
+    acc.saturatingSub(a).saturatingSub(a).saturatingSub(a).saturatingSub(a);
+    ASSERT_EQ(i16q8<>::scaledMin, acc.scaled());
+
+    auto uacc = u16q8<>::fromReal<10.>();
+    uacc.saturatingSub( u16q8<>::Sq<>::fromReal<20.>() );
+    ASSERT_EQ(0u, uacc.scaled());
+}
+
+TEST_F(QTest_Sq, q_saturatingAdd__rhs_not_representable_in_base_type__does_not_compile) {
+    ASSERT_TRUE(( SaturatingAddable< i16q8<>, i16sq4<-100., 100.> > ));
+    ASSERT_FALSE(( SaturatingAddable< i16q8<>, i16sq10<-10., 10.> > ));  // larger scaling
+    ASSERT_FALSE(( SaturatingAddable< i16q8<>, i32sq8<-200., 200.> > ));  // range exceeds base type
+    ASSERT_FALSE(( SaturatingAddable< u16q8<>, i16sq8<-10., 10.> > ));  // negative rhs for unsigned type
+}
+
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ---------------------------------- Q Test: Copy & Scale -------------------------------------- //
@@ -1959,4 +2172,25 @@ TEST_F(QTest_Casting, q_force_cast__negative_scaled_value__smaller_unsigned_type
     ASSERT_TRUE((std::is_same_v<u16q6_ovf_t, decltype(b)>));
 }
 
+TEST_F(QTest_Casting, q_static_cast__large_real_value_int64__smaller_signed_type_smallerF_clamped_value) {
+    using i64q40_t = i64q40<-1.e6, 1.e6>;
+    using i32q16_t = i32q16<-1000., 1000.>;
+    auto a = i64q40_t::fromReal<+654321.5>();
+    auto b = static_q_cast<i32q16_t, fpm::Ovf::clamp>(a);
+    auto c = static_q_cast<i32q16_t, fpm::Ovf::clamp>(i64q40_t::fromReal<-654321.5>());
+
+    ASSERT_NEAR(i32q16_t::realMax, b.real(), i32q16_t::resolution);
+    ASSERT_NEAR(i32q16_t::realMin, c.real(), i32q16_t::resolution);
+}
+
+TEST_F(QTest_Casting, q_static_cast__negative_real_value_int32__larger_unsigned_type_largerF_clamped_value) {
+    using i32q16_t = i32q16<-1000., 1000.>;
+    auto a = i32q16_t::fromReal<-498.7>();
+    auto b = static_q_cast<u64q40<>, fpm::Ovf::clamp>(a);
+    auto c = static_q_cast<u64q40<>, fpm::Ovf::clamp>(i32q16_t::fromReal<+498.7>());
+
+    ASSERT_NEAR(0., b.real(), u64q40<>::resolution);
+    ASSERT_NEAR(498.7, c.real(), i32q16_t::resolution);
+}
+
 // EOF
@@ -0,0 +1,149 @@
+/* \file
+ * Tests for reciprocal.hpp.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+
+
+/// Concept which checks whether a value of the given Sq or Q type can be divided by the reciprocal
+/// of the given Sq divisor type.
+template< class Lhs, class SqDivisor >
+concept ReciprocalDivisible = requires (Lhs lhs, fpm::Reciprocal<SqDivisor> rhs) {
+    lhs / rhs;
+};
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ Reciprocal Test: Division ------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class ReciprocalTest_Division : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    /// Checks that the quotient via reciprocal has the same type as the exact quotient, and that
+    /// its magnitude is either exact or one resolution step larger.
+    template< class SqLhs, class SqDivisor >
+    void expectQuotientWithinBound(SqLhs const &lhs, SqDivisor const &divisor) {
+        auto exact = lhs / divisor;
+        auto quotient = lhs / fpm::Reciprocal(divisor);
+
+        ASSERT_TRUE(( std::is_same_v<decltype(exact), decltype(quotient)> ));
+        auto const exactMagnitude = std::abs(static_cast<int64_t>(exact.scaled()));
+        auto const magnitude = std::abs(static_cast<int64_t>(quotient.scaled()));
+        ASSERT_TRUE(exactMagnitude == magnitude || exactMagnitude + 1 == magnitude)
+            << lhs.scaled() << " / " << divisor.scaled() << ": " << exact.scaled() << " vs " << quotient.scaled();
+        ASSERT_TRUE(exact.scaled() == 0 || (exact.scaled() < 0) == (quotient.scaled() < 0));
+    }
+};
+
+TEST_F(ReciprocalTest_Division, reciprocal_divide__positive_divisor__result_within_bound) {
+    using lhs_t = i32q16<-30000., 30000.>;
+    using divisor_t = i32q16<1., 30000.>;
+    constexpr std::array<int32_t, 7> lhsValues = { -1966080000, -1234567890, -65536, -1, 0, 77777, 1966080000 };
+    constexpr std::array<int32_t, 6> divisorValues = { 65536, 65537, 100000, 3333333, 123456789, 1966080000 };
+
+    for (auto lv : lhsValues) {
+        for (auto dv : divisorValues) {
+            expectQuotientWithinBound( lhs_t::construct(lv).toSq(), divisor_t::construct(dv).toSq() );
+        }
+    }
+}
+
+TEST_F(ReciprocalTest_Division, reciprocal_divide__negative_divisor_different_f__result_within_bound) {
+    using lhs_t = i32q20<-1000., 1000.>;
+    using divisor_t = i32q16<-2000., -1.>;
+    constexpr std::array<int32_t, 5> lhsValues = { -1048576000, -3, 0, 524288, 1048576000 };
+    constexpr std::array<int32_t, 4> divisorValues = { -65536, -65537, -1000000, -131072000 };
+
+    for (auto lv : lhsValues) {
+        for (auto dv : divisorValues) {
+            expectQuotientWithinBound( lhs_t::construct(lv).toSq(), divisor_t::construct(dv).toSq() );
+        }
+    }
+}
+
+TEST_F(ReciprocalTest_Division, reciprocal_divide__exact_quotient__same_value_as_division) {
+    auto a = i32sq16<-100., 100.>::fromReal<-75.>();
+    auto b = i32sq16<1., 10.>::fromReal<2.5>();
+
+    auto quotient = a / fpm::Reciprocal(b);
+
+    ASSERT_TRUE(( std::is_same_v<decltype(a / b), decltype(quotient)> ));
+    ASSERT_EQ((a / b).scaled(), quotient.scaled());
+    ASSERT_NEAR(-30., quotient.real(), quotient.resolution);
+}
+
+TEST_F(ReciprocalTest_Division, reciprocal_divide__q_lhs__same_type_as_sq_division) {
+    auto a = i16q8<-100., 100.>::fromReal<50.>();
+    auto b = i16sq8<1., 10.>::fromReal<4.>();
+
+    auto quotient = a / fpm::Reciprocal(b);
+
+    ASSERT_TRUE(( std::is_same_v<decltype(a.toSq() / b), decltype(quotient)> ));
+    ASSERT_NEAR(12.5, quotient.real(), quotient.resolution);
+}
+
+TEST_F(ReciprocalTest_Division, reciprocal_divide_range__q_values__same_values_as_scalar_division) {
+    using lhs_t = i32q16<-100., 100.>;
+    using out_t = i32q16<-100., 100.>;
+    std::vector<lhs_t> values;
+    for (int i = 0; i < 21; ++i) { values.push_back( lhs_t::construct(655360 * (i - 10) + 12345 * i) ); }
+    std::vector<out_t> out(values.size(), out_t::fromReal<0.>());
+    fpm::Reciprocal const reciprocal( i32sq16<1., 10.>::fromReal<3.>() );
+
+    auto n = reciprocal.divide(std::span<lhs_t const>(values), std::span<out_t>(out));
+
+    ASSERT_EQ(values.size(), n);
+    for (std::size_t i = 0u; i < n; ++i) {
+        ASSERT_EQ((values[i] / reciprocal).scaled(), out[i].scaled());
+    }
+}
+
+TEST_F(ReciprocalTest_Division, reciprocal_divide__rounding_modes__rounded_like_division) {
+    auto check = [this]<fpm::Rounding rnd>() {
+        using lhs_t = i32q4<-100., 100., fpm::Ovf::error, rnd>;
+        using divisor_t = i32q4<-10., -1.>;
+        for (int32_t lv = -1600; lv <= 1600; lv += 7) {
+            for (int32_t dv : { -160, -48, -37, -16 }) {
+                expectQuotientWithinBound( lhs_t::construct(lv).toSq(), divisor_t::construct(dv).toSq() );
+            }
+        }
+        // the reciprocal of a power of 2 is exact, thus ties are rounded like the division operator
+        auto const divisor = divisor_t::template fromReal<-2.>().toSq();
+        for (int32_t lv : { -1600, -24, -8, -1, 1, 8, 24, 1600 }) {
+            auto const lhs = lhs_t::construct(lv).toSq();
+            ASSERT_EQ( (lhs / divisor).scaled(), (lhs / fpm::Reciprocal(divisor)).scaled() ) << lv;
+        }
+    };
+    check.template operator()<fpm::Rounding::native>();
+    check.template operator()<fpm::Rounding::towardZero>();
+    check.template operator()<fpm::Rounding::nearest>();
+    check.template operator()<fpm::Rounding::convergent>();
+
+    // -1/16 / -2 = 1/32 is half a resolution step, which is rounded up with nearest
+    auto const half = i32sq4<-100., 100., fpm::Rounding::nearest>::fromScaled<-1>() / fpm::Reciprocal(i32sq4<-10., -1.>::fromReal<-2.>());
+    ASSERT_EQ(1, half.scaled());
+}
+
+TEST_F(ReciprocalTest_Division, reciprocal_divide__insufficient_precision__does_not_compile) {
+    EXPECT_TRUE(( ReciprocalDivisible< i32sq16<-30000., 30000.>, i32sq16<1., 30000.> > ));
+    EXPECT_TRUE(( ReciprocalDivisible< i32q16<-30000., 30000.>, i32sq16<1., 30000.> > ));
+    // divisor has a higher resolution than the large dividend, quotient needs more bits
+    EXPECT_FALSE(( ReciprocalDivisible< i32sq16<-30000., 30000.>, i32sq20<1., 2000.> > ));
+    // dividend with larger base type than the divisor
+    EXPECT_FALSE(( ReciprocalDivisible< i64sq16<-30000., 30000.>, i32sq16<1., 30000.> > ));
+}
+
+// EOF
@@ -0,0 +1,117 @@
+/* \file
+ * Tests for simd.hpp.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+
+
+/// Concept which checks whether the element-wise addition of the given input types can be stored
+/// in the given output type.
+template< class Lhs, class Rhs, class QOut >
+concept BatchAddable = requires(std::span<Lhs const> lhs, std::span<Rhs const> rhs, std::span<QOut> out) {
+    { fpm::simd::add(lhs, rhs, out) } -> std::same_as<std::size_t>;
+};
+
+/// Concept which checks whether the element-wise multiplication of the given input types can be
+/// stored in the given output type.
+template< class Lhs, class Rhs, class QOut >
+concept BatchMultipliable = requires(std::span<Lhs const> lhs, std::span<Rhs const> rhs, std::span<QOut> out) {
+    { fpm::simd::mul(lhs, rhs, out) } -> std::same_as<std::size_t>;
+};
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ SIMD Test: Batch Kernels -------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class SimdTest_Batch : public ::testing::Test {
+protected:
+    using lhs_t = i32q16<-100., 100.>;
+    using rhs_t = i32q20<-10., 10.>;
+    static constexpr std::size_t N = 37u;  // not a multiple of any lane count, includes scalar tail
+
+    void SetUp() override
+    {
+        for (std::size_t i = 0u; i < N; ++i) {
+            lhs.push_back( lhs_t::construct( static_cast<int32_t>(i * 150001) - 2700000 ) );
+            rhs.push_back( rhs_t::construct( 4100000 - static_cast<int32_t>(i * 190007) ) );
+        }
+    }
+    void TearDown() override
+    {
+    }
+
+    std::vector<lhs_t> lhs;
+    std::vector<rhs_t> rhs;
+};
+
+TEST_F(SimdTest_Batch, simd_add__q_ranges__same_values_as_scalar_operator) {
+    using out_t = i32q20<-110., 110.>;
+    std::vector<out_t> out(N, out_t::fromReal<0.>());
+
+    auto n = fpm::simd::add(std::span<lhs_t const>(lhs), std::span<rhs_t const>(rhs), std::span<out_t>(out));
+
+    ASSERT_EQ(N, n);
+    for (std::size_t i = 0u; i < N; ++i) {
+        out_t const expected = lhs[i] + rhs[i];
+        ASSERT_EQ(expected.scaled(), out[i].scaled());
+    }
+}
+
+TEST_F(SimdTest_Batch, simd_sub__q_ranges__same_values_as_scalar_operator) {
+    using out_t = i32q20<-110., 110.>;
+    std::vector<out_t> out(N, out_t::fromReal<0.>());
+
+    auto n = fpm::simd::sub(std::span<lhs_t const>(lhs), std::span<rhs_t const>(rhs), std::span<out_t>(out));
+
+    ASSERT_EQ(N, n);
+    for (std::size_t i = 0u; i < N; ++i) {
+        out_t const expected = lhs[i] - rhs[i];
+        ASSERT_EQ(expected.scaled(), out[i].scaled());
+    }
+}
+
+TEST_F(SimdTest_Batch, simd_mul__q_ranges__same_values_as_scalar_operator) {
+    using out_t = i32q20<-1000., 1000.>;
+    std::vector<out_t> out(N, out_t::fromReal<0.>());
+
+    auto n = fpm::simd::mul(std::span<lhs_t const>(lhs), std::span<rhs_t const>(rhs), std::span<out_t>(out));
+
+    ASSERT_EQ(N, n);
+    for (std::size_t i = 0u; i < N; ++i) {
+        out_t const expected = lhs[i] * rhs[i];
+        ASSERT_EQ(expected.scaled(), out[i].scaled());
+    }
+}
+
+TEST_F(SimdTest_Batch, simd_div__q_range_by_divisor_range__same_values_as_scalar_operator) {
+    using divisor_t = i32q20<1., 10.>;
+    using out_t = i32q20<-100., 100.>;
+    std::array<divisor_t, 3u> divisors = { 1.5_i32q20, 9.75_i32q20, 3.125_i32q20 };
+    std::vector<out_t> out(N, out_t::fromReal<0.>());
+
+    auto n = fpm::simd::div(std::span<lhs_t const>(lhs), std::span<divisor_t const>(divisors), std::span<out_t>(out));
+
+    ASSERT_EQ(divisors.size(), n);  // only as many elements as the smallest range has
+    for (std::size_t i = 0u; i < n; ++i) {
+        out_t const expected = lhs[i] / divisors[i];
+        ASSERT_EQ(expected.scaled(), out[i].scaled());
+    }
+    ASSERT_EQ(0, out[n].scaled());  // untouched
+}
+
+TEST_F(SimdTest_Batch, simd_kernels__output_range_too_narrow__does_not_compile) {
+    ASSERT_TRUE(( BatchAddable< lhs_t, rhs_t, i32q20<-110., 110.> > ));
+    ASSERT_FALSE(( BatchAddable< lhs_t, rhs_t, i32q20<-100., 100.> > ));  // would need overflow check
+    ASSERT_FALSE(( BatchAddable< lhs_t, rhs_t, i16q4<-110., 110.> > ));  // different base type
+    ASSERT_TRUE(( BatchMultipliable< lhs_t, rhs_t, i32q20<-1000., 1000.> > ));
+    ASSERT_FALSE(( BatchMultipliable< lhs_t, rhs_t, i32q20<-999., 999.> > ));
+}
+
+// EOF
@@ -87,6 +87,48 @@ concept CubeRootable = requires(SqT &sq) {
     { cbrt(sq) } -> fpm::detail::SqType;
 };
 
+template< class SqT >
+concept RCubeRootable = requires(SqT &sq) {
+    { rcbrt(sq) } -> fpm::detail::SqType;
+};
+
+template< class SqT, auto n >
+concept Powerable = requires(SqT &sq) {
+    { pow(sq, std::integral_constant<decltype(n), n>{}) } -> fpm::detail::SqType;
+};
+
+template< class SqT, double... coeffs >
+concept PolyEvaluable = requires(SqT &sq) {
+    { poly<coeffs...>(sq) } -> fpm::detail::SqType;
+};
+
+template< class SqT >
+concept Tangentable = requires(SqT &sq) {
+    { tan(sq) } -> fpm::detail::SqType;
+};
+
+template< class SqT >
+concept TurnTangentable = requires(SqT &sq) {
+    { tan<fpm::TrigEngine::cordic, fpm::AngleUnit::turn>(sq) } -> fpm::detail::SqType;
+};
+
+template< class SqT >
+concept SineComputable = requires(SqT &sq) {
+    { sin(sq) } -> fpm::detail::SqType;
+};
+
+template< class SqT >
+concept Logarithmizable = requires(SqT &sq) {
+    { log2(sq) } -> fpm::detail::SqType;
+    { log(sq) } -> fpm::detail::SqType;
+};
+
+template< class SqT >
+concept Exponentiable = requires(SqT &sq) {
+    { exp2(sq) } -> fpm::detail::SqType;
+    { exp(sq) } -> fpm::detail::SqType;
+};
+
 template< class SqT, class SqL, class SqH >
 concept Clampable = requires(SqT &sq, SqL &lo, SqH &hi) {
     requires fpm::detail::Clampable<SqT, SqL, SqH>;  // avoid fallback to standard library
@@ -805,6 +847,56 @@ TEST_F(SQTest_Multiplication, sq_multiplicate__sq_values_with_negative_integral_
     ASSERT_NEAR(286., f.real(), 100*i32sq16_t::resolution);
 }
 
+TEST_F(SQTest_Multiplication, sq_multiplicate__two_64bit_values_large_f__values_multiplied_in_128bit) {
+    using i64sq40_t = i64sq40<-1000., 1000.>;
+    auto a = i64sq40_t::fromReal< -987.654321 >();
+    auto b = i64sq40_t::fromReal<  876.543210 >();
+
+    auto c = a * b;
+
+    using expected_result_t = i64sq40_t::clamp_t<-1000000., +1000000.>;
+    ASSERT_TRUE((std::is_same_v<expected_result_t, decltype(c)>));
+    ASSERT_NEAR(-865721.68889971, c.real(), 2000*i64sq40_t::resolution);
+}
+
+TEST_F(SQTest_Multiplication, sq_fma__same_sq_types__same_result_as_multiply_add) {
+    using i32sq16_t = i32sq16<-8., 8.>;
+    auto a = i32sq16_t::fromReal< -4.5 >();
+    auto b = i32sq16_t::fromReal<  7./3 >();
+    auto c = i32sq16_t::fromReal<  5./3 >();
+
+    auto d = fma(a, b, c);
+
+    using expected_result_t = decltype(a * b + c);  // same range as the separate operations
+    ASSERT_TRUE((std::is_same_v<expected_result_t, decltype(d)>));
+    ASSERT_EQ((a * b + c).scaled(), d.scaled());
+    ASSERT_NEAR(-4.5*7./3 + 5./3, d.real(), 2*i32sq16_t::resolution);
+}
+
+TEST_F(SQTest_Multiplication, sq_fma__addend_with_higher_resolution__product_not_truncated) {
+    auto a = i32sq4<-10., 10.>::fromScaled< 3 >();  // 0.1875
+    auto b = i32sq4<-10., 10.>::fromScaled< 5 >();  // 0.3125
+    auto c = i32sq8<-1., 1.>::fromScaled< 1 >();  // 1/256
+
+    auto d = fma(a, b, c);
+    auto e = a * b + c;
+
+    ASSERT_TRUE((std::is_same_v<i32sq8<-101., 101.>, decltype(d)>));
+    ASSERT_EQ(16, d.scaled());  // exact: 15/256 + 1/256
+    ASSERT_EQ(1, e.scaled());  // product truncated to 0 before the addition
+}
+
+TEST_F(SQTest_Multiplication, sq_fma__negative_values_different_sq_types__values_multiplied_and_added) {
+    auto a = i16sq8<-100., 100.>::fromReal< -12.25 >();
+    auto b = i32sq16<-10., 10.>::fromReal< 3.5 >();
+    auto c = i32sq20<-50., 50.>::fromReal< -7.125 >();
+
+    auto d = fma(a, b, c);
+
+    ASSERT_TRUE((std::is_same_v<i32sq20<-1050., 1050.>, decltype(d)>));
+    ASSERT_NEAR(-12.25*3.5 - 7.125, d.real(), 2*d.resolution);
+}
+
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ------------------------------------ SQ Test: Division --------------------------------------- //
@@ -930,6 +1022,35 @@ TEST_F(SQTest_Division, sq_divide__two_values_similar_type_and_negative_integral
     ASSERT_NEAR(-0.016232449, f.real(), 3*2*i32sq16_t::resolution);
 }
 
+TEST_F(SQTest_Division, sq_divide__negative_values_by_integral_constant__truncated_towards_zero) {
+    using i32sq8_t = i32sq8<-1000., 1000.>;
+    using u16sq4_t = u16sq4<0., 4000.>;
+    auto a = i32sq8_t::fromScaled< -2561 >();
+    auto b = i32sq8_t::fromScaled< +2561 >();
+    auto c = u16sq4_t::fromScaled< 63999 >();
+
+    auto ad = a / 3_ic;
+    auto bd = b / -3_ic;
+    auto cd = c / 7_ic;
+
+    ASSERT_EQ(-2561 / 3, ad.scaled());  // -853
+    ASSERT_EQ(2561 / -3, bd.scaled());
+    ASSERT_EQ(63999 / 7, cd.scaled());
+}
+
+TEST_F(SQTest_Division, sq_divide__two_64bit_values_large_f__values_divided_in_128bit) {
+    using dividend_t = i64sq40<-1000., 1000.>;
+    using divisor_t = i64sq40<-10., -1.>;
+    auto a = dividend_t::fromReal< 987.654321 >();
+    auto b = divisor_t::fromReal< -3.75 >();
+
+    auto c = a / b;
+
+    using expected_result_t = dividend_t;
+    ASSERT_TRUE((std::is_same_v<expected_result_t, decltype(c)>));
+    ASSERT_NEAR(-263.3744856, c.real(), 2*dividend_t::resolution);
+}
+
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ------------------------------------ SQ Test: Modulus ---------------------------------------- //
@@ -1017,6 +1138,190 @@ TEST_F(SQTest_Modulus, sq_modulo__divisor_has_forbidden_range__does_not_compile)
 }
 
 
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------- SQ Test: Rounding -------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class SQTest_Rounding : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+};
+
+TEST_F(SQTest_Rounding, sq_multiply__half_step_products__rounded_according_to_lhs_type) {
+    using fpm::Rounding;
+    constexpr auto half = i16sq8<>::fromScaled<128>();  // 0.5
+    using native_t = i16sq8<-128., 127., Rounding::native>;
+    using towardZero_t = i16sq8<-128., 127., Rounding::towardZero>;
+    using nearest_t = i16sq8<-128., 127., Rounding::nearest>;
+    using convergent_t = i16sq8<-128., 127., Rounding::convergent>;
+
+    // +0.5 steps
+    EXPECT_EQ(0, (native_t::fromScaled<1>() * half).scaled());
+    EXPECT_EQ(0, (towardZero_t::fromScaled<1>() * half).scaled());
+    EXPECT_EQ(1, (nearest_t::fromScaled<1>() * half).scaled());
+    EXPECT_EQ(0, (convergent_t::fromScaled<1>() * half).scaled());
+    // +1.5 steps
+    EXPECT_EQ(1, (native_t::fromScaled<3>() * half).scaled());
+    EXPECT_EQ(1, (towardZero_t::fromScaled<3>() * half).scaled());
+    EXPECT_EQ(2, (nearest_t::fromScaled<3>() * half).scaled());
+    EXPECT_EQ(2, (convergent_t::fromScaled<3>() * half).scaled());
+    // -0.5 steps
+    EXPECT_EQ(-1, (native_t::fromScaled<-1>() * half).scaled());
+    EXPECT_EQ(0, (towardZero_t::fromScaled<-1>() * half).scaled());
+    EXPECT_EQ(0, (nearest_t::fromScaled<-1>() * half).scaled());
+    EXPECT_EQ(0, (convergent_t::fromScaled<-1>() * half).scaled());
+}
+
+TEST_F(SQTest_Rounding, sq_sqr_cube__rounding_modes__same_as_multiplication_and_pow) {
+    auto check = []<fpm::Rounding rnd>(std::integral_constant<fpm::Rounding, rnd>) {
+        using q_t = i32q4<-10., 10., fpm::Ovf::error, rnd>;
+        for (int32_t v = -160; v <= 160; ++v) {
+            auto const x = q_t::construct(v).toSq();
+            ASSERT_EQ((x * x).scaled(), sqr(x).scaled()) << v;
+            ASSERT_EQ(pow(x, 2_ic).scaled(), sqr(x).scaled()) << v;
+            ASSERT_EQ(pow(x, 3_ic).scaled(), cube(x).scaled()) << v;
+            ASSERT_EQ(rnd, decltype(sqr(x))::rounding);
+            ASSERT_EQ(rnd, decltype(cube(x))::rounding);
+        }
+    };
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::native>{});
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::towardZero>{});
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::nearest>{});
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::convergent>{});
+
+    // 1.1875^2 = 22.5625 scaled, 1.1875^3 = 26.8 scaled (via the rounded square)
+    using fpm::Rnd;
+    EXPECT_EQ(22, sqr(i32sq4<-10., 10., Rnd::native>::fromReal<1.1875>()).scaled());
+    EXPECT_EQ(23, sqr(i32sq4<-10., 10., Rnd::nearest>::fromReal<1.1875>()).scaled());
+    EXPECT_EQ(-27, cube(i32sq4<-10., 10., Rnd::native>::fromReal<-1.1875>()).scaled());
+    EXPECT_EQ(-26, cube(i32sq4<-10., 10., Rnd::towardZero>::fromReal<-1.1875>()).scaled());
+    EXPECT_EQ(27, cube(i32sq4<-10., 10., Rnd::nearest>::fromReal<1.1875>()).scaled());
+    EXPECT_EQ(-27, cube(i32sq4<-10., 10., Rnd::convergent>::fromReal<-1.1875>()).scaled());
+}
+
+TEST_F(SQTest_Rounding, sq_sqr_cube__rounded_at_range_edge__within_result_range) {
+    using fpm::Rnd;
+    auto x = i32sq4<-1.1875, 1.1875, Rnd::nearest>::fromReal<1.1875>();
+    auto y = i32sq4<-1.1875, 1.1875, Rnd::nearest>::fromReal<-1.1875>();
+
+    EXPECT_GE(decltype(sqr(x))::scaledMax, sqr(x).scaled());  // 22.5625 rounded up to 23
+    EXPECT_GE(decltype(cube(x))::scaledMax, cube(x).scaled());
+    EXPECT_LE(decltype(cube(y))::scaledMin, cube(y).scaled());
+    EXPECT_EQ(23, sqr(x).scaled());
+}
+
+TEST_F(SQTest_Rounding, sq_multiply__rounding_mode__inherited_by_result_type) {
+    using fpm::Rounding;
+    auto a = i16sq8<-10., 10., Rounding::nearest>::fromReal<2.5>();
+    auto b = i16sq8<-10., 10.>::fromReal<1.5>();
+    auto c = a * b;
+    auto d = b * a;
+
+    ASSERT_EQ(Rounding::nearest, decltype(c)::rounding);
+    ASSERT_EQ(i16sq8<>::rounding, decltype(d)::rounding);
+    ASSERT_EQ(Rounding::nearest, decltype(-a)::rounding);
+}
+
+TEST_F(SQTest_Rounding, sq_divide__nearest_rounding__quotient_rounded_to_nearest) {
+    using fpm::Rounding;
+    auto nTrunc = i32sq16<-10., 10., Rounding::native>::fromReal<2.>();
+    auto nNearest = i32sq16<-10., 10., Rounding::nearest>::fromReal<2.>();
+    auto nNegNearest = i32sq16<-10., 10., Rounding::nearest>::fromReal<-2.>();
+    auto d = i32sq16<1., 10.>::fromReal<3.>();
+
+    // 2/3 = 0.666... -> 43690.67 scaled
+    EXPECT_EQ(43690, (nTrunc / d).scaled());
+    EXPECT_EQ(43691, (nNearest / d).scaled());
+    EXPECT_EQ(-43691, (nNegNearest / d).scaled());
+}
+
+TEST_F(SQTest_Rounding, sq_divide_ic__rounding_modes__quotient_rounded_like_division) {
+    using fpm::Rounding;
+    auto nNative = i32sq8<-1000., 1000., Rounding::native>::fromScaled< -2561 >();
+    auto nTowardZero = i32sq8<-1000., 1000., Rounding::towardZero>::fromScaled< -2561 >();
+    auto nNearest = i32sq8<-1000., 1000., Rounding::nearest>::fromScaled< -2561 >();
+    auto nConvergent = i32sq8<-1000., 1000., Rounding::convergent>::fromScaled< 2562 >();
+
+    // -2561 / 3 = -853.67
+    EXPECT_EQ(-853, (nNative / 3_ic).scaled());
+    EXPECT_EQ(-853, (nTowardZero / 3_ic).scaled());
+    EXPECT_EQ(-854, (nNearest / 3_ic).scaled());
+    EXPECT_EQ(854, (nNearest / -3_ic).scaled());
+    // 2562 / 4 = 640.5, 2562 / -12 = -213.5
+    EXPECT_EQ(640, (nConvergent / 4_ic).scaled());
+    EXPECT_EQ(-214, (nConvergent / -12_ic).scaled());
+}
+
+TEST_F(SQTest_Rounding, sq_upscale__nearest_rounding__down_scaled_value_rounded_to_nearest) {
+    using fpm::Rounding;
+    auto a = i32sq16<-10., 10.>::fromReal<1.9999>();  // 131065 scaled
+    auto bNative = i16sq4<-10., 10., Rounding::native>(a);
+    auto bNearest = i16sq4<-10., 10., Rounding::nearest>(a);
+
+    EXPECT_EQ(31, bNative.scaled());  // 1.9375
+    EXPECT_EQ(32, bNearest.scaled());  // 2.0
+}
+
+TEST_F(SQTest_Rounding, sq_multiply__product_rounded_up_at_range_edge__within_result_range) {
+    auto a = i8sq2<0., 0.75, fpm::Rnd::nearest>::fromReal<0.75>();
+    auto b = i8sq2<0., 1.25, fpm::Rnd::nearest>::fromReal<1.25>();
+
+    auto c = a * b;  // 0.9375 = 3.75 scaled, rounded up to 4
+
+    EXPECT_EQ(4, c.scaled());
+    EXPECT_EQ(1., decltype(c)::realMax);  // 0.9375 rounded up to the resolution
+    EXPECT_EQ(4, decltype(c)::scaledMax);
+}
+
+TEST_F(SQTest_Rounding, sq_operators__values_at_range_edges__results_within_limits_for_all_modes) {
+    auto check = []<fpm::Rounding rnd>(std::integral_constant<fpm::Rounding, rnd>) {
+        using a_t = i8sq2<-1.75, 1.75, rnd>;
+        using b_t = i8sq2<-1.25, 1.25, rnd>;
+        using d_t = i8sq2<1.25, 1.75, rnd>;
+        auto expectWithinLimits = [](auto v) {
+            using v_t = decltype(v);
+            // native rounding shifts a negative value down, which can fall below a minimum that is
+            // not a multiple of the resolution by less than one resolution step
+            EXPECT_LE(v_t::scaledMin - (rnd == fpm::Rnd::native ? 1 : 0), v.scaled()) << v.real();
+            EXPECT_GE(v_t::scaledMax, v.scaled()) << v.real();
+        };
+        for (auto a : { a_t::template fromReal<-1.75>(), a_t::template fromReal<1.75>() }) {
+            for (auto b : { b_t::template fromReal<-1.25>(), b_t::template fromReal<1.25>() }) {
+                expectWithinLimits(a * b);  // +-2.1875 = +-8.75 scaled
+                expectWithinLimits(fma(a, b, b));
+            }
+            expectWithinLimits(a / 2_ic);  // +-0.875 = +-3.5 scaled
+            for (auto d : { d_t::template fromReal<1.25>(), d_t::template fromReal<1.75>() }) {
+                expectWithinLimits(a / d);  // +-1.4 = +-5.6 scaled
+                expectWithinLimits(-a / d);
+                expectWithinLimits(7_ic / d);  // 5.6 = 22.4 scaled
+            }
+        }
+    };
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::native>{});
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::towardZero>{});
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::nearest>{});
+    check(std::integral_constant<fpm::Rounding, fpm::Rnd::convergent>{});
+}
+
+TEST_F(SQTest_Rounding, sq_conversion__down_scaling_rounds_beyond_target_range__not_implicitly_convertible) {
+    using fpm::Rnd;
+    using from_t = i16sq4<-0.99, 0.99>;  // largest value 0.9375 = 3.75 scaled by 2^2
+
+    EXPECT_TRUE(( std::is_convertible_v<from_t, i16sq2<-0.99, 0.99, Rnd::native>> ));
+    EXPECT_TRUE(( std::is_convertible_v<from_t, i16sq2<-0.99, 0.99, Rnd::towardZero>> ));
+    EXPECT_FALSE(( std::is_convertible_v<from_t, i16sq2<-0.99, 0.99, Rnd::nearest>> ));
+    EXPECT_FALSE(( std::is_convertible_v<from_t, i16sq2<-0.99, 0.99, Rnd::convergent>> ));
+    EXPECT_TRUE(( std::is_convertible_v<from_t, i16sq2<-1., 1., Rnd::nearest>> ));
+    EXPECT_TRUE(( std::is_convertible_v<from_t, i16sq8<-0.99, 0.99, Rnd::nearest>> ));  // up-scaling is exact
+}
+
+
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ------------------------------------ SQ Test: Comparison ------------------------------------- //
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
@@ -1697,11 +2002,25 @@ TEST_F(SQTest_Square, sq_square__value_zero__value_squared_is_zero) {
     ASSERT_NEAR(0., squared2.real(), i32sq12_t::resolution);
 }
 
+TEST_F(SQTest_Square, sq_square__64bit_value_large_f__squared_value_i64) {
+    using i64sq36_t = i64sq36<-3000., +2000.>;
+    auto value = i64sq36_t::fromReal<-2999.125>();
+
+    EXPECT_TRUE(( Squarable<i64sq36_t> ));
+    auto squared = sqr(value);
+
+    using expected_t = i64sq36_t::clamp_t<0., 9000000.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(squared)> ));
+    ASSERT_NEAR(2999.125*2999.125, squared.real(), 6000*i64sq36_t::resolution);
+}
+
 TEST_F(SQTest_Square, sq_square__various_types__squareable_or_not) {
     ASSERT_TRUE(( Squarable< i32sq12<-50., -0.> > ));
     ASSERT_TRUE(( Squarable< i32sq12<-0., +0.> > ));
     ASSERT_TRUE(( Squarable< i32sq12<+0., +66.> > ));
     ASSERT_FALSE(( Squarable< i32sq12<+0., +725.> > ));  // 725*725 exceeds 2^19
+    ASSERT_TRUE(( Squarable< i64sq12<-0., +4.7e7> > ));
+    ASSERT_FALSE(( Squarable< i64sq12<-0., +4.8e7> > ));  // 4.8e7*4.8e7 exceeds 2^51
 }
 
 TEST_F(SQTest_Square, sq_sqrt__some_positive_value__root_taken) {
@@ -1888,6 +2207,18 @@ TEST_F(SQTest_Cube, sq_cube__smallest_value__value_cubed_is_minimum_i32) {
     ASSERT_NEAR(-16777216., cubed.real(), i32sq7_t::resolution);
 }
 
+TEST_F(SQTest_Cube, sq_cube__64bit_value_large_f__value_cubed_i64) {
+    using i64sq32_t = i64sq32<-500., +100.>;
+    auto value = i64sq32_t::fromReal<-432.1>();
+
+    EXPECT_TRUE(( Cubeable<i64sq32_t> ));
+    auto cubed = cube(value);
+
+    using expected_t = i64sq32_t::clamp_t<-125000000., 25000000.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(cubed)> ));
+    ASSERT_NEAR(-432.1*432.1*432.1, cubed.real(), 3*433*433*i64sq32_t::resolution);
+}
+
 TEST_F(SQTest_Square, sq_cube__various_types__cubeable_or_not) {
     ASSERT_TRUE(( Cubeable< i32sq12<-50., -0.> > ));
     ASSERT_TRUE(( Cubeable< i32sq12<-0., +0.> > ));
@@ -1937,6 +2268,582 @@ TEST_F(SQTest_Cube, sq_cbrt__various_types__not_rootable) {
     ASSERT_FALSE(( CubeRootable< i32sq12<-1000., +1000.> > ));
 }
 
+TEST_F(SQTest_Cube, sq_rcbrt__some_positive_value__reciprocal_root_taken) {
+    using i32sq16_t = i32sq16<0.5, 1000.>;
+    auto value = i32sq16_t::fromReal<27.>();
+
+    EXPECT_TRUE(( RCubeRootable<i32sq16_t> ));
+    auto rRoot = rcbrt(value);
+
+    using expected_t = i32sq16_t::clamp_t<0., 2.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(rRoot)> ));
+    ASSERT_NEAR(1./3., rRoot.real(), i32sq16_t::resolution);
+}
+
+TEST_F(SQTest_Cube, sq_rcbrt__maximum_u32_value__reciprocal_root_taken) {
+    using u32sq16_t = u32sq16< 1.0, u32sq16<>::realMax >;
+    auto value = u32sq16_t::fromScaled< std::numeric_limits<uint32_t>::max() >();
+
+    EXPECT_TRUE(( RCubeRootable<u32sq16_t> ));
+    auto rRoot = rcbrt(value);
+
+    using expected_t = u32sq16_t::clamp_t<0., 1.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(rRoot)> ));
+    ASSERT_NEAR(1. / 40.31747359, rRoot.real(), u32sq16_t::resolution);
+}
+
+TEST_F(SQTest_Cube, sq_rcbrt__minimum_value__largest_value_within_range) {
+    using i32sq12_t = i32sq12< i32sq12<>::resolution, 10. >;
+    auto value = i32sq12_t::fromScaled<1>();
+
+    EXPECT_TRUE(( RCubeRootable<i32sq12_t> ));
+    auto rRoot = rcbrt(value);
+
+    using expected_t = i32sq12_t::clamp_t<0., 16.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(rRoot)> ));
+    ASSERT_NEAR(16., rRoot.real(), i32sq12_t::resolution);  // 1 / cbrt(2^-12)
+}
+
+TEST_F(SQTest_Cube, sq_rcbrt__value_range__error_within_bounds) {
+    using i32q16_t = i32q16<0.01, 5000.>;
+    for (int32_t scaled = i32q16_t::scaledMin; scaled < i32q16_t::scaledMax; scaled += 9973) {
+        auto value = i32q16_t::construct(scaled);
+        auto rRoot = rcbrt(value);  // Q is converted to Sq
+        // the error of the rounded-down root is amplified by 1/root^2
+        double const maxError = i32q16_t::resolution * (1. + 1. / std::cbrt(value.real() * value.real()));
+        ASSERT_NEAR(1. / std::cbrt(value.real()), rRoot.real(), maxError) << scaled;
+    }
+}
+
+TEST_F(SQTest_Cube, sq_rcbrt__narrow_base_types__reciprocal_root_taken) {
+    using i16sq8_t = i16sq8<0.5, 100.>;
+    using u8sq4_t = u8sq4<0.5, 8.>;
+
+    auto rRoot16 = rcbrt( i16sq8_t::fromReal<8.>() );
+    auto rRoot8 = rcbrt( u8sq4_t::fromReal<8.>() );
+
+    ASSERT_TRUE(( std::is_same_v<i16sq8_t::clamp_t<0., 2.>, decltype(rRoot16)> ));
+    ASSERT_TRUE(( std::is_same_v<u8sq4_t::clamp_t<0., 2.>, decltype(rRoot8)> ));
+    ASSERT_NEAR(0.5, rRoot16.real(), i16sq8_t::resolution);
+    ASSERT_NEAR(0.5, rRoot8.real(), u8sq4_t::resolution);
+}
+
+TEST_F(SQTest_Cube, sq_rcbrt__various_types__not_rootable) {
+    ASSERT_FALSE(( RCubeRootable< i32sq12<-1000., -0.> > ));
+    ASSERT_FALSE(( RCubeRootable< i32sq12<0., +1000.> > ));  // 0 has no reciprocal root
+    ASSERT_FALSE(( RCubeRootable< i32sq20<1., +1000.> > ));  // scaling too large
+}
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ SQ Test: Power ------------------------------------------ //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class SQTest_Power : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+};
+
+TEST_F(SQTest_Power, sq_pow__odd_exponent__sign_preserved) {
+    using i16sq8_t = i16sq8<-2., 1.5>;
+    auto value = i16sq8_t::fromReal<-1.5>();
+
+    auto power = pow(value, 5_ic);
+
+    using expected_t = i32sq8<-32., 1.5*1.5*1.5*1.5*1.5>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(power)> ));
+    ASSERT_NEAR(-7.59375, power.real(), i16sq8_t::resolution);
+}
+
+TEST_F(SQTest_Power, sq_pow__even_exponent__non_negative_range) {
+    using i32sq16_t = i32sq16<-2., 1.5>;
+    auto value = i32sq16_t::fromReal<-1.25>();
+
+    auto power = pow(value, 4_ic);
+
+    using expected_t = i32sq16<0., 16.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(power)> ));
+    ASSERT_NEAR(2.44140625, power.real(), i32sq16_t::resolution);
+    ASSERT_TRUE(( std::is_same_v<i32sq16<-8., -1.>, decltype(pow(i32sq16<-2., -1.>::fromReal<-1.>(), 3_ic))> ));
+    ASSERT_TRUE(( std::is_same_v<i32sq16<1., 4.>, decltype(pow(i32sq16<-2., -1.>::fromReal<-1.>(), 2_ic))> ));
+}
+
+TEST_F(SQTest_Power, sq_pow__same_as_sqr_and_cube) {
+    using i32q12_t = i32q12<-20., 20.>;
+    for (int32_t scaled = i32q12_t::scaledMin; scaled < i32q12_t::scaledMax; scaled += 97) {
+        auto value = i32q12_t::construct(scaled);
+
+        ASSERT_EQ(sqr(value).scaled(), pow(value, 2_ic).scaled()) << value.real();  // Q is converted to Sq
+        ASSERT_EQ(value.scaled(), pow(value, 1_ic).scaled()) << value.real();
+        // cube() truncates, pow() rounds down, which differs for negative products
+        ASSERT_NEAR(cube(value).real(), pow(value, 3_ic).real(), i32q12_t::resolution) << value.real();
+    }
+}
+
+TEST_F(SQTest_Power, sq_pow__higher_exponents__widened_type_close_to_std) {
+    using i32q16_t = i32q16<-5., 5.>;
+    for (int32_t scaled = i32q16_t::scaledMin; scaled < i32q16_t::scaledMax; scaled += 997) {
+        auto value = i32q16_t::construct(scaled);
+        auto power4 = pow(value, 4_ic);
+        auto power7 = pow(value, 7_ic);
+
+        ASSERT_TRUE(( std::is_same_v<int32_t, decltype(power4)::base_t> ));
+        ASSERT_TRUE(( std::is_same_v<int64_t, decltype(power7)::base_t> ));
+        // each truncated product has an error of at most one resolution step, amplified by the
+        // remaining factors
+        ASSERT_NEAR(std::pow(value.real(), 4), power4.real(), 4. * 125. * i32q16_t::resolution) << value.real();
+        ASSERT_NEAR(std::pow(value.real(), 7), power7.real(), 7. * 15625. * i32q16_t::resolution) << value.real();
+    }
+}
+
+TEST_F(SQTest_Power, sq_pow__rounding_mode__applied_to_each_product) {
+    using fpm::Rounding;
+    // 1.1875^2 = 22.5625 and 1.1875^3 = 26.79... scaled by 2^4
+    auto native = i32sq4<-2., 2., Rounding::native>::fromReal<1.1875>();
+    auto towardZero = i32sq4<-2., 2., Rounding::towardZero>::fromReal<1.1875>();
+    auto nearest = i32sq4<-2., 2., Rounding::nearest>::fromReal<1.1875>();
+    auto convergent = i32sq4<-2., 2., Rounding::convergent>::fromReal<1.1875>();
+
+    EXPECT_EQ(26, pow(native, 3_ic).scaled());  // 19*22 / 16 = 26.125
+    EXPECT_EQ(-27, pow(-native, 3_ic).scaled());
+    EXPECT_EQ(26, pow(towardZero, 3_ic).scaled());
+    EXPECT_EQ(-26, pow(-towardZero, 3_ic).scaled());
+    EXPECT_EQ(27, pow(nearest, 3_ic).scaled());  // 19*23 / 16 = 27.3125
+    EXPECT_EQ(-27, pow(-nearest, 3_ic).scaled());
+    EXPECT_EQ(27, pow(convergent, 3_ic).scaled());
+    EXPECT_EQ(-27, pow(-convergent, 3_ic).scaled());
+}
+
+TEST_F(SQTest_Power, sq_pow__rounded_beyond_limits__clamped_to_result_range) {
+    using fpm::Rounding;
+    // the range of the result is [-26.79, 26.79] scaled by 2^4, i.e. [-26, 26]
+    auto nearest = i32sq4<-1.1875, 1.1875, Rounding::nearest>::fromReal<1.1875>();
+    auto native = i32sq4<-1.1875, 1.1875, Rounding::native>::fromReal<-1.1875>();
+
+    auto pNearest = pow(nearest, 3_ic);
+    auto pNative = pow(native, 3_ic);
+
+    EXPECT_EQ(decltype(pNearest)::scaledMax, pNearest.scaled());
+    EXPECT_EQ(26, pNearest.scaled());
+    EXPECT_EQ(decltype(pNative)::scaledMin, pNative.scaled());
+    EXPECT_EQ(-26, pNative.scaled());
+}
+
+TEST_F(SQTest_Power, sq_pow__constexpr__evaluated_at_compile_time) {
+    constexpr auto power = pow(u16sq8<0., 2.>::fromReal<2.>(), 6_ic);
+
+    static_assert(power.scaled() == 64 * 256);
+    static_assert(std::is_same_v<i32sq8<0., 64.>, std::remove_const_t<decltype(power)>>);
+}
+
+TEST_F(SQTest_Power, sq_pow__various_types__not_computable) {
+    ASSERT_TRUE(( Powerable< i32sq16<-2., 2.>, 7u > ));
+    ASSERT_FALSE(( Powerable< i32sq16<-2., 2.>, 0u > ));  // exponent must be 1 or larger
+    ASSERT_FALSE(( Powerable< i32sq16<-2., 2.>, -2 > ));
+    ASSERT_FALSE(( Powerable< i32sq16<-100., 100.>, 9u > ));  // 100^9 exceeds the range of int64_t at 2^16
+}
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ SQ Test: Polynomial ------------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class SQTest_Poly : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+};
+
+TEST_F(SQTest_Poly, sq_poly__quadratic__exact_range_of_polynomial) {
+    using u16sq8_t = u16sq8<0., 10.>;
+    auto value = u16sq8_t::fromReal<3.>();
+
+    auto result = poly<1., 2., 1.>(value);  // (x+1)^2
+
+    using expected_t = u16sq8<1., 121.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(result)> ));
+    ASSERT_EQ(16 * 256, result.scaled());
+}
+
+TEST_F(SQTest_Poly, sq_poly__extremum_within_range__tight_range) {
+    using i32sq16_t = i32sq16<-1., 3.>;
+    auto value = i32sq16_t::fromReal<1.>();
+
+    auto result = poly<-1., -2., 1.>(value);  // (x-1)^2 - 2, minimum at x=1
+
+    using expected_t = i32sq16<-2., 2.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(result)> ));
+    ASSERT_EQ(-2 * 65536, result.scaled());
+}
+
+TEST_F(SQTest_Poly, sq_poly__unsigned_input_negative_result__signed_type) {
+    auto result = poly<-5., 1.>( u16sq8<0., 10.>::fromReal<2.>() );
+
+    using expected_t = i16sq8<-5., 5.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(result)> ));
+    ASSERT_EQ(-3 * 256, result.scaled());
+}
+
+TEST_F(SQTest_Poly, sq_poly__quintic_nearest__within_half_resolution_of_exact_value) {
+    using i32q16_t = i32q16<-2., 3., fpm::Ovf::error, fpm::Rnd::nearest>;
+    auto const exact = [](double x) { return 0.5 + x*(-1.25 + x*(0.75 + x*(0.1 + x*(-0.02 + x*0.003)))); };
+    for (int32_t scaled = i32q16_t::scaledMin; scaled < i32q16_t::scaledMax; scaled += 97) {
+        auto value = i32q16_t::construct(scaled);
+
+        auto result = poly<0.5, -1.25, 0.75, 0.1, -0.02, 0.003>(value);  // Q is converted to Sq
+
+        ASSERT_LE(decltype(result)::scaledMin, result.scaled());
+        ASSERT_GE(decltype(result)::scaledMax, result.scaled());
+        ASSERT_NEAR(exact(value.real()), result.real(), 0.5 * i32q16_t::resolution) << value.real();
+    }
+}
+
+TEST_F(SQTest_Poly, sq_poly__quintic_native__rounded_down_within_resolution_of_exact_value) {
+    using i32q16_t = i32q16<-2., 3.>;
+    auto const exact = [](double x) { return 0.5 + x*(-1.25 + x*(0.75 + x*(0.1 + x*(-0.02 + x*0.003)))); };
+    for (int32_t scaled = i32q16_t::scaledMin; scaled < i32q16_t::scaledMax; scaled += 97) {
+        auto value = i32q16_t::construct(scaled);
+
+        auto result = poly<0.5, -1.25, 0.75, 0.1, -0.02, 0.003>(value);
+
+        ASSERT_LE(decltype(result)::scaledMin, result.scaled());
+        ASSERT_GE(decltype(result)::scaledMax, result.scaled());
+        ASSERT_NEAR(exact(value.real()) - 0.5 * i32q16_t::resolution, result.real(), 0.5 * i32q16_t::resolution) << value.real();
+    }
+}
+
+TEST_F(SQTest_Poly, sq_poly__rounding_modes__final_rescaling_rounded_like_multiplication) {
+    // 0.5 * x at the resolution of x: the scaled value 3 gives 1.5 resolution steps
+    using fpm::Rnd;
+    EXPECT_EQ(1, (poly<0., 0.5>( i16sq8<-1., 1., Rnd::native>::fromScaled<3>() ).scaled()));
+    EXPECT_EQ(-2, (poly<0., 0.5>( i16sq8<-1., 1., Rnd::native>::fromScaled<-3>() ).scaled()));
+    EXPECT_EQ(-1, (poly<0., 0.5>( i16sq8<-1., 1., Rnd::towardZero>::fromScaled<-3>() ).scaled()));
+    EXPECT_EQ(2, (poly<0., 0.5>( i16sq8<-1., 1., Rnd::nearest>::fromScaled<3>() ).scaled()));
+    EXPECT_EQ(-1, (poly<0., 0.5>( i16sq8<-1., 1., Rnd::nearest>::fromScaled<-3>() ).scaled()));
+    EXPECT_EQ(2, (poly<0., 0.5>( i16sq8<-1., 1., Rnd::convergent>::fromScaled<3>() ).scaled()));
+    EXPECT_EQ(2, (poly<0., 0.5>( i16sq8<-1., 1., Rnd::convergent>::fromScaled<5>() ).scaled()));
+    EXPECT_EQ(Rnd::nearest, decltype(poly<0., 0.5>( i16sq8<-1., 1., Rnd::nearest>::fromScaled<3>() ))::rounding);
+}
+
+TEST_F(SQTest_Poly, sq_poly__constant_and_linear__evaluated_at_compile_time) {
+    constexpr auto constant = poly<2.5>( i16sq8<-1., 1.>::fromReal<0.5>() );
+    constexpr auto linear = poly<0., -2.>( i16sq8<-1., 1.>::fromReal<0.5>() );
+
+    static_assert(std::is_same_v<i16sq8<2.5, 2.5>, std::remove_const_t<decltype(constant)>>);
+    static_assert(std::is_same_v<i16sq8<-2., 2.>, std::remove_const_t<decltype(linear)>>);
+    static_assert(constant.scaled() == 640);
+    static_assert(linear.scaled() == -256);
+}
+
+TEST_F(SQTest_Poly, sq_poly__various_types__not_evaluable) {
+    ASSERT_TRUE(( PolyEvaluable< i16sq8<-2., 2.>, 1., 2., 3. > ));
+    ASSERT_TRUE(( std::is_same_v<int32_t, decltype(poly<1., 2., 3000.>(i16sq8<-2., 2.>::fromReal<0.>()))::base_t> ));
+    ASSERT_FALSE(( PolyEvaluable< i32sq16<-1000., 1000.>, 0., 0., 0., 0., 0., 0., 0., 1. > ));  // 1000^7 exceeds int64_t
+    ASSERT_FALSE(( PolyEvaluable< i16sq8<-2., 2.> > ));  // no coefficients
+}
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------------ SQ Test: Trigonometry ----------------------------------- //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class SQTest_Trig : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+
+    static constexpr double PI = 3.14159265358979323846;
+};
+
+TEST_F(SQTest_Trig, sq_sin__some_angle__sine_with_unit_range) {
+    using i32sq16_t = i32sq16<-10., 10.>;
+    auto angle = i32sq16_t::fromReal<PI/6.>();
+
+    auto sinValue = sin(angle);
+
+    using expected_t = i32sq16<-1., 1.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(sinValue)> ));
+    ASSERT_NEAR(0.5, sinValue.real(), i32sq16_t::resolution);
+}
+
+TEST_F(SQTest_Trig, sq_cos__unsigned_angle__signed_result) {
+    using u16sq12_t = u16sq12<0., 8.>;
+    auto angle = u16sq12_t::fromReal<PI>();
+
+    auto cosValue = cos(angle);
+
+    using expected_t = i16sq12<-1., 1.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(cosValue)> ));
+    ASSERT_NEAR(-1., cosValue.real(), 2. * u16sq12_t::resolution);
+}
+
+TEST_F(SQTest_Trig, sq_sin_cos__angle_range__both_engines_close_to_std) {
+    using i32q20_t = i32q20<-2000., 2000.>;
+    for (int32_t scaled = i32q20_t::scaledMin; scaled < i32q20_t::scaledMax; scaled += 65537*7) {
+        auto angle = i32q20_t::construct(scaled);
+        double const expectedSin = std::sin(angle.real()), expectedCos = std::cos(angle.real());
+
+        ASSERT_NEAR(expectedSin, sin(angle).real(), 2. * i32q20_t::resolution) << angle.real();
+        ASSERT_NEAR(expectedCos, cos(angle).real(), 2. * i32q20_t::resolution) << angle.real();
+        ASSERT_NEAR(expectedSin, sin<fpm::TrigEngine::lut>(angle).real(), 1e-5) << angle.real();
+        ASSERT_NEAR(expectedCos, cos<fpm::TrigEngine::lut>(angle).real(), 1e-5) << angle.real();
+    }
+}
+
+TEST_F(SQTest_Trig, sq_sincos__turns__same_values_as_sin_and_cos) {
+    using i32q28_t = i32q28<-1., 1.>;
+    for (int32_t scaled = i32q28_t::scaledMin; scaled < i32q28_t::scaledMax; scaled += 1048573) {
+        auto angle = i32q28_t::construct(scaled);
+
+        auto [sinValue, cosValue] = sincos<fpm::TrigEngine::cordic, fpm::AngleUnit::turn>(angle);
+
+        ASSERT_EQ((sin<fpm::TrigEngine::cordic, fpm::AngleUnit::turn>(angle).scaled()), sinValue.scaled());
+        ASSERT_EQ((cos<fpm::TrigEngine::cordic, fpm::AngleUnit::turn>(angle).scaled()), cosValue.scaled());
+        ASSERT_NEAR(std::sin(2.*PI * angle.real()), sinValue.real(), 1e-6) << angle.real();
+        ASSERT_NEAR(std::cos(2.*PI * angle.real()), cosValue.real(), 1e-6) << angle.real();
+    }
+}
+
+TEST_F(SQTest_Trig, sq_sin__quarter_turns__exact_values) {
+    using i16sq14_t = i16sq14<-1., 1.>;
+    constexpr auto lutTurn = [](auto angle) { return sin<fpm::TrigEngine::lut, fpm::AngleUnit::turn>(angle).scaled(); };
+
+    ASSERT_EQ(0, lutTurn(i16sq14_t::fromReal<0.>()));
+    ASSERT_EQ(16384, lutTurn(i16sq14_t::fromReal<0.25>()));
+    ASSERT_EQ(0, lutTurn(i16sq14_t::fromReal<0.5>()));
+    ASSERT_EQ(-16384, lutTurn(i16sq14_t::fromReal<-0.25>()));
+    ASSERT_EQ(-16384, lutTurn(i16sq14_t::fromReal<0.75>()));
+}
+
+TEST_F(SQTest_Trig, sq_sin__constexpr__evaluated_at_compile_time) {
+    constexpr auto sinValue = sin(i32sq16<-4., 4.>::fromReal<PI/2.>());
+    constexpr auto cosValue = cos<fpm::TrigEngine::lut>(i32sq16<-4., 4.>::fromReal<PI/2.>());
+
+    static_assert(sinValue.scaled() == 65536);
+    static_assert(-1 <= cosValue.scaled() && cosValue.scaled() <= 1);
+}
+
+TEST_F(SQTest_Trig, sq_tan__some_angle__tangent_with_range_of_limits) {
+    using i16sq12_t = i16sq12<-1.2, 1.2>;
+    auto angle = i16sq12_t::fromReal<PI/4.>();
+
+    auto tanValue = tan(angle);
+
+    ASSERT_TRUE(( std::is_same_v<int16_t, decltype(tanValue)::base_t> ));
+    ASSERT_EQ(12, decltype(tanValue)::f);
+    ASSERT_NEAR(-std::tan(1.2), decltype(tanValue)::realMin, 1e-9);
+    ASSERT_NEAR(+std::tan(1.2), decltype(tanValue)::realMax, 1e-9);
+    ASSERT_NEAR(1., tanValue.real(), 2. * i16sq12_t::resolution);
+}
+
+TEST_F(SQTest_Trig, sq_tan__limits__within_range) {
+    using i32q16_t = i32q16<-1.5, 1.5>;
+    auto tanMin = tan( i32q16_t::fromReal<-1.5>() );
+    auto tanMax = tan<fpm::TrigEngine::lut>( i32q16_t::fromReal<1.5>() );
+
+    ASSERT_LE(decltype(tanMin)::scaledMin, tanMin.scaled());
+    ASSERT_GE(decltype(tanMax)::scaledMax, tanMax.scaled());
+    ASSERT_NEAR(-std::tan(1.5), tanMin.real(), 1e-3);
+    ASSERT_NEAR(+std::tan(1.5), tanMax.real(), 1e-2);
+}
+
+TEST_F(SQTest_Trig, sq_atan2__mixed_types__angle_close_to_std) {
+    using y_t = i32q16<-1000., 1000.>;
+    using x_t = i16q8<-100., 100.>;
+    for (int32_t yScaled = y_t::scaledMin; yScaled < y_t::scaledMax; yScaled += 9999991) {
+        for (int16_t xScaled = x_t::scaledMin; xScaled < x_t::scaledMax; xScaled += 997) {
+            auto y = y_t::construct(yScaled);
+            auto x = x_t::construct(xScaled);
+
+            auto angle = atan2(y, x);
+
+            ASSERT_TRUE(( std::is_same_v<i32sq16<-PI, PI>, decltype(angle)> ));
+            ASSERT_NEAR(std::atan2(y.real(), x.real()), angle.real(), y_t::resolution) << y.real() << ", " << x.real();
+        }
+    }
+}
+
+TEST_F(SQTest_Trig, sq_atan2__axes__exact_angles) {
+    using i32sq16_t = i32sq16<-10., 10.>;
+    auto const zero = i32sq16_t::fromReal<0.>();
+    auto const one = i32sq16_t::fromReal<1.>();
+    auto const minusOne = i32sq16_t::fromReal<-1.>();
+
+    ASSERT_EQ(0, atan2(zero, zero).scaled());
+    ASSERT_EQ(0, atan2(zero, one).scaled());
+    ASSERT_NEAR(PI/2., atan2(one, zero).real(), i32sq16_t::resolution);
+    ASSERT_NEAR(PI, atan2(zero, minusOne).real(), i32sq16_t::resolution);  // +pi on the negative x-axis
+    ASSERT_NEAR(-PI/2., atan2(minusOne, zero).real(), i32sq16_t::resolution);
+    ASSERT_NEAR(-3.*PI/4., atan2(minusOne, minusOne).real(), i32sq16_t::resolution);
+    ASSERT_EQ(-16384, (atan2<fpm::AngleUnit::turn>(minusOne, zero).scaled()));  // -1/4 turn
+}
+
+TEST_F(SQTest_Trig, sq_atan2__quadrant_ranges__narrowed_range) {
+    auto angle1 = atan2(u16sq8<0., 10.>::fromReal<1.>(), u16sq8<0., 10.>::fromReal<1.>());
+    auto angle2 = atan2(i16sq8<0., 10.>::fromReal<1.>(), i16sq8<-10., -1.>::fromReal<-1.>());
+    auto angle3 = atan2(i16sq8<-10., 10.>::fromReal<-1.>(), i16sq8<1., 10.>::fromReal<1.>());
+    auto angle4 = atan2<fpm::AngleUnit::turn>(i16sq8<-10., -1.>::fromReal<-1.>(), i16sq8<-10., 10.>::fromReal<0.>());
+
+    ASSERT_TRUE(( std::is_same_v<u16sq8<0., PI/2.>, decltype(angle1)> ));
+    ASSERT_TRUE(( std::is_same_v<i16sq8<PI/2., PI>, decltype(angle2)> ));
+    ASSERT_TRUE(( std::is_same_v<i16sq8<-PI/2., PI/2.>, decltype(angle3)> ));
+    ASSERT_TRUE(( std::is_same_v<i16sq8<-0.5, 0.>, decltype(angle4)> ));
+    ASSERT_NEAR(PI/4., angle1.real(), 2. * angle1.resolution);
+    ASSERT_NEAR(3.*PI/4., angle2.real(), 2. * angle2.resolution);
+    ASSERT_NEAR(-PI/4., angle3.real(), 2. * angle3.resolution);
+    ASSERT_NEAR(-0.25, angle4.real(), angle4.resolution);
+}
+
+TEST_F(SQTest_Trig, sq_polar__mixed_types__magnitude_and_angle_in_one_pass) {
+    using x_t = i16q8<-100., 100.>;
+    using y_t = i32q16<-1000., 1000.>;
+    for (int16_t xScaled = x_t::scaledMin; xScaled < x_t::scaledMax; xScaled += 1999) {
+        for (int32_t yScaled = y_t::scaledMin; yScaled < y_t::scaledMax; yScaled += 7999993) {
+            auto x = x_t::construct(xScaled);
+            auto y = y_t::construct(yScaled);
+
+            auto [magnitude, angle] = polar(x, y);
+
+            ASSERT_EQ(atan2(y, x).scaled(), angle.scaled());
+            ASSERT_NEAR(std::hypot(x.real(), y.real()), magnitude.real(), 2. * y_t::resolution) << x.real() << ", " << y.real();
+        }
+    }
+}
+
+TEST_F(SQTest_Trig, sq_polar__ranges__magnitude_range_of_corners) {
+    auto [magnitude1, angle1] = polar(i32sq16<-3., 3.>::fromReal<3.>(), i32sq16<-4., 4.>::fromReal<-4.>());
+    auto [magnitude2, angle2] = polar(i32sq16<3., 6.>::fromReal<3.>(), i32sq16<-8., -4.>::fromReal<-4.>());
+
+    ASSERT_TRUE(( std::is_same_v<i32sq16<0., 5.>, decltype(magnitude1)> ));
+    ASSERT_TRUE(( std::is_same_v<i32sq16<5., 10.>, decltype(magnitude2)> ));
+    ASSERT_EQ(5 * 65536, magnitude1.scaled());  // limited to the range
+    ASSERT_EQ(5 * 65536, magnitude2.scaled());
+    ASSERT_NEAR(std::atan2(-4., 3.), angle1.real(), i32sq16<>::resolution);
+    ASSERT_TRUE(( std::is_same_v<i32sq16<-PI/2., 0.>, decltype(angle2)> ));
+}
+
+TEST_F(SQTest_Trig, sq_trig__various_types__not_computable) {
+    ASSERT_TRUE(( Tangentable< i32sq16<-1.5, 1.5> > ));
+    ASSERT_FALSE(( Tangentable< i32sq16<-1.6, 1.5> > ));  // beyond -pi/2
+    ASSERT_FALSE(( Tangentable< i16sq14<-1.5, 1.5> > ));  // tan(1.5) exceeds the range of the base type
+    ASSERT_TRUE(( TurnTangentable< i32sq16<-0.2, 0.2> > ));
+    ASSERT_FALSE(( TurnTangentable< i32sq16<-0.25, 0.2> > ));
+    ASSERT_FALSE(( SineComputable< i16sq15<-1., 0.99> > ));  // 1 cannot be represented
+    ASSERT_FALSE(( SineComputable< i32sq31<-1., 0.99> > ));  // scaling too large
+}
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// ------------------------------- SQ Test: Exponential, Logarithm ------------------------------ //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class SQTest_ExpLog : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+    }
+    void TearDown() override
+    {
+    }
+};
+
+TEST_F(SQTest_ExpLog, sq_log2__some_value__logarithm_with_range_of_limits) {
+    using u16sq8_t = u16sq8<0.5, 100.>;
+    auto value = u16sq8_t::fromReal<10.>();
+
+    auto logValue = log2(value);
+
+    using expected_t = i16sq8<-1., 7.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(logValue)> ));
+    ASSERT_NEAR(std::log2(10.), logValue.real(), u16sq8_t::resolution);
+}
+
+TEST_F(SQTest_ExpLog, sq_log2__powers_of_two__exact_values) {
+    using i32sq16_t = i32sq16< i32sq16<>::resolution, 30000. >;
+
+    ASSERT_EQ(-16 * 65536, log2( i32sq16_t::fromScaled<1>() ).scaled());
+    ASSERT_EQ(0, log2( i32sq16_t::fromReal<1.>() ).scaled());
+    ASSERT_EQ(14 * 65536, log2( i32sq16_t::fromReal<16384.>() ).scaled());
+}
+
+TEST_F(SQTest_ExpLog, sq_log2_log__value_range__close_to_std) {
+    using u32q16_t = u32q16< u32q16<>::resolution, u32q16<>::realMax >;
+    for (uint32_t scaled = u32q16_t::scaledMin; scaled < u32q16_t::scaledMax - 999983u; scaled += 999983u) {
+        auto value = u32q16_t::construct(scaled);
+
+        auto log2Value = log2(value);  // Q is converted to Sq
+        auto logValue = log(value);
+
+        ASSERT_TRUE(( std::is_same_v<int32_t, decltype(log2Value)::base_t> ));
+        ASSERT_NEAR(std::log2(value.real()), log2Value.real(), 2. * u32q16_t::resolution) << value.real();
+        ASSERT_NEAR(std::log(value.real()), logValue.real(), 2. * u32q16_t::resolution) << value.real();
+    }
+}
+
+TEST_F(SQTest_ExpLog, sq_exp2__some_value__exponential_with_range_of_limits) {
+    using i16sq8_t = i16sq8<-4., 4.>;
+    auto value = i16sq8_t::fromReal<-1.5>();
+
+    auto expValue = exp2(value);
+
+    using expected_t = i16sq8<0., 16.>;
+    ASSERT_TRUE(( std::is_same_v<expected_t, decltype(expValue)> ));
+    ASSERT_NEAR(std::exp2(-1.5), expValue.real(), i16sq8_t::resolution);
+}
+
+TEST_F(SQTest_ExpLog, sq_exp2__integers__exact_values) {
+    using i32sq16_t = i32sq16<-20., 10.>;
+
+    ASSERT_EQ(1024 * 65536, exp2( i32sq16_t::fromReal<10.>() ).scaled());
+    ASSERT_EQ(65536, exp2( i32sq16_t::fromReal<0.>() ).scaled());
+    ASSERT_EQ(16, exp2( i32sq16_t::fromReal<-12.>() ).scaled());
+    ASSERT_EQ(0, exp2( i32sq16_t::fromReal<-20.>() ).scaled());  // below the resolution
+}
+
+TEST_F(SQTest_ExpLog, sq_exp2_exp__value_range__widened_type_close_to_std) {
+    using i32q16_t = i32q16<-10., 20.>;
+    for (int32_t scaled = i32q16_t::scaledMin; scaled < i32q16_t::scaledMax; scaled += 9973) {
+        auto value = i32q16_t::construct(scaled);
+
+        auto exp2Value = exp2(value);  // Q is converted to Sq
+        auto expValue = exp(value);
+
+        ASSERT_TRUE(( std::is_same_v<int64_t, decltype(exp2Value)::base_t> ));
+        ASSERT_NEAR(std::exp2(value.real()), exp2Value.real(), i32q16_t::resolution + std::exp2(value.real()) * 1e-6) << value.real();
+        ASSERT_NEAR(std::exp(value.real()), expValue.real(), i32q16_t::resolution + std::exp(value.real()) * 2e-6) << value.real();
+    }
+}
+
+TEST_F(SQTest_ExpLog, sq_exp_log__constexpr__evaluated_at_compile_time) {
+    constexpr auto logValue = log(i32sq16<1., 100.>::fromReal<1.>());
+    constexpr auto expValue = exp(i32sq16<-2., 2.>::fromReal<0.>());
+
+    static_assert(logValue.scaled() == 0);
+    static_assert(expValue.scaled() == 65536);
+    static_assert(std::is_same_v<i32sq16<0., 5.>, std::remove_const_t<decltype(logValue)>>);
+    static_assert(std::is_same_v<i32sq16<0., 8.>, std::remove_const_t<decltype(expValue)>>);
+}
+
+TEST_F(SQTest_ExpLog, sq_exp_log__various_types__not_computable) {
+    ASSERT_TRUE(( Logarithmizable< u16sq8<0.5, 100.> > ));
+    ASSERT_FALSE(( Logarithmizable< i32sq16<0., 100.> > ));  // 0 has no logarithm
+    ASSERT_FALSE(( Logarithmizable< i32sq16<-1., 100.> > ));
+    ASSERT_FALSE(( Logarithmizable< i64sq16<1., 100.> > ));  // base type too large
+    ASSERT_TRUE(( Exponentiable< i32sq16<-10., 20.> > ));
+    ASSERT_FALSE(( Exponentiable< i32sq16<-10., 50.> > ));  // 2^50 exceeds the range of int64_t at 2^16
+    ASSERT_FALSE(( Exponentiable< i32sq31<-0.5, 0.5> > ));  // scaling too large
+}
 
 // ////////////////////////////////////////////////////////////////////////////////////////////// //
 // ------------------------------------ SQ Test: Clamp ------------------------------------------ //
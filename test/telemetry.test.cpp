@@ -0,0 +1,169 @@
+/* \file
+ * Tests for the overflow telemetry. Built as a separate executable with FPM_OVF_TELEMETRY.
+ */
+
+#include <gtest/gtest.h>
+
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <fpm.hpp>
+using namespace fpm::types;
+
+
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+// -------------------------------- Telemetry Test: Overflow ------------------------------------ //
+// ////////////////////////////////////////////////////////////////////////////////////////////// //
+
+class TelemetryTest_Overflow : public ::testing::Test {
+protected:
+    using q_t = i16q8<-10., 10., fpm::Ovf::clamp>;
+    using u_t = u16q8<0., 10., fpm::Ovf::clamp>;
+
+    void SetUp() override
+    {
+        fpm::ovfTelemetryReset();
+    }
+    void TearDown() override
+    {
+    }
+};
+
+TEST_F(TelemetryTest_Overflow, telemetry__enabled__compiled_in) {
+    ASSERT_TRUE(fpm::ovfTelemetryEnabled);
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_construct__values_out_of_range__counted_with_extreme_values) {
+    auto a = q_t::construct(11 * 256);
+    auto b = q_t::construct(-12 * 256);
+    auto c = q_t::construct(5 * 256);  // within range
+    auto d = q_t::construct(20 * 256);
+
+    auto entry = fpm::ovfTelemetryOf<q_t>();
+    ASSERT_EQ(10., a.real());
+    ASSERT_EQ(-10., b.real());
+    ASSERT_EQ(5., c.real());
+    ASSERT_EQ(10., d.real());
+    ASSERT_EQ(3u, entry.count);
+    ASSERT_EQ(-12 * 256, entry.min);
+    ASSERT_EQ(20 * 256, entry.max);
+    ASSERT_EQ(2u, entry.baseSize);
+    ASSERT_TRUE(entry.isSigned);
+    ASSERT_EQ(8, entry.f);
+    ASSERT_EQ(-10., entry.realMin);
+    ASSERT_EQ(10., entry.realMax);
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_cast__sign_changed__recorded_with_source_sign) {
+    auto a = static_q_cast<u_t>( i32q8<-100., 100.>::fromReal<-20.>() );
+    auto b = static_q_cast<u_t>( i32q8<-100., 100.>::fromReal<30.>() );
+
+    auto entry = fpm::ovfTelemetryOf<u_t>();
+    ASSERT_EQ(0., a.real());
+    ASSERT_EQ(10., b.real());
+    ASSERT_EQ(2u, entry.count);
+    ASSERT_EQ(-20 * 256, entry.min);
+    ASSERT_EQ(30 * 256, entry.max);
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_constructRange__values_out_of_range__counted_with_extreme_values) {
+    // more values than lanes, so that several blocks and the remaining values are recorded
+    std::vector<int16_t> values(37, 5 * 256);
+    values[1] = 11 * 256;
+    values[20] = -15 * 256;
+    values[35] = 12 * 256;
+    values[36] = -11 * 256;
+    std::vector<q_t> out(values.size(), q_t::fromReal<0.>());
+
+    auto const first = q_t::constructRange(std::span<int16_t const>(values), std::span<q_t>(out));
+
+    auto entry = fpm::ovfTelemetryOf<q_t>();
+    ASSERT_EQ(1u, first);
+    ASSERT_EQ(10., out[1].real());
+    ASSERT_EQ(-10., out[20].real());
+    ASSERT_EQ(4u, entry.count);
+    ASSERT_EQ(-15 * 256, entry.min);
+    ASSERT_EQ(12 * 256, entry.max);
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_constructRange_inPlace__values_out_of_range__pre_clamp_values_recorded) {
+    std::vector<q_t> values(5, q_t::fromReal<1.>());
+    std::vector<int16_t> const raw = { 0, 20 * 256, -30 * 256, 0, 256 };
+    (void)q_t::constructRange(std::span<int16_t const>(raw), std::span<q_t>(values));  // clamp
+    auto entry = fpm::ovfTelemetryOf<q_t>();
+    ASSERT_EQ(2u, entry.count);
+
+    // unchecked values, then checked in place
+    fpm::ovfTelemetryReset();
+    (void)q_t::constructRange<fpm::Ovf::unchecked>(std::span<int16_t const>(raw), std::span<q_t>(values));
+    ASSERT_EQ(0u, fpm::ovfTelemetryOf<q_t>().count);
+    (void)q_t::constructRange(std::span<q_t>(values));
+
+    entry = fpm::ovfTelemetryOf<q_t>();
+    ASSERT_EQ(2u, entry.count);
+    ASSERT_EQ(-30 * 256, entry.min);
+    ASSERT_EQ(20 * 256, entry.max);
+    ASSERT_EQ(-10., values[2].real());
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_saturating__results_clamped__recorded_before_clamping) {
+    auto a = q_t::fromReal<9.>();
+    auto b = q_t::fromReal<-9.>();
+
+    a.saturatingAdd( i16sq8<-5., 5.>::fromReal<3.>() );  // 12
+    b.saturatingSub( i16sq8<-5., 5.>::fromReal<4.5>() );  // -13.5
+    a.saturatingSub( i16sq8<-5., 5.>::fromReal<1.>() );  // 9, within range
+
+    auto entry = fpm::ovfTelemetryOf<q_t>();
+    ASSERT_EQ(9., a.real());
+    ASSERT_EQ(-10., b.real());
+    ASSERT_EQ(2u, entry.count);
+    ASSERT_EQ(-27 * 128, entry.min);
+    ASSERT_EQ(12 * 256, entry.max);
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_forEach__types_with_overflows__listed_once) {
+    (void)q_t::construct(11 * 256);
+    (void)q_t::construct(11 * 256);
+    (void)u_t::construct(11 * 256);
+
+    std::vector<fpm::OvfTelemetryEntry> entries;
+    fpm::ovfTelemetryForEach([&entries](fpm::OvfTelemetryEntry const &entry) {
+        if (entry.count > 0u) { entries.push_back(entry); }
+    });
+
+    ASSERT_EQ(2u, entries.size());
+    auto const signedEntry = std::find_if(entries.begin(), entries.end(), [](auto const &e) { return e.isSigned; });
+    ASSERT_NE(entries.end(), signedEntry);
+    ASSERT_EQ(2u, signedEntry->count);
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_reset__after_overflows__counters_cleared) {
+    (void)q_t::construct(11 * 256);
+
+    fpm::ovfTelemetryReset();
+
+    auto entry = fpm::ovfTelemetryOf<q_t>();
+    ASSERT_EQ(0u, entry.count);
+    ASSERT_EQ(std::numeric_limits<intmax_t>::max(), entry.min);
+    ASSERT_EQ(std::numeric_limits<intmax_t>::min(), entry.max);
+}
+
+TEST_F(TelemetryTest_Overflow, telemetry_threads__concurrent_overflows__all_counted) {
+    constexpr int nThreads = 4, nValues = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nThreads; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < nValues; ++i) { (void)q_t::construct(static_cast<int16_t>(2561 + t)); }
+        });
+    }
+    for (auto &thread : threads) { thread.join(); }
+
+    auto entry = fpm::ovfTelemetryOf<q_t>();
+    ASSERT_EQ(static_cast<uint32_t>(nThreads * nValues), entry.count);
+    ASSERT_EQ(2561, entry.min);
+    ASSERT_EQ(2561 + nThreads - 1, entry.max);
+}
+
+// EOF